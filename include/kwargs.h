@@ -44,12 +44,29 @@
 #include <vector>
 #include <array>
 #include <tuple>
+#include <ratio>
+#include <iterator>
 
 #include <stdexcept>
+#include <system_error>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <new>
 
 #include <cassert>
+#include <cstddef>
 #include <cstdlib>
 #include <cstdint>
+#include <cfloat>
+#include <cstring>
+
+#if defined(__SSSE3__) || defined(__AVX__)
+#   include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   include <emmintrin.h>
+#endif
 
 extern "C++"
 {
@@ -92,6 +109,18 @@ namespace kwargs
 #   define _KWARGS_ATTRIBUTE_UNLIKELY
 #endif
 
+#if defined(__GNUC__) || defined(__clang__)
+#   define _KWARGS_ATTRIBUTE_ALWAYS_INLINE  [[gnu::always_inline]]
+#else
+#   define _KWARGS_ATTRIBUTE_ALWAYS_INLINE
+#endif
+
+#if defined(__cpp_consteval) && __cpp_consteval >= 201811L
+#   define _KWARGS_CONSTEVAL  consteval
+#else
+#   define _KWARGS_CONSTEVAL  constexpr
+#endif
+
 
 #if defined(_MSC_VER)
 #   define _KWARGS_INT128
@@ -111,6 +140,35 @@ namespace kwargs
 #endif
 
 
+#if defined(__cpp_lib_is_constant_evaluated)
+#   define _KWARGS_IS_CONSTANT_EVALUATED()  std::is_constant_evaluated()
+#elif (defined(__GNUC__) && __GNUC__ >= 9) || (defined(__clang__) && __clang_major__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+#   define _KWARGS_IS_CONSTANT_EVALUATED()  __builtin_is_constant_evaluated()
+#else
+#   define _KWARGS_IS_CONSTANT_EVALUATED()  true
+#endif
+
+
+#if (defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || defined(_MSC_VER)
+#   define _KWARGS_LITTLE_ENDIAN  true
+#else
+#   define _KWARGS_LITTLE_ENDIAN  false
+#endif
+
+
+#if defined(__SSSE3__) || defined(__AVX__)
+#   define _KWARGS_HAS_SSSE3  true
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define _KWARGS_HAS_SSE2  true
+#endif
+
+#if defined(__AVX2__)
+#   define _KWARGS_HAS_AVX2  true
+#endif
+
+
 #if defined(_MSC_VER)
 #   pragma warning (push)
 #   pragma warning (disable: 5051)  // C5051: attribute [[attribute-name]] requires at least 'standard_version'; ignored
@@ -484,6 +542,27 @@ template<typename _Tp>
 using dereferenced_iterator_t = dereference_t<container_iterator_t<_Tp>>;
 
 
+template<typename _Tp, typename = std::void_t<>>
+struct container_element_type
+{
+    using type = std::conditional_t<
+        std::is_default_constructible_v<remove_reference_cv_t<dereferenced_iterator_t<_Tp>>>,
+        remove_reference_cv_t<dereferenced_iterator_t<_Tp>>,
+        remove_reference_cv_t<container_value_type_t<remove_reference_cv_t<_Tp>>>>;
+};
+
+// Proxy references (e.g. std::vector<bool>::reference) do not own a value, use value_type instead.
+template<typename _Tp>
+struct container_element_type<_Tp, std::enable_if_t<
+    has_container_value_type_v<_Tp> &&
+    std::negation_v<std::is_same<remove_reference_cv_t<dereferenced_iterator_t<_Tp>>, remove_reference_cv_t<container_value_type_t<_Tp>>>> &&
+    std::is_default_constructible_v<remove_reference_cv_t<container_value_type_t<_Tp>>>>>
+{ using type = remove_reference_cv_t<container_value_type_t<_Tp>>; };
+
+template<typename _Tp>
+using container_element_type_t = typename container_element_type<_Tp>::type;
+
+
 template<typename _Tp, typename = std::void_t<>>
 struct has_container_data : std::false_type { };
 
@@ -551,6 +630,35 @@ template<typename _Tp>
 static constexpr inline bool is_std_pair_v = is_std_pair<_Tp>::value;
 
 
+// std::chrono::duration and look-alikes, without including <chrono>.
+template<typename _Tp, typename = std::void_t<>>
+struct is_duration : std::false_type { };
+
+template<typename _Tp>
+struct is_duration<_Tp, std::void_t<
+    typename remove_reference_cv_t<_Tp>::rep,
+    decltype(remove_reference_cv_t<_Tp>::period::num),
+    decltype(std::declval<const remove_reference_cv_t<_Tp>&>().count())>> : std::true_type { };
+
+template<typename _Tp>
+static constexpr inline bool is_duration_v = is_duration<_Tp>::value;
+
+
+// kwargs::unit::SuffixTable, which is declared after this namespace.
+template<typename _Tp, typename = std::void_t<>>
+struct is_suffix_table : std::false_type { };
+
+template<typename _Tp>
+struct is_suffix_table<_Tp, std::void_t<typename remove_reference_cv_t<_Tp>::suffix_type>> : std::true_type { };
+
+template<typename _Tp>
+static constexpr inline bool is_suffix_table_v = is_suffix_table<_Tp>::value;
+
+// Whether a conversion was given a suffix table as its only argument.
+template<typename... _Args>
+static constexpr inline bool is_suffix_table_argument_v = sizeof...(_Args) == 1 && std::conjunction_v<is_suffix_table<_Args>...>;
+
+
 template<typename _Tp, typename = std::void_t<>>
 struct is_pair_like : std::false_type { };
 
@@ -1199,94 +1307,85 @@ _KWARGS_Test_(abs(std::numeric_limits<std::int64_t>::min()), static_cast<std::ui
 _KWARGS_Test_(abs(std::numeric_limits<std::int64_t>::min()), static_cast<std::uint64_t>(~std::numeric_limits<std::int64_t>::min()) + 1);
 
 
+inline constexpr float powers_of_ten_float[] = {
+    1e00f, 1e01f, 1e02f, 1e03f, 1e04f, 1e05f, 1e06f, 1e07f, 1e08f, 1e09f, 1e10f, 1e11f, 1e12f, 1e13f, 1e14f, 1e15f, 1e16f, 1e17f, 1e18f, 1e19f,
+    1e20f, 1e21f, 1e22f, 1e23f, 1e24f, 1e25f, 1e26f, 1e27f, 1e28f, 1e29f, 1e30f, 1e31f, 1e32f, 1e33f, 1e34f, 1e35f, 1e36f, 1e37f, 1e38f
+};
+
+inline constexpr float negative_powers_of_ten_float[] = {
+    1e-00f, 1e-01f, 1e-02f, 1e-03f, 1e-04f, 1e-05f, 1e-06f, 1e-07f, 1e-08f, 1e-09f, 1e-10f, 1e-11f, 1e-12f, 1e-13f, 1e-14f, 1e-15f, 1e-16f, 1e-17f, 1e-18f, 1e-19f,
+    1e-20f, 1e-21f, 1e-22f, 1e-23f, 1e-24f, 1e-25f, 1e-26f, 1e-27f, 1e-28f, 1e-29f, 1e-30f, 1e-31f, 1e-32f, 1e-33f, 1e-34f, 1e-35f, 1e-36f, 1e-37f, 1e-38f
+};
+
 template<typename _Tp>
 [[nodiscard]] constexpr auto power10(std::make_signed_t<std::size_t> __i) noexcept -> std::enable_if_t<std::is_same_v<std::remove_cv_t<_Tp>, float>, _Tp>
 {
-    constexpr float power[] = {
-        1e00f, 1e01f, 1e02f, 1e03f, 1e04f, 1e05f, 1e06f, 1e07f, 1e08f, 1e09f, 1e10f, 1e11f, 1e12f, 1e13f, 1e14f, 1e15f, 1e16f, 1e17f, 1e18f, 1e19f,
-        1e20f, 1e21f, 1e22f, 1e23f, 1e24f, 1e25f, 1e26f, 1e27f, 1e28f, 1e29f, 1e30f, 1e31f, 1e32f, 1e33f, 1e34f, 1e35f, 1e36f, 1e37f, 1e38f
-    };
-
-    constexpr float power_negative[] = {
-        1e-00f, 1e-01f, 1e-02f, 1e-03f, 1e-04f, 1e-05f, 1e-06f, 1e-07f, 1e-08f, 1e-09f, 1e-10f, 1e-11f, 1e-12f, 1e-13f, 1e-14f, 1e-15f, 1e-16f, 1e-17f, 1e-18f, 1e-19f,
-        1e-20f, 1e-21f, 1e-22f, 1e-23f, 1e-24f, 1e-25f, 1e-26f, 1e-27f, 1e-28f, 1e-29f, 1e-30f, 1e-31f, 1e-32f, 1e-33f, 1e-34f, 1e-35f, 1e-36f, 1e-37f, 1e-38f
-    };
-    
     if (__i >= 0)
     {
-        assert(__i < static_cast<decltype(__i)>(std::size(power)));
-        return power[__i];
+        assert(__i < static_cast<decltype(__i)>(std::size(powers_of_ten_float)));
+        return powers_of_ten_float[__i];
     }
     else
     {
-        assert(-__i < static_cast<decltype(__i)>(std::size(power_negative)));
-        return power_negative[-__i];
+        assert(-__i < static_cast<decltype(__i)>(std::size(negative_powers_of_ten_float)));
+        return negative_powers_of_ten_float[-__i];
     }
 }
 
+inline constexpr double powers_of_ten_double[] = {
+    1e000, 1e001, 1e002, 1e003, 1e004, 1e005, 1e006, 1e007, 1e008, 1e009, 1e010, 1e011, 1e012, 1e013, 1e014, 1e015, 1e016, 1e017, 1e018, 1e019,
+    1e020, 1e021, 1e022, 1e023, 1e024, 1e025, 1e026, 1e027, 1e028, 1e029, 1e030, 1e031, 1e032, 1e033, 1e034, 1e035, 1e036, 1e037, 1e038, 1e039,
+    1e040, 1e041, 1e042, 1e043, 1e044, 1e045, 1e046, 1e047, 1e048, 1e049, 1e050, 1e051, 1e052, 1e053, 1e054, 1e055, 1e056, 1e057, 1e058, 1e059,
+    1e060, 1e061, 1e062, 1e063, 1e064, 1e065, 1e066, 1e067, 1e068, 1e069, 1e070, 1e071, 1e072, 1e073, 1e074, 1e075, 1e076, 1e077, 1e078, 1e079,
+    1e080, 1e081, 1e082, 1e083, 1e084, 1e085, 1e086, 1e087, 1e088, 1e089, 1e090, 1e091, 1e092, 1e093, 1e094, 1e095, 1e096, 1e097, 1e098, 1e099,
+    1e100, 1e101, 1e102, 1e103, 1e104, 1e105, 1e106, 1e107, 1e108, 1e109, 1e110, 1e111, 1e112, 1e113, 1e114, 1e115, 1e116, 1e117, 1e118, 1e119,
+    1e120, 1e121, 1e122, 1e123, 1e124, 1e125, 1e126, 1e127, 1e128, 1e129, 1e130, 1e131, 1e132, 1e133, 1e134, 1e135, 1e136, 1e137, 1e138, 1e139,
+    1e140, 1e141, 1e142, 1e143, 1e144, 1e145, 1e146, 1e147, 1e148, 1e149, 1e150, 1e151, 1e152, 1e153, 1e154, 1e155, 1e156, 1e157, 1e158, 1e159,
+    1e160, 1e161, 1e162, 1e163, 1e164, 1e165, 1e166, 1e167, 1e168, 1e169, 1e170, 1e171, 1e172, 1e173, 1e174, 1e175, 1e176, 1e177, 1e178, 1e179,
+    1e180, 1e181, 1e182, 1e183, 1e184, 1e185, 1e186, 1e187, 1e188, 1e189, 1e190, 1e191, 1e192, 1e193, 1e194, 1e195, 1e196, 1e197, 1e198, 1e199,
+    1e200, 1e201, 1e202, 1e203, 1e204, 1e205, 1e206, 1e207, 1e208, 1e209, 1e210, 1e211, 1e212, 1e213, 1e214, 1e215, 1e216, 1e217, 1e218, 1e219,
+    1e220, 1e221, 1e222, 1e223, 1e224, 1e225, 1e226, 1e227, 1e228, 1e229, 1e230, 1e231, 1e232, 1e233, 1e234, 1e235, 1e236, 1e237, 1e238, 1e239,
+    1e240, 1e241, 1e242, 1e243, 1e244, 1e245, 1e246, 1e247, 1e248, 1e249, 1e250, 1e251, 1e252, 1e253, 1e254, 1e255, 1e256, 1e257, 1e258, 1e259,
+    1e260, 1e261, 1e262, 1e263, 1e264, 1e265, 1e266, 1e267, 1e268, 1e269, 1e270, 1e271, 1e272, 1e273, 1e274, 1e275, 1e276, 1e277, 1e278, 1e279,
+    1e280, 1e281, 1e282, 1e283, 1e284, 1e285, 1e286, 1e287, 1e288, 1e289, 1e290, 1e291, 1e292, 1e293, 1e294, 1e295, 1e296, 1e297, 1e298, 1e299,
+    1e300, 1e301, 1e302, 1e303, 1e304, 1e305, 1e306, 1e307, 1e308
+};
+
+inline constexpr double negative_powers_of_ten_double[] = {
+    1e-000, 1e-001, 1e-002, 1e-003, 1e-004, 1e-005, 1e-006, 1e-007, 1e-008, 1e-009, 1e-010, 1e-011, 1e-012, 1e-013, 1e-014, 1e-015, 1e-016, 1e-017, 1e-018, 1e-019,
+    1e-020, 1e-021, 1e-022, 1e-023, 1e-024, 1e-025, 1e-026, 1e-027, 1e-028, 1e-029, 1e-030, 1e-031, 1e-032, 1e-033, 1e-034, 1e-035, 1e-036, 1e-037, 1e-038, 1e-039,
+    1e-040, 1e-041, 1e-042, 1e-043, 1e-044, 1e-045, 1e-046, 1e-047, 1e-048, 1e-049, 1e-050, 1e-051, 1e-052, 1e-053, 1e-054, 1e-055, 1e-056, 1e-057, 1e-058, 1e-059,
+    1e-060, 1e-061, 1e-062, 1e-063, 1e-064, 1e-065, 1e-066, 1e-067, 1e-068, 1e-069, 1e-070, 1e-071, 1e-072, 1e-073, 1e-074, 1e-075, 1e-076, 1e-077, 1e-078, 1e-079,
+    1e-080, 1e-081, 1e-082, 1e-083, 1e-084, 1e-085, 1e-086, 1e-087, 1e-088, 1e-089, 1e-090, 1e-091, 1e-092, 1e-093, 1e-094, 1e-095, 1e-096, 1e-097, 1e-098, 1e-099,
+    1e-100, 1e-101, 1e-102, 1e-103, 1e-104, 1e-105, 1e-106, 1e-107, 1e-108, 1e-109, 1e-110, 1e-111, 1e-112, 1e-113, 1e-114, 1e-115, 1e-116, 1e-117, 1e-118, 1e-119,
+    1e-120, 1e-121, 1e-122, 1e-123, 1e-124, 1e-125, 1e-126, 1e-127, 1e-128, 1e-129, 1e-130, 1e-131, 1e-132, 1e-133, 1e-134, 1e-135, 1e-136, 1e-137, 1e-138, 1e-139,
+    1e-140, 1e-141, 1e-142, 1e-143, 1e-144, 1e-145, 1e-146, 1e-147, 1e-148, 1e-149, 1e-150, 1e-151, 1e-152, 1e-153, 1e-154, 1e-155, 1e-156, 1e-157, 1e-158, 1e-159,
+    1e-160, 1e-161, 1e-162, 1e-163, 1e-164, 1e-165, 1e-166, 1e-167, 1e-168, 1e-169, 1e-170, 1e-171, 1e-172, 1e-173, 1e-174, 1e-175, 1e-176, 1e-177, 1e-178, 1e-179,
+    1e-180, 1e-181, 1e-182, 1e-183, 1e-184, 1e-185, 1e-186, 1e-187, 1e-188, 1e-189, 1e-190, 1e-191, 1e-192, 1e-193, 1e-194, 1e-195, 1e-196, 1e-197, 1e-198, 1e-199,
+    1e-200, 1e-201, 1e-202, 1e-203, 1e-204, 1e-205, 1e-206, 1e-207, 1e-208, 1e-209, 1e-210, 1e-211, 1e-212, 1e-213, 1e-214, 1e-215, 1e-216, 1e-217, 1e-218, 1e-219,
+    1e-220, 1e-221, 1e-222, 1e-223, 1e-224, 1e-225, 1e-226, 1e-227, 1e-228, 1e-229, 1e-230, 1e-231, 1e-232, 1e-233, 1e-234, 1e-235, 1e-236, 1e-237, 1e-238, 1e-239,
+    1e-240, 1e-241, 1e-242, 1e-243, 1e-244, 1e-245, 1e-246, 1e-247, 1e-248, 1e-249, 1e-250, 1e-251, 1e-252, 1e-253, 1e-254, 1e-255, 1e-256, 1e-257, 1e-258, 1e-259,
+    1e-260, 1e-261, 1e-262, 1e-263, 1e-264, 1e-265, 1e-266, 1e-267, 1e-268, 1e-269, 1e-270, 1e-271, 1e-272, 1e-273, 1e-274, 1e-275, 1e-276, 1e-277, 1e-278, 1e-279,
+    1e-280, 1e-281, 1e-282, 1e-283, 1e-284, 1e-285, 1e-286, 1e-287, 1e-288, 1e-289, 1e-290, 1e-291, 1e-292, 1e-293, 1e-294, 1e-295, 1e-296, 1e-297, 1e-298, 1e-299,
+    1e-300, 1e-301, 1e-302, 1e-303, 1e-304, 1e-305, 1e-306, 1e-307, 1e-308
+};
+
 template<typename _Tp>
 [[nodiscard]] constexpr auto power10(std::make_signed_t<std::size_t> __i) noexcept -> std::enable_if_t<std::is_same_v<std::remove_cv_t<_Tp>, double>, _Tp>
 {
-    constexpr double power[] = {
-        1e000, 1e001, 1e002, 1e003, 1e004, 1e005, 1e006, 1e007, 1e008, 1e009, 1e010, 1e011, 1e012, 1e013, 1e014, 1e015, 1e016, 1e017, 1e018, 1e019,
-        1e020, 1e021, 1e022, 1e023, 1e024, 1e025, 1e026, 1e027, 1e028, 1e029, 1e030, 1e031, 1e032, 1e033, 1e034, 1e035, 1e036, 1e037, 1e038, 1e039,
-        1e040, 1e041, 1e042, 1e043, 1e044, 1e045, 1e046, 1e047, 1e048, 1e049, 1e050, 1e051, 1e052, 1e053, 1e054, 1e055, 1e056, 1e057, 1e058, 1e059,
-        1e060, 1e061, 1e062, 1e063, 1e064, 1e065, 1e066, 1e067, 1e068, 1e069, 1e070, 1e071, 1e072, 1e073, 1e074, 1e075, 1e076, 1e077, 1e078, 1e079,
-        1e080, 1e081, 1e082, 1e083, 1e084, 1e085, 1e086, 1e087, 1e088, 1e089, 1e090, 1e091, 1e092, 1e093, 1e094, 1e095, 1e096, 1e097, 1e098, 1e099,
-        1e100, 1e101, 1e102, 1e103, 1e104, 1e105, 1e106, 1e107, 1e108, 1e109, 1e110, 1e111, 1e112, 1e113, 1e114, 1e115, 1e116, 1e117, 1e118, 1e119,
-        1e120, 1e121, 1e122, 1e123, 1e124, 1e125, 1e126, 1e127, 1e128, 1e129, 1e130, 1e131, 1e132, 1e133, 1e134, 1e135, 1e136, 1e137, 1e138, 1e139,
-        1e140, 1e141, 1e142, 1e143, 1e144, 1e145, 1e146, 1e147, 1e148, 1e149, 1e150, 1e151, 1e152, 1e153, 1e154, 1e155, 1e156, 1e157, 1e158, 1e159,
-        1e160, 1e161, 1e162, 1e163, 1e164, 1e165, 1e166, 1e167, 1e168, 1e169, 1e170, 1e171, 1e172, 1e173, 1e174, 1e175, 1e176, 1e177, 1e178, 1e179,
-        1e180, 1e181, 1e182, 1e183, 1e184, 1e185, 1e186, 1e187, 1e188, 1e189, 1e190, 1e191, 1e192, 1e193, 1e194, 1e195, 1e196, 1e197, 1e198, 1e199,
-        1e200, 1e201, 1e202, 1e203, 1e204, 1e205, 1e206, 1e207, 1e208, 1e209, 1e210, 1e211, 1e212, 1e213, 1e214, 1e215, 1e216, 1e217, 1e218, 1e219,
-        1e220, 1e221, 1e222, 1e223, 1e224, 1e225, 1e226, 1e227, 1e228, 1e229, 1e230, 1e231, 1e232, 1e233, 1e234, 1e235, 1e236, 1e237, 1e238, 1e239,
-        1e240, 1e241, 1e242, 1e243, 1e244, 1e245, 1e246, 1e247, 1e248, 1e249, 1e250, 1e251, 1e252, 1e253, 1e254, 1e255, 1e256, 1e257, 1e258, 1e259,
-        1e260, 1e261, 1e262, 1e263, 1e264, 1e265, 1e266, 1e267, 1e268, 1e269, 1e270, 1e271, 1e272, 1e273, 1e274, 1e275, 1e276, 1e277, 1e278, 1e279,
-        1e280, 1e281, 1e282, 1e283, 1e284, 1e285, 1e286, 1e287, 1e288, 1e289, 1e290, 1e291, 1e292, 1e293, 1e294, 1e295, 1e296, 1e297, 1e298, 1e299,
-        1e300, 1e301, 1e302, 1e303, 1e304, 1e305, 1e306, 1e307, 1e308
-    };
-    
-    constexpr double power_negative[] = {
-        1e-000, 1e-001, 1e-002, 1e-003, 1e-004, 1e-005, 1e-006, 1e-007, 1e-008, 1e-009, 1e-010, 1e-011, 1e-012, 1e-013, 1e-014, 1e-015, 1e-016, 1e-017, 1e-018, 1e-019,
-        1e-020, 1e-021, 1e-022, 1e-023, 1e-024, 1e-025, 1e-026, 1e-027, 1e-028, 1e-029, 1e-030, 1e-031, 1e-032, 1e-033, 1e-034, 1e-035, 1e-036, 1e-037, 1e-038, 1e-039,
-        1e-040, 1e-041, 1e-042, 1e-043, 1e-044, 1e-045, 1e-046, 1e-047, 1e-048, 1e-049, 1e-050, 1e-051, 1e-052, 1e-053, 1e-054, 1e-055, 1e-056, 1e-057, 1e-058, 1e-059,
-        1e-060, 1e-061, 1e-062, 1e-063, 1e-064, 1e-065, 1e-066, 1e-067, 1e-068, 1e-069, 1e-070, 1e-071, 1e-072, 1e-073, 1e-074, 1e-075, 1e-076, 1e-077, 1e-078, 1e-079,
-        1e-080, 1e-081, 1e-082, 1e-083, 1e-084, 1e-085, 1e-086, 1e-087, 1e-088, 1e-089, 1e-090, 1e-091, 1e-092, 1e-093, 1e-094, 1e-095, 1e-096, 1e-097, 1e-098, 1e-099,
-        1e-100, 1e-101, 1e-102, 1e-103, 1e-104, 1e-105, 1e-106, 1e-107, 1e-108, 1e-109, 1e-110, 1e-111, 1e-112, 1e-113, 1e-114, 1e-115, 1e-116, 1e-117, 1e-118, 1e-119,
-        1e-120, 1e-121, 1e-122, 1e-123, 1e-124, 1e-125, 1e-126, 1e-127, 1e-128, 1e-129, 1e-130, 1e-131, 1e-132, 1e-133, 1e-134, 1e-135, 1e-136, 1e-137, 1e-138, 1e-139,
-        1e-140, 1e-141, 1e-142, 1e-143, 1e-144, 1e-145, 1e-146, 1e-147, 1e-148, 1e-149, 1e-150, 1e-151, 1e-152, 1e-153, 1e-154, 1e-155, 1e-156, 1e-157, 1e-158, 1e-159,
-        1e-160, 1e-161, 1e-162, 1e-163, 1e-164, 1e-165, 1e-166, 1e-167, 1e-168, 1e-169, 1e-170, 1e-171, 1e-172, 1e-173, 1e-174, 1e-175, 1e-176, 1e-177, 1e-178, 1e-179,
-        1e-180, 1e-181, 1e-182, 1e-183, 1e-184, 1e-185, 1e-186, 1e-187, 1e-188, 1e-189, 1e-190, 1e-191, 1e-192, 1e-193, 1e-194, 1e-195, 1e-196, 1e-197, 1e-198, 1e-199,
-        1e-200, 1e-201, 1e-202, 1e-203, 1e-204, 1e-205, 1e-206, 1e-207, 1e-208, 1e-209, 1e-210, 1e-211, 1e-212, 1e-213, 1e-214, 1e-215, 1e-216, 1e-217, 1e-218, 1e-219,
-        1e-220, 1e-221, 1e-222, 1e-223, 1e-224, 1e-225, 1e-226, 1e-227, 1e-228, 1e-229, 1e-230, 1e-231, 1e-232, 1e-233, 1e-234, 1e-235, 1e-236, 1e-237, 1e-238, 1e-239,
-        1e-240, 1e-241, 1e-242, 1e-243, 1e-244, 1e-245, 1e-246, 1e-247, 1e-248, 1e-249, 1e-250, 1e-251, 1e-252, 1e-253, 1e-254, 1e-255, 1e-256, 1e-257, 1e-258, 1e-259,
-        1e-260, 1e-261, 1e-262, 1e-263, 1e-264, 1e-265, 1e-266, 1e-267, 1e-268, 1e-269, 1e-270, 1e-271, 1e-272, 1e-273, 1e-274, 1e-275, 1e-276, 1e-277, 1e-278, 1e-279,
-        1e-280, 1e-281, 1e-282, 1e-283, 1e-284, 1e-285, 1e-286, 1e-287, 1e-288, 1e-289, 1e-290, 1e-291, 1e-292, 1e-293, 1e-294, 1e-295, 1e-296, 1e-297, 1e-298, 1e-299,
-        1e-300, 1e-301, 1e-302, 1e-303, 1e-304, 1e-305, 1e-306, 1e-307, 1e-308
-    };
-
     if (__i >= 0)
     {
-        assert(__i < static_cast<decltype(__i)>(std::size(power)));
-        return power[__i];
+        assert(__i < static_cast<decltype(__i)>(std::size(powers_of_ten_double)));
+        return powers_of_ten_double[__i];
     }
     else
     {
-        assert(-__i < static_cast<decltype(__i)>(std::size(power_negative)));
-        return power_negative[-__i];
+        assert(-__i < static_cast<decltype(__i)>(std::size(negative_powers_of_ten_double)));
+        return negative_powers_of_ten_double[-__i];
     }
 }
 
-template<typename _Tp>
-[[nodiscard]] constexpr auto power10(std::make_signed_t<std::size_t> __i) noexcept -> std::enable_if_t<std::is_same_v<std::remove_cv_t<_Tp>, long double>, _Tp>
-{
-#if !defined(_KWARGS_HAS_FLOAT128)
-
-    static_assert(sizeof(long double) == sizeof(double));
-
-    return static_cast<_Tp>(power10<double>(__i));
-
-#else
+#if defined(_KWARGS_HAS_FLOAT128)
 
 #define _KWARGS_GENERATE_LITERAL(T) \
     T(0000)T(0001)T(0002)T(0003)T(0004)T(0005)T(0006)T(0007)T(0008)T(0009)T(0010)T(0011)T(0012)T(0013)T(0014)T(0015)T(0016)T(0017)T(0018)T(0019)T(0020)T(0021)T(0022)T(0023)T(0024)T(0025)T(0026)T(0027)T(0028)T(0029)T(0030)T(0031)T(0032)T(0033)T(0034)T(0035)T(0036)T(0037)T(0038)T(0039)T(0040)T(0041)T(0042)T(0043)T(0044)T(0045)T(0046)T(0047)T(0048)T(0049)T(0050)T(0051)T(0052)T(0053)T(0054)T(0055)T(0056)T(0057)T(0058)T(0059)T(0060)T(0061)T(0062)T(0063)T(0064)T(0065)T(0066)T(0067)T(0068)T(0069)T(0070)T(0071)T(0072)T(0073)T(0074)T(0075)T(0076)T(0077)T(0078)T(0079)T(0080)T(0081)T(0082)T(0083)T(0084)T(0085)T(0086)T(0087)T(0088)T(0089)T(0090)T(0091)T(0092)T(0093)T(0094)T(0095)T(0096)T(0097)T(0098)T(0099) \
@@ -1343,27 +1442,40 @@ template<typename _Tp>
 #define _KWARGS_GENERATE_LITERAL_LONGDOUBLE(N)           1e+##N##L,
 #define _KWARGS_GENERATE_LITERAL_LONGDOUBLE_NEGATIVE(N)  1e-##N##L,
 
-    constexpr long double power[] = {
-        _KWARGS_GENERATE_LITERAL(_KWARGS_GENERATE_LITERAL_LONGDOUBLE)
-    };
+inline constexpr long double powers_of_ten_long_double[] = {
+    _KWARGS_GENERATE_LITERAL(_KWARGS_GENERATE_LITERAL_LONGDOUBLE)
+};
 
-    constexpr long double power_negative[] = {
-        _KWARGS_GENERATE_LITERAL(_KWARGS_GENERATE_LITERAL_LONGDOUBLE_NEGATIVE)
-    };
+inline constexpr long double negative_powers_of_ten_long_double[] = {
+    _KWARGS_GENERATE_LITERAL(_KWARGS_GENERATE_LITERAL_LONGDOUBLE_NEGATIVE)
+};
 
 #undef  _KWARGS_GENERATE_LITERAL_LONGDOUBLE
 #undef  _KWARGS_GENERATE_LITERAL_LONGDOUBLE_NEGATIVE
-#undef  _KWARGS_GENERATE
-    
+#undef  _KWARGS_GENERATE_LITERAL
+
+#endif  // _KWARGS_HAS_FLOAT128
+
+template<typename _Tp>
+[[nodiscard]] constexpr auto power10(std::make_signed_t<std::size_t> __i) noexcept -> std::enable_if_t<std::is_same_v<std::remove_cv_t<_Tp>, long double>, _Tp>
+{
+#if !defined(_KWARGS_HAS_FLOAT128)
+
+    static_assert(sizeof(long double) == sizeof(double));
+
+    return static_cast<_Tp>(power10<double>(__i));
+
+#else
+
     if (__i >= 0)
     {
-        assert(__i < static_cast<decltype(__i)>(std::size(power)));
-        return power[__i];
+        assert(__i < static_cast<decltype(__i)>(std::size(powers_of_ten_long_double)));
+        return powers_of_ten_long_double[__i];
     }
     else
     {
-        assert(-__i < static_cast<decltype(__i)>(std::size(power_negative)));
-        return power_negative[-__i];
+        assert(-__i < static_cast<decltype(__i)>(std::size(negative_powers_of_ten_long_double)));
+        return negative_powers_of_ten_long_double[-__i];
     }
 
 #endif  // _KWARGS_HAS_FLOAT128
@@ -1532,12 +1644,14 @@ constexpr void bit_swap(_Ltp& __left, _Rtp& __right) noexcept
 
 
 template<typename _InputForwardIterator, typename _OutputForwardIterator>
-constexpr void copy(_InputForwardIterator __first, _InputForwardIterator __last, _OutputForwardIterator __dest) noexcept
+constexpr _OutputForwardIterator copy(_InputForwardIterator __first, _InputForwardIterator __last, _OutputForwardIterator __dest) noexcept
 {
     for (; __first != __last; ++__first, ++__dest)
     {
         *__dest = *__first;
     }
+
+    return __dest;
 }
 
 
@@ -1603,13 +1717,13 @@ _KWARGS_Test_([]() constexpr noexcept -> bool { constexpr int s[] = {1, 2, 3, 5,
 
 constexpr bool is_space_character(char __c) noexcept
 {
-    constexpr char scs[]{'\0', '\t', '\n', '\v', '\f', '\r', ' '};
-    
-    static_assert(is_sorted(std::begin(scs), std::end(scs)));
-
-    return binary_search(std::begin(scs), std::end(scs), __c);
+    // '\0', '\t', '\n', '\v', '\f', '\r', ' '
+    return __c == ' ' || (__c >= '\t' && __c <= '\r') || __c == '\0';
 }
 
+_KWARGS_Test_(is_space_character('\0') && is_space_character('\t') && is_space_character('\r') && is_space_character(' '));
+_KWARGS_Test_(is_space_character('\b') || is_space_character('0') || is_space_character('_'), false);
+
 constexpr bool is_not_space_character(char __c) noexcept
 {
     return !is_space_character(__c);
@@ -1655,2874 +1769,9231 @@ constexpr void string_view_trimmed(std::string_view& __sv) noexcept
 _KWARGS_Test_([]() constexpr noexcept -> bool { std::string_view sv = "  _ 5201314 _  "; string_view_trimmed(sv); return sv == "_ 5201314 _"; }());
 
 
-// high -> low
-template<typename _ForwardIterator, typename _RandomAccessIterator>
-constexpr std::size_t long_binary_to_decimal(_ForwardIterator __first, _ForwardIterator __last, _RandomAccessIterator __result, bool __char_mode = false)
+[[nodiscard]] constexpr bool is_constant_evaluated() noexcept
 {
-    auto at = [&__result](auto i) constexpr noexcept -> std::add_lvalue_reference_t<decltype(*(__result + i))> {
-        return *(__result + i);
-    };
+    return _KWARGS_IS_CONSTANT_EVALUATED();
+}
 
-    std::size_t digit_size = 1;
-    __result[0] = 0;
 
-    for (; __first != __last; ++__first)
+#if defined(KWARGS_CONVERT_WITH_BOUNDED_STACK)
+template<typename _Tp, typename _Tag>
+[[nodiscard]] inline _Tp& thread_scratch() noexcept
+{
+    thread_local _Tp object;
+    return object;
+}
+#endif
+
+template<typename _Tp, typename _Function>
+constexpr decltype(auto) with_local_scratch(_Function& __function)
+{
+    _Tp _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(object);
+    return __function(object);
+}
+
+/**
+ * @brief Calls @c __function with a scratch @c _Tp, which its user must reinitialize.
+ * 
+ * With @c KWARGS_CONVERT_WITH_BOUNDED_STACK the object is thread-local at run time
+ * (one per @c _Tag, so differently tagged uses may nest), keeping large buffers off the stack.
+ */
+template<typename _Tp, typename _Tag = _Tp, typename _Function>
+constexpr decltype(auto) with_scratch(_Function&& __function)
+{
+#if defined(KWARGS_CONVERT_WITH_BOUNDED_STACK)
+    if (is_constant_evaluated() == false)
     {
-        bool bit = static_cast<bool>(*__first);
-        
-        // Multiply decimal digits by 2
-        int carry = 0;
-        for (std::size_t i = 0; i < digit_size; ++i)
+        return __function(thread_scratch<_Tp, _Tag>());
+    }
+#endif
+
+    return with_local_scratch<_Tp>(__function);
+}
+
+
+// An unsigned integer below 2^_Bits, stored as little-endian limbs of nine decimal digits.
+template<std::size_t _Bits>
+struct decimal_limbs
+{
+    static constexpr std::uint32_t base = 1'000'000'000;
+
+    static constexpr std::size_t capacity = _Bits * 30103 / 100000 / 9 + 2;
+
+    std::uint32_t limbs[capacity] { };
+    std::size_t size = 0;
+
+    // *this = *this * __multiplier + __addend; both must not exceed 2^32.
+    constexpr void multiply_add(std::uint64_t __multiplier, std::uint64_t __addend) noexcept
+    {
+        std::uint64_t carry = __addend;
+
+        for (std::size_t i = 0; i < size; ++i)
         {
-            int val = at(i) * 2 + carry;
-            at(i) = val % 10;
-            carry = val / 10;
+            carry += limbs[i] * __multiplier;
+            limbs[i] = static_cast<std::uint32_t>(carry % base);
+            carry /= base;
         }
 
-        if (carry)
+        for (; carry; carry /= base)
         {
-            at(digit_size++) = static_cast<std::remove_reference_t<decltype(at(std::declval<std::size_t>()))>>(carry);
+            limbs[size++] = static_cast<std::uint32_t>(carry % base);
         }
+    }
 
-        // Add current bit
-        carry = bit;
-        for (std::size_t i = 0; i < digit_size; ++i)
+    template<typename _Tp>
+    constexpr void assign(_Tp __n) noexcept
+    {
+        for (size = 0; __n; __n /= base)
         {
-            int val = at(i) + carry;
-            at(i) = val % 10;
-            carry = val / 10;
+            limbs[size++] = static_cast<std::uint32_t>(__n % base);
+        }
+    }
 
-            if (carry == 0)
-            {
-                break;
-            }
+    // *this *= 2^__shift
+    constexpr void shift_left(int __shift) noexcept
+    {
+        for (; __shift >= 32; __shift -= 32)
+        {
+            multiply_add(1ULL << 32, 0);
         }
 
-        if (carry)
+        if (__shift > 0)
         {
-            at(digit_size++) = static_cast<std::remove_reference_t<decltype(at(std::declval<std::size_t>()))>>(carry);
+            multiply_add(1ULL << __shift, 0);
         }
     }
 
-    // Reverse and map to characters
-    if (__char_mode)
+    [[nodiscard]] constexpr std::size_t digit_count() const noexcept
     {
-        for (std::size_t i = 0; i < digit_size / 2; ++i)
+        std::size_t count = 1;
+
+        if (size)
         {
-            bit_swap(at(i), at(digit_size - i - 1));
+            count = (size - 1) * 9;
 
-            at(i) += '0';
-            at(digit_size - i - 1) += '0';
+            for (std::uint32_t top = limbs[size - 1]; top; top /= 10)
+            {
+                ++count;
+            }
         }
 
-        if (digit_size & 1)
-        {
-            at(digit_size / 2) += '0';
-        }
+        return count;
     }
-    else
+
+    constexpr char* to_chars(char* __first) const noexcept
     {
-        for (std::size_t i = 0; i < digit_size / 2; ++i)
+        if (size == 0)
         {
-            bit_swap(at(i), at(digit_size - i - 1));
+            *__first++ = '0';
+            return __first;
         }
-    }
 
-    return digit_size;
-}
+        char digits[9] = {};
+        std::size_t count = 0;
 
+        for (std::uint32_t top = limbs[size - 1]; top; top /= 10)
+        {
+            digits[count++] = static_cast<char>('0' + top % 10);
+        }
 
-template<typename _Tp, std::enable_if_t<is_unsigned_v<_Tp>, int> = 0>
-[[nodiscard]] constexpr auto string_to_integer(std::string_view __str) noexcept
-{
-    using type = std::conditional_t<
-            std::is_same_v<remove_reference_cv_t<_Tp>, bool>,
-            std::uint8_t,
-            enum_underlying_type_t<remove_reference_cv_t<_Tp>>>;
-    
-    using result_type = std::remove_reference_t<_Tp>;
+        while (count)
+        {
+            *__first++ = digits[--count];
+        }
 
-    type result = static_cast<type>(0);
+        for (std::size_t i = size - 1; i--; )
+        {
+            std::uint32_t limb = limbs[i];
 
-    string_view_trimmed(__str);
+            for (std::size_t j = 9; j--; limb /= 10)
+            {
+                __first[j] = static_cast<char>('0' + limb % 10);
+            }
 
-    if (__str.empty())
+            __first += 9;
+        }
+
+        return __first;
+    }
+};
+
+// An unsigned integer below 2^_Bits, stored as little-endian 32-bit limbs.
+template<std::size_t _Bits>
+struct binary_limbs
+{
+    static constexpr std::size_t capacity = _Bits / 32 + 2;
+
+    std::uint32_t limbs[capacity] { };
+    std::size_t size = 0;
+
+    constexpr void assign(std::uint64_t __n) noexcept
     {
-        return result_type{};
+        for (size = 0; __n; __n >>= 32)
+        {
+            limbs[size++] = static_cast<std::uint32_t>(__n);
+        }
     }
 
-    if (__str.front() == '+')
+    constexpr void multiply(std::uint32_t __multiplier) noexcept
     {
-        __str.remove_prefix(1);
-        string_view_left_trimmed(__str);
+        std::uint64_t carry = 0;
 
-        if (__str.empty())
+        for (std::size_t i = 0; i < size; ++i)
         {
-            return result_type{};
+            carry += static_cast<std::uint64_t>(limbs[i]) * __multiplier;
+            limbs[i] = static_cast<std::uint32_t>(carry);
+            carry >>= 32;
+        }
+
+        if (carry)
+        {
+            limbs[size++] = static_cast<std::uint32_t>(carry);
         }
     }
 
+    [[nodiscard]] constexpr bool bit(std::size_t __index) const noexcept
+    { return __index / 32 < size && ((limbs[__index / 32] >> (__index % 32)) & 1); }
 
-    if (is_same_string_ignore_case(__str, "max"))
-    {
-        return static_cast<result_type>(std::numeric_limits<type>::max());
-    }
-    else if (is_same_string_ignore_case(__str, "min"))
-    {
-        return static_cast<result_type>(std::numeric_limits<type>::min());
-    }
-    else if (is_same_string_ignore_case(__str, "true"))
-    {
-        return static_cast<result_type>(true);
-    }
-    else if (is_same_string_ignore_case(__str, "false"))
+    // Whether any bit below __index is set.
+    [[nodiscard]] constexpr bool any_bit_below(std::size_t __index) const noexcept
     {
-        return static_cast<result_type>(false);
-    }
+        for (std::size_t i = 0; i < __index / 32 && i < size; ++i)
+        {
+            if (limbs[i])
+            {
+                return true;
+            }
+        }
 
+        return __index % 32 && __index / 32 < size && (limbs[__index / 32] & ((1U << (__index % 32)) - 1));
+    }
 
-    if (__str.size() >= 2 && __str[0] == '0')
+    constexpr void shift_right(std::size_t __shift) noexcept
     {
-#define _KWARGS_Convert_to_decimal_from(__radix, __start)                                           \
-            do                                                                                      \
-            {                                                                                       \
-                for (auto it = __start, last = __str.end(); it != last; ++it)                       \
-                {                                                                                   \
-                    if (is_radix_character(*it, __radix) == false)                                  \
-                    {                                                                               \
-                        return static_cast<result_type>(result);                                    \
-                    }                                                                               \
-                    result = type(result * type(__radix) + type(radix_character_to_integer(*it)));  \
-                }                                                                                   \
-                return static_cast<result_type>(result);                                            \
-            } while (false)
+        const std::size_t words = __shift / 32;
+        const unsigned bits = static_cast<unsigned>(__shift % 32);
 
+        if (words >= size)
+        {
+            size = 0;
+            return;
+        }
 
-        switch (__str[1])
+        for (std::size_t i = 0; i + words < size; ++i)
         {
-            // Binary
-            case 'b': case 'B':
-                _KWARGS_Convert_to_decimal_from(2, __str.begin() + 2);
-                
-            // Octal
-            case 'o': case 'O':
-                _KWARGS_Convert_to_decimal_from(8, __str.begin() + 2);
+            std::uint64_t window = limbs[i + words];
 
-            // Hexadecimal
-            case 'x': case 'X':
-            case 'h': case 'H':
-                _KWARGS_Convert_to_decimal_from(16, __str.begin() + 2);
+            if (i + words + 1 < size)
+            {
+                window |= static_cast<std::uint64_t>(limbs[i + words + 1]) << 32;
+            }
+
+            limbs[i] = static_cast<std::uint32_t>(window >> bits);
         }
 
+        size -= words;
+
+        while (size && limbs[size - 1] == 0)
+        {
+            --size;
+        }
     }
 
-    // Decimal
-    _KWARGS_Convert_to_decimal_from(10, __str.begin());
+    template<std::size_t _DecimalBits>
+    constexpr void to_decimal(decimal_limbs<_DecimalBits>& __result) const noexcept
+    {
+        __result.size = 0;
 
-#undef _KWARGS_Convert_to_decimal_from
-}
+        for (std::size_t i = size; i--; )
+        {
+            __result.multiply_add(1ULL << 32, limbs[i]);
+        }
+    }
+};
 
-template<typename _Tp, std::enable_if_t<is_signed_v<_Tp>, int> = 0>
-[[nodiscard]] constexpr auto string_to_integer(std::string_view __str) noexcept
+// Writes __significand * 2^__shift in decimal; __shift may be negative.
+template<std::size_t _Bits, typename _Tp>
+constexpr char* binary_to_decimal_chars(char* __first, _Tp __significand, int __shift) noexcept
 {
-    using type = enum_underlying_type_t<remove_reference_cv_t<_Tp>>;
-    using result_type = std::remove_reference_t<_Tp>;
+    return with_scratch<decimal_limbs<_Bits>>([=](decimal_limbs<_Bits>& __result) constexpr noexcept -> char* {
+        if (__shift < 0)
+        {
+            __result.assign(-__shift >= static_cast<int>(sizeof(_Tp) * 8) ? _Tp(0) : static_cast<_Tp>(__significand >> -__shift));
+        }
+        else
+        {
+            __result.assign(__significand);
+            __result.shift_left(__shift);
+        }
 
-    string_view_trimmed(__str);
+        return __result.to_chars(__first);
+    });
+}
 
-    if (__str.empty())
-    {
-        return result_type{};
-    }
+_KWARGS_Test_([]() constexpr noexcept -> bool { char s[4] = {}; return binary_to_decimal_chars<8>(s, 0U, 0) == s + 1 && s[0] == '0'; }());
+_KWARGS_Test_([]() constexpr noexcept -> bool { char s[32] = {}; binary_to_decimal_chars<64>(s, 1ULL, 63); return std::string_view(s) == "9223372036854775808"; }());
+_KWARGS_Test_([]() constexpr noexcept -> bool { char s[48] = {}; binary_to_decimal_chars<128>(s, 0xFFFFFFFFFFFFFFFFULL, 64); return std::string_view(s) == "340282366920938463444927863358058659840"; }());
+_KWARGS_Test_([]() constexpr noexcept -> bool { char s[32] = {}; binary_to_decimal_chars<64>(s, 1000000000000000000ULL, -3); return std::string_view(s) == "125000000000000000"; }());
 
-    bool negative = false;
 
-    if (__str.front() == '-')
-    {
-        negative = true;
-        __str.remove_prefix(1);
-    }
-    else if (__str.front() == '+')
+/**
+ * @brief Converts 4 ASCII digits loaded in little-endian order.
+ * 
+ * @return false if any of the 4 bytes is not a decimal digit.
+ */
+[[nodiscard]] constexpr bool swar_parse_4_digits(std::uint32_t __chunk, std::uint32_t& __result) noexcept
+{
+    __chunk -= 0x3030'3030U;
+
+    // Each byte must be in [0, 9] after subtracting '0'; adding 6 must not carry into the high nibble.
+    if (((__chunk | (__chunk + 0x0606'0606U)) & 0xF0F0'F0F0U) != 0)
     {
-        __str.remove_prefix(1);
+        return false;
     }
 
-    type _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(result);
+    __chunk = (__chunk * 10 + (__chunk >> 8)) & 0x00FF'00FFU;
+    __chunk = (__chunk * 100 + (__chunk >> 16)) & 0x0000'FFFFU;
 
-    if (is_same_string_ignore_case(__str, "max"))
-    {
-        result = std::numeric_limits<type>::max();
-    }
-    else if (is_same_string_ignore_case(__str, "min"))
-    {
-        result = std::numeric_limits<type>::min();
-    }
-    else
+    __result = __chunk;
+    return true;
+}
+
+/**
+ * @brief Converts 8 ASCII digits loaded in little-endian order.
+ * 
+ * @return false if any of the 8 bytes is not a decimal digit.
+ */
+[[nodiscard]] constexpr bool swar_parse_8_digits(std::uint64_t __chunk, std::uint32_t& __result) noexcept
+{
+    __chunk -= 0x3030'3030'3030'3030ULL;
+
+    if (((__chunk | (__chunk + 0x0606'0606'0606'0606ULL)) & 0xF0F0'F0F0'F0F0'F0F0ULL) != 0)
     {
-        result = static_cast<type>(string_to_integer<std::make_unsigned_t<type>>(__str));
+        return false;
     }
 
+    __chunk = (__chunk * 10 + (__chunk >> 8)) & 0x00FF'00FF'00FF'00FFULL;
+    __chunk = (__chunk * 100 + (__chunk >> 16)) & 0x0000'FFFF'0000'FFFFULL;
+    __chunk = (__chunk * 10000 + (__chunk >> 32)) & 0x0000'0000'FFFF'FFFFULL;
 
-    return static_cast<result_type>(negative ? -result : result);
+    __result = static_cast<std::uint32_t>(__chunk);
+    return true;
 }
 
-_KWARGS_Test_(string_to_integer<std::int32_t>("  "), 0);                      _KWARGS_Test_(string_to_integer<std::int32_t>("  -"), 0);
-_KWARGS_Test_(string_to_integer<std::int32_t>("0"), 0);                       _KWARGS_Test_(string_to_integer<std::int32_t>("-0"), -0);
-_KWARGS_Test_(string_to_integer<std::int32_t>("123"), 123);                   _KWARGS_Test_(string_to_integer<std::int32_t>("-123"), -123);
-_KWARGS_Test_(string_to_integer<std::int32_t>("100"), 100);                   _KWARGS_Test_(string_to_integer<std::int32_t>("-100"), -100);
-_KWARGS_Test_(string_to_integer<std::int32_t>("0b101"), 0b101);               _KWARGS_Test_(string_to_integer<std::int32_t>("-0b101"), -0b101);
-_KWARGS_Test_(string_to_integer<std::int32_t>("0b1011001110"), 0b1011001110); _KWARGS_Test_(string_to_integer<std::int32_t>("-0b1011001110"), -0b1011001110);
-_KWARGS_Test_(string_to_integer<std::int32_t>("0o1234567"), 01234567);        _KWARGS_Test_(string_to_integer<std::int32_t>("-0o1234567"), -01234567);
-_KWARGS_Test_(string_to_integer<std::int64_t>("0xfFabceEd"), 0xfFabceEdLL);   _KWARGS_Test_(string_to_integer<std::int64_t>("-0xfFabceEd"), -0xfFabceEdLL);
-_KWARGS_Test_(string_to_integer<std::int64_t>("  +0x5201314A"), 0x5201314A);  _KWARGS_Test_(string_to_integer<std::int64_t>(" -0x5201314A"), -0x5201314A);
-
-_KWARGS_Test_(string_to_integer<std::int32_t>("max"), std::numeric_limits<std::int32_t>::max());
-_KWARGS_Test_(string_to_integer<std::int32_t>("-max"), -std::numeric_limits<std::int32_t>::max());
-_KWARGS_Test_(string_to_integer<std::int32_t>("min"), std::numeric_limits<std::int32_t>::min());
-_KWARGS_Test_(string_to_integer<std::uint64_t>("max"), std::numeric_limits<std::uint64_t>::max());
-_KWARGS_Test_(string_to_integer<std::uint64_t>("min"), std::numeric_limits<std::uint64_t>::min());
-
+_KWARGS_Test_([]() constexpr noexcept -> bool { std::uint32_t r = 0; return swar_parse_4_digits(0x3433'3231U, r) && r == 1234; }());
+_KWARGS_Test_([]() constexpr noexcept -> bool { std::uint32_t r = 0; return swar_parse_8_digits(0x3837'3635'3433'3231ULL, r) && r == 12345678; }());
+_KWARGS_Test_([]() constexpr noexcept -> bool { std::uint32_t r = 0; return swar_parse_8_digits(0x3837'3635'2E33'3231ULL, r); }(), false);
+_KWARGS_Test_([]() constexpr noexcept -> bool { std::uint32_t r = 0; return swar_parse_4_digits(0x3433'3A31U, r); }(), false);
 
+/**
+ * @brief Consumes as many leading decimal digits of [__first, __last) as possible in blocks
+ *        of 16 (SSSE3), 8 and 4 (SWAR) and accumulates them into __result with the same
+ *        wrap-around semantics as `result = result * 10 + digit`.
+ * 
+ * @note  Runtime only, fewer than 4 trailing digits are left to the caller.
+ * 
+ * @return The first character that was not consumed.
+ */
 template<typename _Tp>
-[[nodiscard]] constexpr auto string_to_floating_point(std::string_view __str)  noexcept
-        -> std::enable_if_t<std::is_floating_point_v<std::remove_reference_t<_Tp>>, std::remove_reference_t<_Tp>>
+inline const char* parse_decimal_digits_fast(const char* __first, const char* __last, _Tp& __result) noexcept
 {
-    using result_type = remove_reference_cv_t<_Tp>;
+    static_assert(std::is_unsigned_v<_Tp>);
 
-    constexpr auto zero = static_cast<result_type>(0);
-    constexpr auto one  = static_cast<result_type>(1);
-    constexpr auto ten  = static_cast<result_type>(10);
+    using wide_type = std::conditional_t<(sizeof(_Tp) < sizeof(std::uint64_t)), std::uint64_t, _Tp>;
 
+    wide_type result = __result;
 
-    if (string_view_trimmed(__str), __str.empty())
+#if _KWARGS_LITTLE_ENDIAN
+
+#if defined(_KWARGS_HAS_SSSE3)
+    while (__last - __first >= 16)
     {
-        return zero;
-    }
+        const __m128i chunk  = _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(__first)), _mm_set1_epi8('0'));
+        const __m128i is_bad = _mm_or_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8(9)), _mm_cmplt_epi8(chunk, _mm_setzero_si128()));
 
+        if (_mm_movemask_epi8(is_bad) != 0)
+        {
+            break;
+        }
 
-    bool negative = false;
+        const __m128i pairs  = _mm_maddubs_epi16(chunk, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1));
+        const __m128i quads  = _mm_madd_epi16(pairs, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+        const __m128i octets = _mm_madd_epi16(_mm_packs_epi32(quads, quads), _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1));
 
-    auto $ = [&negative](result_type __value) constexpr noexcept -> result_type { return negative ? -__value : __value; };
+        const auto high = static_cast<std::uint32_t>(_mm_cvtsi128_si32(octets));
+        const auto low  = static_cast<std::uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(octets, 4)));
 
-    if (__str.front() == '-')
-    {
-        negative = true;
-        __str.remove_prefix(1);
-    }
-    else if (__str.front() == '+')
-    {
-        __str.remove_prefix(1);
+        result = result * static_cast<wide_type>(10000'0000'0000'0000ULL) + static_cast<wide_type>(high * 1'0000'0000ULL + low);
+        __first += 16;
     }
+#endif  // _KWARGS_HAS_SSSE3
 
-
-    if (string_view_left_trimmed(__str), __str.empty())
+    for (std::uint32_t value = 0; __last - __first >= 8; __first += 8)
     {
-        return zero;
-    }
+        std::uint64_t chunk;
+        std::memcpy(&chunk, __first, sizeof(chunk));
 
+        if (swar_parse_8_digits(chunk, value) == false)
+        {
+            break;
+        }
 
-    if (is_same_string_ignore_case(__str, "inf") || is_same_string_ignore_case(__str, "infinity"))
-    {
-        return $(std::numeric_limits<result_type>::infinity());
-    }
-    else if (is_same_string_ignore_case(__str, "nan"))
-    {
-        return $(std::numeric_limits<result_type>::quiet_NaN());
-    }
-    else if (is_same_string_ignore_case(__str, "max"))
-    {
-        return $(std::numeric_limits<result_type>::max());
-    }
-    else if (is_same_string_ignore_case(__str, "min"))
-    {
-        return $(std::numeric_limits<result_type>::min());
-    }
-    else if (is_same_string_ignore_case(__str, "pi"))
-    {
-#if defined(_KWARGS_HAS_FLOAT128)
-        return $(static_cast<result_type>(3.141592653589793238462643383279502884L));
-#else
-        return $(static_cast<result_type>(3.141592653589793));
-#endif
+        result = result * static_cast<wide_type>(1'0000'0000ULL) + static_cast<wide_type>(value);
     }
-    else if (is_same_string_ignore_case(__str, "e"))
+
+    if (std::uint32_t value = 0, chunk = 0; __last - __first >= 4)
     {
-#if defined(_KWARGS_HAS_FLOAT128)
-        return $(static_cast<result_type>(2.718281828459045235360287471352662498L));
-#else
-        return $(static_cast<result_type>(2.718281828459045));
-#endif
+        std::memcpy(&chunk, __first, sizeof(chunk));
+
+        if (swar_parse_4_digits(chunk, value))
+        {
+            result = result * static_cast<wide_type>(10000) + static_cast<wide_type>(value);
+            __first += 4;
+        }
     }
 
+#endif  // _KWARGS_LITTLE_ENDIAN
 
-    result_type result = zero;
+    __result = static_cast<_Tp>(result);
+    return __first;
+}
 
-    std::size_t i = 0;
 
-    for (; i < __str.size() && __str[i] >= '0' && __str[i] <= '9'; ++i)
+template<typename _Tp, std::enable_if_t<is_unsigned_v<_Tp>, int> = 0>
+[[nodiscard]] constexpr auto string_to_integer(std::string_view __str) noexcept
+{
+    using type = std::conditional_t<
+            std::is_same_v<remove_reference_cv_t<_Tp>, bool>,
+            std::uint8_t,
+            enum_underlying_type_t<remove_reference_cv_t<_Tp>>>;
+    
+    using result_type = std::remove_reference_t<_Tp>;
+
+    type result = static_cast<type>(0);
+
+    string_view_trimmed(__str);
+
+    if (__str.empty())
     {
-        result = result * ten + static_cast<result_type>(__str[i] - '0');
+        return result_type{};
     }
 
-
-    if (i < __str.size() && __str[i] == '.' && (++i, true))
+    if (__str.front() == '+')
     {
-        result_type fractional_part = zero;
-        
-        result_type power = one;
+        __str.remove_prefix(1);
+        string_view_left_trimmed(__str);
 
-        for (; i < __str.size() && __str[i] >= '0' && __str[i] <= '9'; ++i, power *= 10)
+        if (__str.empty())
         {
-            fractional_part = fractional_part * ten + static_cast<result_type>(__str[i] - '0');
+            return result_type{};
         }
-        
-        result += fractional_part / power;
     }
 
 
-    if (i < __str.size() && is_same_char_ignore_case(__str[i], 'e') && ++i < __str.size())
+    // Keywords never start with a digit.
+    if (static_cast<unsigned char>(__str.front() - '0') >= 10)
     {
-        result *= power10<result_type>(string_to_integer<std::int64_t>(__str.substr(i)));
+        if (is_same_string_ignore_case(__str, "max"))
+        {
+            return static_cast<result_type>(std::numeric_limits<type>::max());
+        }
+        else if (is_same_string_ignore_case(__str, "min"))
+        {
+            return static_cast<result_type>(std::numeric_limits<type>::min());
+        }
+        else if (is_same_string_ignore_case(__str, "true"))
+        {
+            return static_cast<result_type>(true);
+        }
+        else if (is_same_string_ignore_case(__str, "false"))
+        {
+            return static_cast<result_type>(false);
+        }
     }
 
-    return $(result);
-}
 
-_KWARGS_Test_(string_to_floating_point<float>("123.123"), 123.123f);   _KWARGS_Test_(string_to_floating_point<float>("-123.123"), -123.123f);
-_KWARGS_Test_(string_to_floating_point<float>("0.520"), 0.520f);       _KWARGS_Test_(string_to_floating_point<float>("-0.1314"), -0.1314f);
-_KWARGS_Test_(string_to_floating_point<double>("0.520"), 0.520);       _KWARGS_Test_(string_to_floating_point<double>("-0.1314"), -0.1314);
-_KWARGS_Test_(string_to_floating_point<double>("0.520E4"), 0.520E4);   _KWARGS_Test_(string_to_floating_point<double>("-0.1314e10"), -0.1314e10);
-_KWARGS_Test_(string_to_floating_point<double>("0.520E-5"), 0.520E-5); _KWARGS_Test_(string_to_floating_point<double>("-0.1314e-10"), -0.1314e-10);
-_KWARGS_Test_(string_to_floating_point<double>("1e308"), 1e308);       _KWARGS_Test_(string_to_floating_point<double>("-1e308"), -1e308);
-_KWARGS_Test_(string_to_floating_point<double>("1e-308"), 1e-308);     _KWARGS_Test_(string_to_floating_point<double>("-1e-308"), -1e-308);
+    if (__str.size() >= 2 && __str[0] == '0')
+    {
+#define _KWARGS_Convert_to_decimal_from(__radix, __start)                                           \
+            do                                                                                      \
+            {                                                                                       \
+                for (auto it = __start, last = __str.end(); it != last; ++it)                       \
+                {                                                                                   \
+                    if (is_radix_character(*it, __radix) == false)                                  \
+                    {                                                                               \
+                        return static_cast<result_type>(result);                                    \
+                    }                                                                               \
+                    result = type(result * type(__radix) + type(radix_character_to_integer(*it)));  \
+                }                                                                                   \
+                return static_cast<result_type>(result);                                            \
+            } while (false)
 
-_KWARGS_Test_(string_to_floating_point<long double>("134567890.0987654321"), 134567890.0987654321L);
-_KWARGS_Test_(string_to_floating_point<long double>("-134567890.0987654321"), -134567890.0987654321L);
 
-#if defined(_KWARGS_HAS_FLOAT128)
-_KWARGS_Test_(string_to_floating_point<long double>("1e+4932"), 1e+4932L);
-_KWARGS_Test_(string_to_floating_point<long double>("1e-4932"), 1e-4932L);
-#endif
+        switch (__str[1])
+        {
+            // Binary
+            case 'b': case 'B':
+                _KWARGS_Convert_to_decimal_from(2, __str.begin() + 2);
+                
+            // Octal
+            case 'o': case 'O':
+                _KWARGS_Convert_to_decimal_from(8, __str.begin() + 2);
 
+            // Hexadecimal
+            case 'x': case 'X':
+            case 'h': case 'H':
+                _KWARGS_Convert_to_decimal_from(16, __str.begin() + 2);
+        }
 
-template<typename _Tp>
-[[nodiscard]] constexpr auto string_to_number(std::string_view __str) noexcept
-        -> std::enable_if_t<std::disjunction_v<is_integral_or_enum<std::remove_reference_t<_Tp>>, std::is_floating_point<std::remove_reference_t<_Tp>>>, std::remove_reference_t<_Tp>>
-{
-    using result_type = std::remove_reference_t<_Tp>;
+    }
 
-    if constexpr (std::is_integral_v<result_type>)
+    // Decimal
+    if (is_constant_evaluated())
     {
-        return string_to_integer<result_type>(__str);
+        _KWARGS_Convert_to_decimal_from(10, __str.begin());
     }
     else
     {
-        return string_to_floating_point<result_type>(__str);
-    }
-}
-
+        const char* const last = __str.data() + __str.size();
 
-template<typename _Res, typename _Tp>
-[[nodiscard]] constexpr auto integer_to_string(_Tp __n, int __radix = 10) noexcept
-        -> std::enable_if_t<is_std_string_v<_Res> && is_integral_or_enum_v<_Tp>, std::remove_reference_t<_Res>>
-{
-    clamp<int>(__radix, 2, 36);
+        for (const char* it = parse_decimal_digits_fast(__str.data(), last, result);
+             it != last && static_cast<unsigned char>(*it - '0') < 10; ++it)
+        {
+            result = type(result * type(10) + type(*it - '0'));
+        }
 
-    constexpr std::size_t buffer_size = 20;
+        return static_cast<result_type>(result);
+    }
 
-    char _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(buffer[buffer_size]);
+#undef _KWARGS_Convert_to_decimal_from
+}
 
-    std::size_t cpos = buffer_size;
+template<typename _Tp, std::enable_if_t<is_signed_v<_Tp>, int> = 0>
+[[nodiscard]] constexpr auto string_to_integer(std::string_view __str) noexcept
+{
+    using type = enum_underlying_type_t<remove_reference_cv_t<_Tp>>;
+    using result_type = std::remove_reference_t<_Tp>;
 
-    bool sign = (detail::is_signed_v<_Tp> && __n < 0);
+    string_view_trimmed(__str);
 
-    while (__n)
+    if (__str.empty())
     {
-        buffer[--cpos] = integer_to_radix_character(static_cast<int>(abs(__n % __radix)));
-        __n /= static_cast<_Tp>(__radix);
+        return result_type{};
     }
 
-    if (sign)
+    bool negative = false;
+
+    if (__str.front() == '-')
     {
-        buffer[--cpos] = '-';
+        negative = true;
+        __str.remove_prefix(1);
     }
-    else if (cpos == buffer_size)
+    else if (__str.front() == '+')
     {
-        buffer[--cpos] = '0';
+        __str.remove_prefix(1);
     }
 
-    return std::remove_reference_t<_Res>(static_cast<std::decay_t<decltype(buffer)>>(buffer) + cpos, buffer_size - cpos);
-}
-
-template<typename _Res, typename _Tp>
-[[nodiscard]] constexpr auto floating_point_to_string(_Tp __n) noexcept
-        -> std::enable_if_t<is_std_string_v<_Res> && std::is_floating_point_v<_Tp>, std::remove_reference_t<_Res>>
-{
-    floating_point_layout<_Tp> value;
-    value.f = __n;
+    type _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(result);
 
-    if (value.is_nan())
+    if (__str.empty() == false && static_cast<unsigned char>(__str.front() - '0') < 10)
     {
-        return std::remove_reference_t<_Res>("NaN");
+        result = static_cast<type>(string_to_integer<std::make_unsigned_t<type>>(__str));
     }
-    else if (value.is_inf())
+    else if (is_same_string_ignore_case(__str, "max"))
     {
-        if (value.is_negative())
-        {
-            return std::remove_reference_t<_Res>("-inf");
-        }
-        else
-        {
-            return std::remove_reference_t<_Res>("inf");
-        }
+        result = std::numeric_limits<type>::max();
     }
-
-    constexpr std::size_t buffer_size = conditional_value_v<sizeof(_Tp) == sizeof(float), 50, conditional_value_v<sizeof(_Tp) == sizeof(double), 400, 5000>>;
-
-    char _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(buffer[buffer_size]);
-
-    std::size_t cpos = 0;
-
-    if (value.is_negative())
+    else if (is_same_string_ignore_case(__str, "min"))
     {
-        buffer[cpos++] = '-';
-        value.s.sign = false;
-    }
-
-    int exponent = value.exponent();
-
-    std::uint64_t significand = value.significand();
-
-    if (exponent < 0)
-    {
-        buffer[cpos++] = '0';
+        result = std::numeric_limits<type>::min();
     }
     else
     {
-        std::array<std::uint8_t, value.bias() + 1> bits { };
+        result = static_cast<type>(string_to_integer<std::make_unsigned_t<type>>(__str));
+    }
 
-        for (std::size_t i = 0; significand; ++i, significand >>= 1)
-        {
-            bits[i] = significand & 1;
-        }
 
-        int shift = value.significand_bit() - exponent;
+    return static_cast<result_type>(negative ? -result : result);
+}
 
-        value.s.exponent = static_cast<decltype(value.s.exponent)>(value.bias());
+_KWARGS_Test_(string_to_integer<std::int32_t>("  "), 0);                      _KWARGS_Test_(string_to_integer<std::int32_t>("  -"), 0);
+_KWARGS_Test_(string_to_integer<std::int32_t>("0"), 0);                       _KWARGS_Test_(string_to_integer<std::int32_t>("-0"), -0);
+_KWARGS_Test_(string_to_integer<std::int32_t>("123"), 123);                   _KWARGS_Test_(string_to_integer<std::int32_t>("-123"), -123);
+_KWARGS_Test_(string_to_integer<std::int32_t>("100"), 100);                   _KWARGS_Test_(string_to_integer<std::int32_t>("-100"), -100);
+_KWARGS_Test_(string_to_integer<std::int32_t>("0b101"), 0b101);               _KWARGS_Test_(string_to_integer<std::int32_t>("-0b101"), -0b101);
+_KWARGS_Test_(string_to_integer<std::int32_t>("0b1011001110"), 0b1011001110); _KWARGS_Test_(string_to_integer<std::int32_t>("-0b1011001110"), -0b1011001110);
+_KWARGS_Test_(string_to_integer<std::int32_t>("0o1234567"), 01234567);        _KWARGS_Test_(string_to_integer<std::int32_t>("-0o1234567"), -01234567);
+_KWARGS_Test_(string_to_integer<std::int64_t>("0xfFabceEd"), 0xfFabceEdLL);   _KWARGS_Test_(string_to_integer<std::int64_t>("-0xfFabceEd"), -0xfFabceEdLL);
+_KWARGS_Test_(string_to_integer<std::int64_t>("  +0x5201314A"), 0x5201314A);  _KWARGS_Test_(string_to_integer<std::int64_t>(" -0x5201314A"), -0x5201314A);
 
-        if (shift > 0)
-        {
-            value.s.significand &= (1ULL << shift) - 1;
-            value.s.significand <<= exponent;
-            
-            for (std::size_t i = 0; i < bits.size() - shift; ++i)
-            {
-                bits[i] = bits[i + shift];
-            }
+_KWARGS_Test_(string_to_integer<std::int32_t>("max"), std::numeric_limits<std::int32_t>::max());
+_KWARGS_Test_(string_to_integer<std::int32_t>("-max"), -std::numeric_limits<std::int32_t>::max());
+_KWARGS_Test_(string_to_integer<std::int32_t>("min"), std::numeric_limits<std::int32_t>::min());
+_KWARGS_Test_(string_to_integer<std::uint64_t>("max"), std::numeric_limits<std::uint64_t>::max());
+_KWARGS_Test_(string_to_integer<std::uint64_t>("min"), std::numeric_limits<std::uint64_t>::min());
 
-            for (std::size_t i = bits.size() - shift; i < bits.size(); ++i)
-            {
-                bits[i] = 0;
-            }
-        }
-        else if (shift < 0)
-        {
-            value.s.significand = 0;
 
-            shift = static_cast<int>(abs(shift));
+/**
+ * @brief 128-bit truncated powers of five from 5^-342 to 5^308, used by compute_float.
+ * 
+ * Each power is normalized so that its most significant bit is set, and stored as {high, low}.
+ */
+inline constexpr std::uint64_t power_of_five_128[] = {
+    0xEEF453D6923BD65AULL, 0x113FAA2906A13B3FULL, 0x9558B4661B6565F8ULL, 0x4AC7CA59A424C507ULL,
+    0xBAAEE17FA23EBF76ULL, 0x5D79BCF00D2DF649ULL, 0xE95A99DF8ACE6F53ULL, 0xF4D82C2C107973DCULL,
+    0x91D8A02BB6C10594ULL, 0x79071B9B8A4BE869ULL, 0xB64EC836A47146F9ULL, 0x9748E2826CDEE284ULL,
+    0xE3E27A444D8D98B7ULL, 0xFD1B1B2308169B25ULL, 0x8E6D8C6AB0787F72ULL, 0xFE30F0F5E50E20F7ULL,
+    0xB208EF855C969F4FULL, 0xBDBD2D335E51A935ULL, 0xDE8B2B66B3BC4723ULL, 0xAD2C788035E61382ULL,
+    0x8B16FB203055AC76ULL, 0x4C3BCB5021AFCC31ULL, 0xADDCB9E83C6B1793ULL, 0xDF4ABE242A1BBF3DULL,
+    0xD953E8624B85DD78ULL, 0xD71D6DAD34A2AF0DULL, 0x87D4713D6F33AA6BULL, 0x8672648C40E5AD68ULL,
+    0xA9C98D8CCB009506ULL, 0x680EFDAF511F18C2ULL, 0xD43BF0EFFDC0BA48ULL, 0x0212BD1B2566DEF2ULL,
+    0x84A57695FE98746DULL, 0x014BB630F7604B57ULL, 0xA5CED43B7E3E9188ULL, 0x419EA3BD35385E2DULL,
+    0xCF42894A5DCE35EAULL, 0x52064CAC828675B9ULL, 0x818995CE7AA0E1B2ULL, 0x7343EFEBD1940993ULL,
+    0xA1EBFB4219491A1FULL, 0x1014EBE6C5F90BF8ULL, 0xCA66FA129F9B60A6ULL, 0xD41A26E077774EF6ULL,
+    0xFD00B897478238D0ULL, 0x8920B098955522B4ULL, 0x9E20735E8CB16382ULL, 0x55B46E5F5D5535B0ULL,
+    0xC5A890362FDDBC62ULL, 0xEB2189F734AA831DULL, 0xF712B443BBD52B7BULL, 0xA5E9EC7501D523E4ULL,
+    0x9A6BB0AA55653B2DULL, 0x47B233C92125366EULL, 0xC1069CD4EABE89F8ULL, 0x999EC0BB696E840AULL,
+    0xF148440A256E2C76ULL, 0xC00670EA43CA250DULL, 0x96CD2A865764DBCAULL, 0x380406926A5E5728ULL,
+    0xBC807527ED3E12BCULL, 0xC605083704F5ECF2ULL, 0xEBA09271E88D976BULL, 0xF7864A44C633682EULL,
+    0x93445B8731587EA3ULL, 0x7AB3EE6AFBE0211DULL, 0xB8157268FDAE9E4CULL, 0x5960EA05BAD82964ULL,
+    0xE61ACF033D1A45DFULL, 0x6FB92487298E33BDULL, 0x8FD0C16206306BABULL, 0xA5D3B6D479F8E056ULL,
+    0xB3C4F1BA87BC8696ULL, 0x8F48A4899877186CULL, 0xE0B62E2929ABA83CULL, 0x331ACDABFE94DE87ULL,
+    0x8C71DCD9BA0B4925ULL, 0x9FF0C08B7F1D0B14ULL, 0xAF8E5410288E1B6FULL, 0x07ECF0AE5EE44DD9ULL,
+    0xDB71E91432B1A24AULL, 0xC9E82CD9F69D6150ULL, 0x892731AC9FAF056EULL, 0xBE311C083A225CD2ULL,
+    0xAB70FE17C79AC6CAULL, 0x6DBD630A48AAF406ULL, 0xD64D3D9DB981787DULL, 0x092CBBCCDAD5B108ULL,
+    0x85F0468293F0EB4EULL, 0x25BBF56008C58EA5ULL, 0xA76C582338ED2621ULL, 0xAF2AF2B80AF6F24EULL,
+    0xD1476E2C07286FAAULL, 0x1AF5AF660DB4AEE1ULL, 0x82CCA4DB847945CAULL, 0x50D98D9FC890ED4DULL,
+    0xA37FCE126597973CULL, 0xE50FF107BAB528A0ULL, 0xCC5FC196FEFD7D0CULL, 0x1E53ED49A96272C8ULL,
+    0xFF77B1FCBEBCDC4FULL, 0x25E8E89C13BB0F7AULL, 0x9FAACF3DF73609B1ULL, 0x77B191618C54E9ACULL,
+    0xC795830D75038C1DULL, 0xD59DF5B9EF6A2417ULL, 0xF97AE3D0D2446F25ULL, 0x4B0573286B44AD1DULL,
+    0x9BECCE62836AC577ULL, 0x4EE367F9430AEC32ULL, 0xC2E801FB244576D5ULL, 0x229C41F793CDA73FULL,
+    0xF3A20279ED56D48AULL, 0x6B43527578C1110FULL, 0x9845418C345644D6ULL, 0x830A13896B78AAA9ULL,
+    0xBE5691EF416BD60CULL, 0x23CC986BC656D553ULL, 0xEDEC366B11C6CB8FULL, 0x2CBFBE86B7EC8AA8ULL,
+    0x94B3A202EB1C3F39ULL, 0x7BF7D71432F3D6A9ULL, 0xB9E08A83A5E34F07ULL, 0xDAF5CCD93FB0CC53ULL,
+    0xE858AD248F5C22C9ULL, 0xD1B3400F8F9CFF68ULL, 0x91376C36D99995BEULL, 0x23100809B9C21FA1ULL,
+    0xB58547448FFFFB2DULL, 0xABD40A0C2832A78AULL, 0xE2E69915B3FFF9F9ULL, 0x16C90C8F323F516CULL,
+    0x8DD01FAD907FFC3BULL, 0xAE3DA7D97F6792E3ULL, 0xB1442798F49FFB4AULL, 0x99CD11CFDF41779CULL,
+    0xDD95317F31C7FA1DULL, 0x40405643D711D583ULL, 0x8A7D3EEF7F1CFC52ULL, 0x482835EA666B2572ULL,
+    0xAD1C8EAB5EE43B66ULL, 0xDA3243650005EECFULL, 0xD863B256369D4A40ULL, 0x90BED43E40076A82ULL,
+    0x873E4F75E2224E68ULL, 0x5A7744A6E804A291ULL, 0xA90DE3535AAAE202ULL, 0x711515D0A205CB36ULL,
+    0xD3515C2831559A83ULL, 0x0D5A5B44CA873E03ULL, 0x8412D9991ED58091ULL, 0xE858790AFE9486C2ULL,
+    0xA5178FFF668AE0B6ULL, 0x626E974DBE39A872ULL, 0xCE5D73FF402D98E3ULL, 0xFB0A3D212DC8128FULL,
+    0x80FA687F881C7F8EULL, 0x7CE66634BC9D0B99ULL, 0xA139029F6A239F72ULL, 0x1C1FFFC1EBC44E80ULL,
+    0xC987434744AC874EULL, 0xA327FFB266B56220ULL, 0xFBE9141915D7A922ULL, 0x4BF1FF9F0062BAA8ULL,
+    0x9D71AC8FADA6C9B5ULL, 0x6F773FC3603DB4A9ULL, 0xC4CE17B399107C22ULL, 0xCB550FB4384D21D3ULL,
+    0xF6019DA07F549B2BULL, 0x7E2A53A146606A48ULL, 0x99C102844F94E0FBULL, 0x2EDA7444CBFC426DULL,
+    0xC0314325637A1939ULL, 0xFA911155FEFB5308ULL, 0xF03D93EEBC589F88ULL, 0x793555AB7EBA27CAULL,
+    0x96267C7535B763B5ULL, 0x4BC1558B2F3458DEULL, 0xBBB01B9283253CA2ULL, 0x9EB1AAEDFB016F16ULL,
+    0xEA9C227723EE8BCBULL, 0x465E15A979C1CADCULL, 0x92A1958A7675175FULL, 0x0BFACD89EC191EC9ULL,
+    0xB749FAED14125D36ULL, 0xCEF980EC671F667BULL, 0xE51C79A85916F484ULL, 0x82B7E12780E7401AULL,
+    0x8F31CC0937AE58D2ULL, 0xD1B2ECB8B0908810ULL, 0xB2FE3F0B8599EF07ULL, 0x861FA7E6DCB4AA15ULL,
+    0xDFBDCECE67006AC9ULL, 0x67A791E093E1D49AULL, 0x8BD6A141006042BDULL, 0xE0C8BB2C5C6D24E0ULL,
+    0xAECC49914078536DULL, 0x58FAE9F773886E18ULL, 0xDA7F5BF590966848ULL, 0xAF39A475506A899EULL,
+    0x888F99797A5E012DULL, 0x6D8406C952429603ULL, 0xAAB37FD7D8F58178ULL, 0xC8E5087BA6D33B83ULL,
+    0xD5605FCDCF32E1D6ULL, 0xFB1E4A9A90880A64ULL, 0x855C3BE0A17FCD26ULL, 0x5CF2EEA09A55067FULL,
+    0xA6B34AD8C9DFC06FULL, 0xF42FAA48C0EA481EULL, 0xD0601D8EFC57B08BULL, 0xF13B94DAF124DA26ULL,
+    0x823C12795DB6CE57ULL, 0x76C53D08D6B70858ULL, 0xA2CB1717B52481EDULL, 0x54768C4B0C64CA6EULL,
+    0xCB7DDCDDA26DA268ULL, 0xA9942F5DCF7DFD09ULL, 0xFE5D54150B090B02ULL, 0xD3F93B35435D7C4CULL,
+    0x9EFA548D26E5A6E1ULL, 0xC47BC5014A1A6DAFULL, 0xC6B8E9B0709F109AULL, 0x359AB6419CA1091BULL,
+    0xF867241C8CC6D4C0ULL, 0xC30163D203C94B62ULL, 0x9B407691D7FC44F8ULL, 0x79E0DE63425DCF1DULL,
+    0xC21094364DFB5636ULL, 0x985915FC12F542E4ULL, 0xF294B943E17A2BC4ULL, 0x3E6F5B7B17B2939DULL,
+    0x979CF3CA6CEC5B5AULL, 0xA705992CEECF9C42ULL, 0xBD8430BD08277231ULL, 0x50C6FF782A838353ULL,
+    0xECE53CEC4A314EBDULL, 0xA4F8BF5635246428ULL, 0x940F4613AE5ED136ULL, 0x871B7795E136BE99ULL,
+    0xB913179899F68584ULL, 0x28E2557B59846E3FULL, 0xE757DD7EC07426E5ULL, 0x331AEADA2FE589CFULL,
+    0x9096EA6F3848984FULL, 0x3FF0D2C85DEF7621ULL, 0xB4BCA50B065ABE63ULL, 0x0FED077A756B53A9ULL,
+    0xE1EBCE4DC7F16DFBULL, 0xD3E8495912C62894ULL, 0x8D3360F09CF6E4BDULL, 0x64712DD7ABBBD95CULL,
+    0xB080392CC4349DECULL, 0xBD8D794D96AACFB3ULL, 0xDCA04777F541C567ULL, 0xECF0D7A0FC5583A0ULL,
+    0x89E42CAAF9491B60ULL, 0xF41686C49DB57244ULL, 0xAC5D37D5B79B6239ULL, 0x311C2875C522CED5ULL,
+    0xD77485CB25823AC7ULL, 0x7D633293366B828BULL, 0x86A8D39EF77164BCULL, 0xAE5DFF9C02033197ULL,
+    0xA8530886B54DBDEBULL, 0xD9F57F830283FDFCULL, 0xD267CAA862A12D66ULL, 0xD072DF63C324FD7BULL,
+    0x8380DEA93DA4BC60ULL, 0x4247CB9E59F71E6DULL, 0xA46116538D0DEB78ULL, 0x52D9BE85F074E608ULL,
+    0xCD795BE870516656ULL, 0x67902E276C921F8BULL, 0x806BD9714632DFF6ULL, 0x00BA1CD8A3DB53B6ULL,
+    0xA086CFCD97BF97F3ULL, 0x80E8A40ECCD228A4ULL, 0xC8A883C0FDAF7DF0ULL, 0x6122CD128006B2CDULL,
+    0xFAD2A4B13D1B5D6CULL, 0x796B805720085F81ULL, 0x9CC3A6EEC6311A63ULL, 0xCBE3303674053BB0ULL,
+    0xC3F490AA77BD60FCULL, 0xBEDBFC4411068A9CULL, 0xF4F1B4D515ACB93BULL, 0xEE92FB5515482D44ULL,
+    0x991711052D8BF3C5ULL, 0x751BDD152D4D1C4AULL, 0xBF5CD54678EEF0B6ULL, 0xD262D45A78A0635DULL,
+    0xEF340A98172AACE4ULL, 0x86FB897116C87C34ULL, 0x9580869F0E7AAC0EULL, 0xD45D35E6AE3D4DA0ULL,
+    0xBAE0A846D2195712ULL, 0x8974836059CCA109ULL, 0xE998D258869FACD7ULL, 0x2BD1A438703FC94BULL,
+    0x91FF83775423CC06ULL, 0x7B6306A34627DDCFULL, 0xB67F6455292CBF08ULL, 0x1A3BC84C17B1D542ULL,
+    0xE41F3D6A7377EECAULL, 0x20CABA5F1D9E4A93ULL, 0x8E938662882AF53EULL, 0x547EB47B7282EE9CULL,
+    0xB23867FB2A35B28DULL, 0xE99E619A4F23AA43ULL, 0xDEC681F9F4C31F31ULL, 0x6405FA00E2EC94D4ULL,
+    0x8B3C113C38F9F37EULL, 0xDE83BC408DD3DD04ULL, 0xAE0B158B4738705EULL, 0x9624AB50B148D445ULL,
+    0xD98DDAEE19068C76ULL, 0x3BADD624DD9B0957ULL, 0x87F8A8D4CFA417C9ULL, 0xE54CA5D70A80E5D6ULL,
+    0xA9F6D30A038D1DBCULL, 0x5E9FCF4CCD211F4CULL, 0xD47487CC8470652BULL, 0x7647C3200069671FULL,
+    0x84C8D4DFD2C63F3BULL, 0x29ECD9F40041E073ULL, 0xA5FB0A17C777CF09ULL, 0xF468107100525890ULL,
+    0xCF79CC9DB955C2CCULL, 0x7182148D4066EEB4ULL, 0x81AC1FE293D599BFULL, 0xC6F14CD848405530ULL,
+    0xA21727DB38CB002FULL, 0xB8ADA00E5A506A7CULL, 0xCA9CF1D206FDC03BULL, 0xA6D90811F0E4851CULL,
+    0xFD442E4688BD304AULL, 0x908F4A166D1DA663ULL, 0x9E4A9CEC15763E2EULL, 0x9A598E4E043287FEULL,
+    0xC5DD44271AD3CDBAULL, 0x40EFF1E1853F29FDULL, 0xF7549530E188C128ULL, 0xD12BEE59E68EF47CULL,
+    0x9A94DD3E8CF578B9ULL, 0x82BB74F8301958CEULL, 0xC13A148E3032D6E7ULL, 0xE36A52363C1FAF01ULL,
+    0xF18899B1BC3F8CA1ULL, 0xDC44E6C3CB279AC1ULL, 0x96F5600F15A7B7E5ULL, 0x29AB103A5EF8C0B9ULL,
+    0xBCB2B812DB11A5DEULL, 0x7415D448F6B6F0E7ULL, 0xEBDF661791D60F56ULL, 0x111B495B3464AD21ULL,
+    0x936B9FCEBB25C995ULL, 0xCAB10DD900BEEC34ULL, 0xB84687C269EF3BFBULL, 0x3D5D514F40EEA742ULL,
+    0xE65829B3046B0AFAULL, 0x0CB4A5A3112A5112ULL, 0x8FF71A0FE2C2E6DCULL, 0x47F0E785EABA72ABULL,
+    0xB3F4E093DB73A093ULL, 0x59ED216765690F56ULL, 0xE0F218B8D25088B8ULL, 0x306869C13EC3532CULL,
+    0x8C974F7383725573ULL, 0x1E414218C73A13FBULL, 0xAFBD2350644EEACFULL, 0xE5D1929EF90898FAULL,
+    0xDBAC6C247D62A583ULL, 0xDF45F746B74ABF39ULL, 0x894BC396CE5DA772ULL, 0x6B8BBA8C328EB783ULL,
+    0xAB9EB47C81F5114FULL, 0x066EA92F3F326564ULL, 0xD686619BA27255A2ULL, 0xC80A537B0EFEFEBDULL,
+    0x8613FD0145877585ULL, 0xBD06742CE95F5F36ULL, 0xA798FC4196E952E7ULL, 0x2C48113823B73704ULL,
+    0xD17F3B51FCA3A7A0ULL, 0xF75A15862CA504C5ULL, 0x82EF85133DE648C4ULL, 0x9A984D73DBE722FBULL,
+    0xA3AB66580D5FDAF5ULL, 0xC13E60D0D2E0EBBAULL, 0xCC963FEE10B7D1B3ULL, 0x318DF905079926A8ULL,
+    0xFFBBCFE994E5C61FULL, 0xFDF17746497F7052ULL, 0x9FD561F1FD0F9BD3ULL, 0xFEB6EA8BEDEFA633ULL,
+    0xC7CABA6E7C5382C8ULL, 0xFE64A52EE96B8FC0ULL, 0xF9BD690A1B68637BULL, 0x3DFDCE7AA3C673B0ULL,
+    0x9C1661A651213E2DULL, 0x06BEA10CA65C084EULL, 0xC31BFA0FE5698DB8ULL, 0x486E494FCFF30A62ULL,
+    0xF3E2F893DEC3F126ULL, 0x5A89DBA3C3EFCCFAULL, 0x986DDB5C6B3A76B7ULL, 0xF89629465A75E01CULL,
+    0xBE89523386091465ULL, 0xF6BBB397F1135823ULL, 0xEE2BA6C0678B597FULL, 0x746AA07DED582E2CULL,
+    0x94DB483840B717EFULL, 0xA8C2A44EB4571CDCULL, 0xBA121A4650E4DDEBULL, 0x92F34D62616CE413ULL,
+    0xE896A0D7E51E1566ULL, 0x77B020BAF9C81D17ULL, 0x915E2486EF32CD60ULL, 0x0ACE1474DC1D122EULL,
+    0xB5B5ADA8AAFF80B8ULL, 0x0D819992132456BAULL, 0xE3231912D5BF60E6ULL, 0x10E1FFF697ED6C69ULL,
+    0x8DF5EFABC5979C8FULL, 0xCA8D3FFA1EF463C1ULL, 0xB1736B96B6FD83B3ULL, 0xBD308FF8A6B17CB2ULL,
+    0xDDD0467C64BCE4A0ULL, 0xAC7CB3F6D05DDBDEULL, 0x8AA22C0DBEF60EE4ULL, 0x6BCDF07A423AA96BULL,
+    0xAD4AB7112EB3929DULL, 0x86C16C98D2C953C6ULL, 0xD89D64D57A607744ULL, 0xE871C7BF077BA8B7ULL,
+    0x87625F056C7C4A8BULL, 0x11471CD764AD4972ULL, 0xA93AF6C6C79B5D2DULL, 0xD598E40D3DD89BCFULL,
+    0xD389B47879823479ULL, 0x4AFF1D108D4EC2C3ULL, 0x843610CB4BF160CBULL, 0xCEDF722A585139BAULL,
+    0xA54394FE1EEDB8FEULL, 0xC2974EB4EE658828ULL, 0xCE947A3DA6A9273EULL, 0x733D226229FEEA32ULL,
+    0x811CCC668829B887ULL, 0x0806357D5A3F525FULL, 0xA163FF802A3426A8ULL, 0xCA07C2DCB0CF26F7ULL,
+    0xC9BCFF6034C13052ULL, 0xFC89B393DD02F0B5ULL, 0xFC2C3F3841F17C67ULL, 0xBBAC2078D443ACE2ULL,
+    0x9D9BA7832936EDC0ULL, 0xD54B944B84AA4C0DULL, 0xC5029163F384A931ULL, 0x0A9E795E65D4DF11ULL,
+    0xF64335BCF065D37DULL, 0x4D4617B5FF4A16D5ULL, 0x99EA0196163FA42EULL, 0x504BCED1BF8E4E45ULL,
+    0xC06481FB9BCF8D39ULL, 0xE45EC2862F71E1D6ULL, 0xF07DA27A82C37088ULL, 0x5D767327BB4E5A4CULL,
+    0x964E858C91BA2655ULL, 0x3A6A07F8D510F86FULL, 0xBBE226EFB628AFEAULL, 0x890489F70A55368BULL,
+    0xEADAB0ABA3B2DBE5ULL, 0x2B45AC74CCEA842EULL, 0x92C8AE6B464FC96FULL, 0x3B0B8BC90012929DULL,
+    0xB77ADA0617E3BBCBULL, 0x09CE6EBB40173744ULL, 0xE55990879DDCAABDULL, 0xCC420A6A101D0515ULL,
+    0x8F57FA54C2A9EAB6ULL, 0x9FA946824A12232DULL, 0xB32DF8E9F3546564ULL, 0x47939822DC96ABF9ULL,
+    0xDFF9772470297EBDULL, 0x59787E2B93BC56F7ULL, 0x8BFBEA76C619EF36ULL, 0x57EB4EDB3C55B65AULL,
+    0xAEFAE51477A06B03ULL, 0xEDE622920B6B23F1ULL, 0xDAB99E59958885C4ULL, 0xE95FAB368E45ECEDULL,
+    0x88B402F7FD75539BULL, 0x11DBCB0218EBB414ULL, 0xAAE103B5FCD2A881ULL, 0xD652BDC29F26A119ULL,
+    0xD59944A37C0752A2ULL, 0x4BE76D3346F0495FULL, 0x857FCAE62D8493A5ULL, 0x6F70A4400C562DDBULL,
+    0xA6DFBD9FB8E5B88EULL, 0xCB4CCD500F6BB952ULL, 0xD097AD07A71F26B2ULL, 0x7E2000A41346A7A7ULL,
+    0x825ECC24C873782FULL, 0x8ED400668C0C28C8ULL, 0xA2F67F2DFA90563BULL, 0x728900802F0F32FAULL,
+    0xCBB41EF979346BCAULL, 0x4F2B40A03AD2FFB9ULL, 0xFEA126B7D78186BCULL, 0xE2F610C84987BFA8ULL,
+    0x9F24B832E6B0F436ULL, 0x0DD9CA7D2DF4D7C9ULL, 0xC6EDE63FA05D3143ULL, 0x91503D1C79720DBBULL,
+    0xF8A95FCF88747D94ULL, 0x75A44C6397CE912AULL, 0x9B69DBE1B548CE7CULL, 0xC986AFBE3EE11ABAULL,
+    0xC24452DA229B021BULL, 0xFBE85BADCE996168ULL, 0xF2D56790AB41C2A2ULL, 0xFAE27299423FB9C3ULL,
+    0x97C560BA6B0919A5ULL, 0xDCCD879FC967D41AULL, 0xBDB6B8E905CB600FULL, 0x5400E987BBC1C920ULL,
+    0xED246723473E3813ULL, 0x290123E9AAB23B68ULL, 0x9436C0760C86E30BULL, 0xF9A0B6720AAF6521ULL,
+    0xB94470938FA89BCEULL, 0xF808E40E8D5B3E69ULL, 0xE7958CB87392C2C2ULL, 0xB60B1D1230B20E04ULL,
+    0x90BD77F3483BB9B9ULL, 0xB1C6F22B5E6F48C2ULL, 0xB4ECD5F01A4AA828ULL, 0x1E38AEB6360B1AF3ULL,
+    0xE2280B6C20DD5232ULL, 0x25C6DA63C38DE1B0ULL, 0x8D590723948A535FULL, 0x579C487E5A38AD0EULL,
+    0xB0AF48EC79ACE837ULL, 0x2D835A9DF0C6D851ULL, 0xDCDB1B2798182244ULL, 0xF8E431456CF88E65ULL,
+    0x8A08F0F8BF0F156BULL, 0x1B8E9ECB641B58FFULL, 0xAC8B2D36EED2DAC5ULL, 0xE272467E3D222F3FULL,
+    0xD7ADF884AA879177ULL, 0x5B0ED81DCC6ABB0FULL, 0x86CCBB52EA94BAEAULL, 0x98E947129FC2B4E9ULL,
+    0xA87FEA27A539E9A5ULL, 0x3F2398D747B36224ULL, 0xD29FE4B18E88640EULL, 0x8EEC7F0D19A03AADULL,
+    0x83A3EEEEF9153E89ULL, 0x1953CF68300424ACULL, 0xA48CEAAAB75A8E2BULL, 0x5FA8C3423C052DD7ULL,
+    0xCDB02555653131B6ULL, 0x3792F412CB06794DULL, 0x808E17555F3EBF11ULL, 0xE2BBD88BBEE40BD0ULL,
+    0xA0B19D2AB70E6ED6ULL, 0x5B6ACEAEAE9D0EC4ULL, 0xC8DE047564D20A8BULL, 0xF245825A5A445275ULL,
+    0xFB158592BE068D2EULL, 0xEED6E2F0F0D56712ULL, 0x9CED737BB6C4183DULL, 0x55464DD69685606BULL,
+    0xC428D05AA4751E4CULL, 0xAA97E14C3C26B886ULL, 0xF53304714D9265DFULL, 0xD53DD99F4B3066A8ULL,
+    0x993FE2C6D07B7FABULL, 0xE546A8038EFE4029ULL, 0xBF8FDB78849A5F96ULL, 0xDE98520472BDD033ULL,
+    0xEF73D256A5C0F77CULL, 0x963E66858F6D4440ULL, 0x95A8637627989AADULL, 0xDDE7001379A44AA8ULL,
+    0xBB127C53B17EC159ULL, 0x5560C018580D5D52ULL, 0xE9D71B689DDE71AFULL, 0xAAB8F01E6E10B4A6ULL,
+    0x9226712162AB070DULL, 0xCAB3961304CA70E8ULL, 0xB6B00D69BB55C8D1ULL, 0x3D607B97C5FD0D22ULL,
+    0xE45C10C42A2B3B05ULL, 0x8CB89A7DB77C506AULL, 0x8EB98A7A9A5B04E3ULL, 0x77F3608E92ADB242ULL,
+    0xB267ED1940F1C61CULL, 0x55F038B237591ED3ULL, 0xDF01E85F912E37A3ULL, 0x6B6C46DEC52F6688ULL,
+    0x8B61313BBABCE2C6ULL, 0x2323AC4B3B3DA015ULL, 0xAE397D8AA96C1B77ULL, 0xABEC975E0A0D081AULL,
+    0xD9C7DCED53C72255ULL, 0x96E7BD358C904A21ULL, 0x881CEA14545C7575ULL, 0x7E50D64177DA2E54ULL,
+    0xAA242499697392D2ULL, 0xDDE50BD1D5D0B9E9ULL, 0xD4AD2DBFC3D07787ULL, 0x955E4EC64B44E864ULL,
+    0x84EC3C97DA624AB4ULL, 0xBD5AF13BEF0B113EULL, 0xA6274BBDD0FADD61ULL, 0xECB1AD8AEACDD58EULL,
+    0xCFB11EAD453994BAULL, 0x67DE18EDA5814AF2ULL, 0x81CEB32C4B43FCF4ULL, 0x80EACF948770CED7ULL,
+    0xA2425FF75E14FC31ULL, 0xA1258379A94D028DULL, 0xCAD2F7F5359A3B3EULL, 0x096EE45813A04330ULL,
+    0xFD87B5F28300CA0DULL, 0x8BCA9D6E188853FCULL, 0x9E74D1B791E07E48ULL, 0x775EA264CF55347EULL,
+    0xC612062576589DDAULL, 0x95364AFE032A819EULL, 0xF79687AED3EEC551ULL, 0x3A83DDBD83F52205ULL,
+    0x9ABE14CD44753B52ULL, 0xC4926A9672793543ULL, 0xC16D9A0095928A27ULL, 0x75B7053C0F178294ULL,
+    0xF1C90080BAF72CB1ULL, 0x5324C68B12DD6339ULL, 0x971DA05074DA7BEEULL, 0xD3F6FC16EBCA5E04ULL,
+    0xBCE5086492111AEAULL, 0x88F4BB1CA6BCF585ULL, 0xEC1E4A7DB69561A5ULL, 0x2B31E9E3D06C32E6ULL,
+    0x9392EE8E921D5D07ULL, 0x3AFF322E62439FD0ULL, 0xB877AA3236A4B449ULL, 0x09BEFEB9FAD487C3ULL,
+    0xE69594BEC44DE15BULL, 0x4C2EBE687989A9B4ULL, 0x901D7CF73AB0ACD9ULL, 0x0F9D37014BF60A11ULL,
+    0xB424DC35095CD80FULL, 0x538484C19EF38C95ULL, 0xE12E13424BB40E13ULL, 0x2865A5F206B06FBAULL,
+    0x8CBCCC096F5088CBULL, 0xF93F87B7442E45D4ULL, 0xAFEBFF0BCB24AAFEULL, 0xF78F69A51539D749ULL,
+    0xDBE6FECEBDEDD5BEULL, 0xB573440E5A884D1CULL, 0x89705F4136B4A597ULL, 0x31680A88F8953031ULL,
+    0xABCC77118461CEFCULL, 0xFDC20D2B36BA7C3EULL, 0xD6BF94D5E57A42BCULL, 0x3D32907604691B4DULL,
+    0x8637BD05AF6C69B5ULL, 0xA63F9A49C2C1B110ULL, 0xA7C5AC471B478423ULL, 0x0FCF80DC33721D54ULL,
+    0xD1B71758E219652BULL, 0xD3C36113404EA4A9ULL, 0x83126E978D4FDF3BULL, 0x645A1CAC083126EAULL,
+    0xA3D70A3D70A3D70AULL, 0x3D70A3D70A3D70A4ULL, 0xCCCCCCCCCCCCCCCCULL, 0xCCCCCCCCCCCCCCCDULL,
+    0x8000000000000000ULL, 0x0000000000000000ULL, 0xA000000000000000ULL, 0x0000000000000000ULL,
+    0xC800000000000000ULL, 0x0000000000000000ULL, 0xFA00000000000000ULL, 0x0000000000000000ULL,
+    0x9C40000000000000ULL, 0x0000000000000000ULL, 0xC350000000000000ULL, 0x0000000000000000ULL,
+    0xF424000000000000ULL, 0x0000000000000000ULL, 0x9896800000000000ULL, 0x0000000000000000ULL,
+    0xBEBC200000000000ULL, 0x0000000000000000ULL, 0xEE6B280000000000ULL, 0x0000000000000000ULL,
+    0x9502F90000000000ULL, 0x0000000000000000ULL, 0xBA43B74000000000ULL, 0x0000000000000000ULL,
+    0xE8D4A51000000000ULL, 0x0000000000000000ULL, 0x9184E72A00000000ULL, 0x0000000000000000ULL,
+    0xB5E620F480000000ULL, 0x0000000000000000ULL, 0xE35FA931A0000000ULL, 0x0000000000000000ULL,
+    0x8E1BC9BF04000000ULL, 0x0000000000000000ULL, 0xB1A2BC2EC5000000ULL, 0x0000000000000000ULL,
+    0xDE0B6B3A76400000ULL, 0x0000000000000000ULL, 0x8AC7230489E80000ULL, 0x0000000000000000ULL,
+    0xAD78EBC5AC620000ULL, 0x0000000000000000ULL, 0xD8D726B7177A8000ULL, 0x0000000000000000ULL,
+    0x878678326EAC9000ULL, 0x0000000000000000ULL, 0xA968163F0A57B400ULL, 0x0000000000000000ULL,
+    0xD3C21BCECCEDA100ULL, 0x0000000000000000ULL, 0x84595161401484A0ULL, 0x0000000000000000ULL,
+    0xA56FA5B99019A5C8ULL, 0x0000000000000000ULL, 0xCECB8F27F4200F3AULL, 0x0000000000000000ULL,
+    0x813F3978F8940984ULL, 0x4000000000000000ULL, 0xA18F07D736B90BE5ULL, 0x5000000000000000ULL,
+    0xC9F2C9CD04674EDEULL, 0xA400000000000000ULL, 0xFC6F7C4045812296ULL, 0x4D00000000000000ULL,
+    0x9DC5ADA82B70B59DULL, 0xF020000000000000ULL, 0xC5371912364CE305ULL, 0x6C28000000000000ULL,
+    0xF684DF56C3E01BC6ULL, 0xC732000000000000ULL, 0x9A130B963A6C115CULL, 0x3C7F400000000000ULL,
+    0xC097CE7BC90715B3ULL, 0x4B9F100000000000ULL, 0xF0BDC21ABB48DB20ULL, 0x1E86D40000000000ULL,
+    0x96769950B50D88F4ULL, 0x1314448000000000ULL, 0xBC143FA4E250EB31ULL, 0x17D955A000000000ULL,
+    0xEB194F8E1AE525FDULL, 0x5DCFAB0800000000ULL, 0x92EFD1B8D0CF37BEULL, 0x5AA1CAE500000000ULL,
+    0xB7ABC627050305ADULL, 0xF14A3D9E40000000ULL, 0xE596B7B0C643C719ULL, 0x6D9CCD05D0000000ULL,
+    0x8F7E32CE7BEA5C6FULL, 0xE4820023A2000000ULL, 0xB35DBF821AE4F38BULL, 0xDDA2802C8A800000ULL,
+    0xE0352F62A19E306EULL, 0xD50B2037AD200000ULL, 0x8C213D9DA502DE45ULL, 0x4526F422CC340000ULL,
+    0xAF298D050E4395D6ULL, 0x9670B12B7F410000ULL, 0xDAF3F04651D47B4CULL, 0x3C0CDD765F114000ULL,
+    0x88D8762BF324CD0FULL, 0xA5880A69FB6AC800ULL, 0xAB0E93B6EFEE0053ULL, 0x8EEA0D047A457A00ULL,
+    0xD5D238A4ABE98068ULL, 0x72A4904598D6D880ULL, 0x85A36366EB71F041ULL, 0x47A6DA2B7F864750ULL,
+    0xA70C3C40A64E6C51ULL, 0x999090B65F67D924ULL, 0xD0CF4B50CFE20765ULL, 0xFFF4B4E3F741CF6DULL,
+    0x82818F1281ED449FULL, 0xBFF8F10E7A8921A4ULL, 0xA321F2D7226895C7ULL, 0xAFF72D52192B6A0DULL,
+    0xCBEA6F8CEB02BB39ULL, 0x9BF4F8A69F764490ULL, 0xFEE50B7025C36A08ULL, 0x02F236D04753D5B4ULL,
+    0x9F4F2726179A2245ULL, 0x01D762422C946590ULL, 0xC722F0EF9D80AAD6ULL, 0x424D3AD2B7B97EF5ULL,
+    0xF8EBAD2B84E0D58BULL, 0xD2E0898765A7DEB2ULL, 0x9B934C3B330C8577ULL, 0x63CC55F49F88EB2FULL,
+    0xC2781F49FFCFA6D5ULL, 0x3CBF6B71C76B25FBULL, 0xF316271C7FC3908AULL, 0x8BEF464E3945EF7AULL,
+    0x97EDD871CFDA3A56ULL, 0x97758BF0E3CBB5ACULL, 0xBDE94E8E43D0C8ECULL, 0x3D52EEED1CBEA317ULL,
+    0xED63A231D4C4FB27ULL, 0x4CA7AAA863EE4BDDULL, 0x945E455F24FB1CF8ULL, 0x8FE8CAA93E74EF6AULL,
+    0xB975D6B6EE39E436ULL, 0xB3E2FD538E122B44ULL, 0xE7D34C64A9C85D44ULL, 0x60DBBCA87196B616ULL,
+    0x90E40FBEEA1D3A4AULL, 0xBC8955E946FE31CDULL, 0xB51D13AEA4A488DDULL, 0x6BABAB6398BDBE41ULL,
+    0xE264589A4DCDAB14ULL, 0xC696963C7EED2DD1ULL, 0x8D7EB76070A08AECULL, 0xFC1E1DE5CF543CA2ULL,
+    0xB0DE65388CC8ADA8ULL, 0x3B25A55F43294BCBULL, 0xDD15FE86AFFAD912ULL, 0x49EF0EB713F39EBEULL,
+    0x8A2DBF142DFCC7ABULL, 0x6E3569326C784337ULL, 0xACB92ED9397BF996ULL, 0x49C2C37F07965404ULL,
+    0xD7E77A8F87DAF7FBULL, 0xDC33745EC97BE906ULL, 0x86F0AC99B4E8DAFDULL, 0x69A028BB3DED71A3ULL,
+    0xA8ACD7C0222311BCULL, 0xC40832EA0D68CE0CULL, 0xD2D80DB02AABD62BULL, 0xF50A3FA490C30190ULL,
+    0x83C7088E1AAB65DBULL, 0x792667C6DA79E0FAULL, 0xA4B8CAB1A1563F52ULL, 0x577001B891185938ULL,
+    0xCDE6FD5E09ABCF26ULL, 0xED4C0226B55E6F86ULL, 0x80B05E5AC60B6178ULL, 0x544F8158315B05B4ULL,
+    0xA0DC75F1778E39D6ULL, 0x696361AE3DB1C721ULL, 0xC913936DD571C84CULL, 0x03BC3A19CD1E38E9ULL,
+    0xFB5878494ACE3A5FULL, 0x04AB48A04065C723ULL, 0x9D174B2DCEC0E47BULL, 0x62EB0D64283F9C76ULL,
+    0xC45D1DF942711D9AULL, 0x3BA5D0BD324F8394ULL, 0xF5746577930D6500ULL, 0xCA8F44EC7EE36479ULL,
+    0x9968BF6ABBE85F20ULL, 0x7E998B13CF4E1ECBULL, 0xBFC2EF456AE276E8ULL, 0x9E3FEDD8C321A67EULL,
+    0xEFB3AB16C59B14A2ULL, 0xC5CFE94EF3EA101EULL, 0x95D04AEE3B80ECE5ULL, 0xBBA1F1D158724A12ULL,
+    0xBB445DA9CA61281FULL, 0x2A8A6E45AE8EDC97ULL, 0xEA1575143CF97226ULL, 0xF52D09D71A3293BDULL,
+    0x924D692CA61BE758ULL, 0x593C2626705F9C56ULL, 0xB6E0C377CFA2E12EULL, 0x6F8B2FB00C77836CULL,
+    0xE498F455C38B997AULL, 0x0B6DFB9C0F956447ULL, 0x8EDF98B59A373FECULL, 0x4724BD4189BD5EACULL,
+    0xB2977EE300C50FE7ULL, 0x58EDEC91EC2CB657ULL, 0xDF3D5E9BC0F653E1ULL, 0x2F2967B66737E3EDULL,
+    0x8B865B215899F46CULL, 0xBD79E0D20082EE74ULL, 0xAE67F1E9AEC07187ULL, 0xECD8590680A3AA11ULL,
+    0xDA01EE641A708DE9ULL, 0xE80E6F4820CC9495ULL, 0x884134FE908658B2ULL, 0x3109058D147FDCDDULL,
+    0xAA51823E34A7EEDEULL, 0xBD4B46F0599FD415ULL, 0xD4E5E2CDC1D1EA96ULL, 0x6C9E18AC7007C91AULL,
+    0x850FADC09923329EULL, 0x03E2CF6BC604DDB0ULL, 0xA6539930BF6BFF45ULL, 0x84DB8346B786151CULL,
+    0xCFE87F7CEF46FF16ULL, 0xE612641865679A63ULL, 0x81F14FAE158C5F6EULL, 0x4FCB7E8F3F60C07EULL,
+    0xA26DA3999AEF7749ULL, 0xE3BE5E330F38F09DULL, 0xCB090C8001AB551CULL, 0x5CADF5BFD3072CC5ULL,
+    0xFDCB4FA002162A63ULL, 0x73D9732FC7C8F7F6ULL, 0x9E9F11C4014DDA7EULL, 0x2867E7FDDCDD9AFAULL,
+    0xC646D63501A1511DULL, 0xB281E1FD541501B8ULL, 0xF7D88BC24209A565ULL, 0x1F225A7CA91A4226ULL,
+    0x9AE757596946075FULL, 0x3375788DE9B06958ULL, 0xC1A12D2FC3978937ULL, 0x0052D6B1641C83AEULL,
+    0xF209787BB47D6B84ULL, 0xC0678C5DBD23A49AULL, 0x9745EB4D50CE6332ULL, 0xF840B7BA963646E0ULL,
+    0xBD176620A501FBFFULL, 0xB650E5A93BC3D898ULL, 0xEC5D3FA8CE427AFFULL, 0xA3E51F138AB4CEBEULL,
+    0x93BA47C980E98CDFULL, 0xC66F336C36B10137ULL, 0xB8A8D9BBE123F017ULL, 0xB80B0047445D4184ULL,
+    0xE6D3102AD96CEC1DULL, 0xA60DC059157491E5ULL, 0x9043EA1AC7E41392ULL, 0x87C89837AD68DB2FULL,
+    0xB454E4A179DD1877ULL, 0x29BABE4598C311FBULL, 0xE16A1DC9D8545E94ULL, 0xF4296DD6FEF3D67AULL,
+    0x8CE2529E2734BB1DULL, 0x1899E4A65F58660CULL, 0xB01AE745B101E9E4ULL, 0x5EC05DCFF72E7F8FULL,
+    0xDC21A1171D42645DULL, 0x76707543F4FA1F73ULL, 0x899504AE72497EBAULL, 0x6A06494A791C53A8ULL,
+    0xABFA45DA0EDBDE69ULL, 0x0487DB9D17636892ULL, 0xD6F8D7509292D603ULL, 0x45A9D2845D3C42B6ULL,
+    0x865B86925B9BC5C2ULL, 0x0B8A2392BA45A9B2ULL, 0xA7F26836F282B732ULL, 0x8E6CAC7768D7141EULL,
+    0xD1EF0244AF2364FFULL, 0x3207D795430CD926ULL, 0x8335616AED761F1FULL, 0x7F44E6BD49E807B8ULL,
+    0xA402B9C5A8D3A6E7ULL, 0x5F16206C9C6209A6ULL, 0xCD036837130890A1ULL, 0x36DBA887C37A8C0FULL,
+    0x802221226BE55A64ULL, 0xC2494954DA2C9789ULL, 0xA02AA96B06DEB0FDULL, 0xF2DB9BAA10B7BD6CULL,
+    0xC83553C5C8965D3DULL, 0x6F92829494E5ACC7ULL, 0xFA42A8B73ABBF48CULL, 0xCB772339BA1F17F9ULL,
+    0x9C69A97284B578D7ULL, 0xFF2A760414536EFBULL, 0xC38413CF25E2D70DULL, 0xFEF5138519684ABAULL,
+    0xF46518C2EF5B8CD1ULL, 0x7EB258665FC25D69ULL, 0x98BF2F79D5993802ULL, 0xEF2F773FFBD97A61ULL,
+    0xBEEEFB584AFF8603ULL, 0xAAFB550FFACFD8FAULL, 0xEEAABA2E5DBF6784ULL, 0x95BA2A53F983CF38ULL,
+    0x952AB45CFA97A0B2ULL, 0xDD945A747BF26183ULL, 0xBA756174393D88DFULL, 0x94F971119AEEF9E4ULL,
+    0xE912B9D1478CEB17ULL, 0x7A37CD5601AAB85DULL, 0x91ABB422CCB812EEULL, 0xAC62E055C10AB33AULL,
+    0xB616A12B7FE617AAULL, 0x577B986B314D6009ULL, 0xE39C49765FDF9D94ULL, 0xED5A7E85FDA0B80BULL,
+    0x8E41ADE9FBEBC27DULL, 0x14588F13BE847307ULL, 0xB1D219647AE6B31CULL, 0x596EB2D8AE258FC8ULL,
+    0xDE469FBD99A05FE3ULL, 0x6FCA5F8ED9AEF3BBULL, 0x8AEC23D680043BEEULL, 0x25DE7BB9480D5854ULL,
+    0xADA72CCC20054AE9ULL, 0xAF561AA79A10AE6AULL, 0xD910F7FF28069DA4ULL, 0x1B2BA1518094DA04ULL,
+    0x87AA9AFF79042286ULL, 0x90FB44D2F05D0842ULL, 0xA99541BF57452B28ULL, 0x353A1607AC744A53ULL,
+    0xD3FA922F2D1675F2ULL, 0x42889B8997915CE8ULL, 0x847C9B5D7C2E09B7ULL, 0x69956135FEBADA11ULL,
+    0xA59BC234DB398C25ULL, 0x43FAB9837E699095ULL, 0xCF02B2C21207EF2EULL, 0x94F967E45E03F4BBULL,
+    0x8161AFB94B44F57DULL, 0x1D1BE0EEBAC278F5ULL, 0xA1BA1BA79E1632DCULL, 0x6462D92A69731732ULL,
+    0xCA28A291859BBF93ULL, 0x7D7B8F7503CFDCFEULL, 0xFCB2CB35E702AF78ULL, 0x5CDA735244C3D43EULL,
+    0x9DEFBF01B061ADABULL, 0x3A0888136AFA64A7ULL, 0xC56BAEC21C7A1916ULL, 0x088AAA1845B8FDD0ULL,
+    0xF6C69A72A3989F5BULL, 0x8AAD549E57273D45ULL, 0x9A3C2087A63F6399ULL, 0x36AC54E2F678864BULL,
+    0xC0CB28A98FCF3C7FULL, 0x84576A1BB416A7DDULL, 0xF0FDF2D3F3C30B9FULL, 0x656D44A2A11C51D5ULL,
+    0x969EB7C47859E743ULL, 0x9F644AE5A4B1B325ULL, 0xBC4665B596706114ULL, 0x873D5D9F0DDE1FEEULL,
+    0xEB57FF22FC0C7959ULL, 0xA90CB506D155A7EAULL, 0x9316FF75DD87CBD8ULL, 0x09A7F12442D588F2ULL,
+    0xB7DCBF5354E9BECEULL, 0x0C11ED6D538AEB2FULL, 0xE5D3EF282A242E81ULL, 0x8F1668C8A86DA5FAULL,
+    0x8FA475791A569D10ULL, 0xF96E017D694487BCULL, 0xB38D92D760EC4455ULL, 0x37C981DCC395A9ACULL,
+    0xE070F78D3927556AULL, 0x85BBE253F47B1417ULL, 0x8C469AB843B89562ULL, 0x93956D7478CCEC8EULL,
+    0xAF58416654A6BABBULL, 0x387AC8D1970027B2ULL, 0xDB2E51BFE9D0696AULL, 0x06997B05FCC0319EULL,
+    0x88FCF317F22241E2ULL, 0x441FECE3BDF81F03ULL, 0xAB3C2FDDEEAAD25AULL, 0xD527E81CAD7626C3ULL,
+    0xD60B3BD56A5586F1ULL, 0x8A71E223D8D3B074ULL, 0x85C7056562757456ULL, 0xF6872D5667844E49ULL,
+    0xA738C6BEBB12D16CULL, 0xB428F8AC016561DBULL, 0xD106F86E69D785C7ULL, 0xE13336D701BEBA52ULL,
+    0x82A45B450226B39CULL, 0xECC0024661173473ULL, 0xA34D721642B06084ULL, 0x27F002D7F95D0190ULL,
+    0xCC20CE9BD35C78A5ULL, 0x31EC038DF7B441F4ULL, 0xFF290242C83396CEULL, 0x7E67047175A15271ULL,
+    0x9F79A169BD203E41ULL, 0x0F0062C6E984D386ULL, 0xC75809C42C684DD1ULL, 0x52C07B78A3E60868ULL,
+    0xF92E0C3537826145ULL, 0xA7709A56CCDF8A82ULL, 0x9BBCC7A142B17CCBULL, 0x88A66076400BB691ULL,
+    0xC2ABF989935DDBFEULL, 0x6ACFF893D00EA435ULL, 0xF356F7EBF83552FEULL, 0x0583F6B8C4124D43ULL,
+    0x98165AF37B2153DEULL, 0xC3727A337A8B704AULL, 0xBE1BF1B059E9A8D6ULL, 0x744F18C0592E4C5CULL,
+    0xEDA2EE1C7064130CULL, 0x1162DEF06F79DF73ULL, 0x9485D4D1C63E8BE7ULL, 0x8ADDCB5645AC2BA8ULL,
+    0xB9A74A0637CE2EE1ULL, 0x6D953E2BD7173692ULL, 0xE8111C87C5C1BA99ULL, 0xC8FA8DB6CCDD0437ULL,
+    0x910AB1D4DB9914A0ULL, 0x1D9C9892400A22A2ULL, 0xB54D5E4A127F59C8ULL, 0x2503BEB6D00CAB4BULL,
+    0xE2A0B5DC971F303AULL, 0x2E44AE64840FD61DULL, 0x8DA471A9DE737E24ULL, 0x5CEAECFED289E5D2ULL,
+    0xB10D8E1456105DADULL, 0x7425A83E872C5F47ULL, 0xDD50F1996B947518ULL, 0xD12F124E28F77719ULL,
+    0x8A5296FFE33CC92FULL, 0x82BD6B70D99AAA6FULL, 0xACE73CBFDC0BFB7BULL, 0x636CC64D1001550BULL,
+    0xD8210BEFD30EFA5AULL, 0x3C47F7E05401AA4EULL, 0x8714A775E3E95C78ULL, 0x65ACFAEC34810A71ULL,
+    0xA8D9D1535CE3B396ULL, 0x7F1839A741A14D0DULL, 0xD31045A8341CA07CULL, 0x1EDE48111209A050ULL,
+    0x83EA2B892091E44DULL, 0x934AED0AAB460432ULL, 0xA4E4B66B68B65D60ULL, 0xF81DA84D5617853FULL,
+    0xCE1DE40642E3F4B9ULL, 0x36251260AB9D668EULL, 0x80D2AE83E9CE78F3ULL, 0xC1D72B7C6B426019ULL,
+    0xA1075A24E4421730ULL, 0xB24CF65B8612F81FULL, 0xC94930AE1D529CFCULL, 0xDEE033F26797B627ULL,
+    0xFB9B7CD9A4A7443CULL, 0x169840EF017DA3B1ULL, 0x9D412E0806E88AA5ULL, 0x8E1F289560EE864EULL,
+    0xC491798A08A2AD4EULL, 0xF1A6F2BAB92A27E2ULL, 0xF5B5D7EC8ACB58A2ULL, 0xAE10AF696774B1DBULL,
+    0x9991A6F3D6BF1765ULL, 0xACCA6DA1E0A8EF29ULL, 0xBFF610B0CC6EDD3FULL, 0x17FD090A58D32AF3ULL,
+    0xEFF394DCFF8A948EULL, 0xDDFC4B4CEF07F5B0ULL, 0x95F83D0A1FB69CD9ULL, 0x4ABDAF101564F98EULL,
+    0xBB764C4CA7A4440FULL, 0x9D6D1AD41ABE37F1ULL, 0xEA53DF5FD18D5513ULL, 0x84C86189216DC5EDULL,
+    0x92746B9BE2F8552CULL, 0x32FD3CF5B4E49BB4ULL, 0xB7118682DBB66A77ULL, 0x3FBC8C33221DC2A1ULL,
+    0xE4D5E82392A40515ULL, 0x0FABAF3FEAA5334AULL, 0x8F05B1163BA6832DULL, 0x29CB4D87F2A7400EULL,
+    0xB2C71D5BCA9023F8ULL, 0x743E20E9EF511012ULL, 0xDF78E4B2BD342CF6ULL, 0x914DA9246B255416ULL,
+    0x8BAB8EEFB6409C1AULL, 0x1AD089B6C2F7548EULL, 0xAE9672ABA3D0C320ULL, 0xA184AC2473B529B1ULL,
+    0xDA3C0F568CC4F3E8ULL, 0xC9E5D72D90A2741EULL, 0x8865899617FB1871ULL, 0x7E2FA67C7A658892ULL,
+    0xAA7EEBFB9DF9DE8DULL, 0xDDBB901B98FEEAB7ULL, 0xD51EA6FA85785631ULL, 0x552A74227F3EA565ULL,
+    0x8533285C936B35DEULL, 0xD53A88958F87275FULL, 0xA67FF273B8460356ULL, 0x8A892ABAF368F137ULL,
+    0xD01FEF10A657842CULL, 0x2D2B7569B0432D85ULL, 0x8213F56A67F6B29BULL, 0x9C3B29620E29FC73ULL,
+    0xA298F2C501F45F42ULL, 0x8349F3BA91B47B8FULL, 0xCB3F2F7642717713ULL, 0x241C70A936219A73ULL,
+    0xFE0EFB53D30DD4D7ULL, 0xED238CD383AA0110ULL, 0x9EC95D1463E8A506ULL, 0xF4363804324A40AAULL,
+    0xC67BB4597CE2CE48ULL, 0xB143C6053EDCD0D5ULL, 0xF81AA16FDC1B81DAULL, 0xDD94B7868E94050AULL,
+    0x9B10A4E5E9913128ULL, 0xCA7CF2B4191C8326ULL, 0xC1D4CE1F63F57D72ULL, 0xFD1C2F611F63A3F0ULL,
+    0xF24A01A73CF2DCCFULL, 0xBC633B39673C8CECULL, 0x976E41088617CA01ULL, 0xD5BE0503E085D813ULL,
+    0xBD49D14AA79DBC82ULL, 0x4B2D8644D8A74E18ULL, 0xEC9C459D51852BA2ULL, 0xDDF8E7D60ED1219EULL,
+    0x93E1AB8252F33B45ULL, 0xCABB90E5C942B503ULL, 0xB8DA1662E7B00A17ULL, 0x3D6A751F3B936243ULL,
+    0xE7109BFBA19C0C9DULL, 0x0CC512670A783AD4ULL, 0x906A617D450187E2ULL, 0x27FB2B80668B24C5ULL,
+    0xB484F9DC9641E9DAULL, 0xB1F9F660802DEDF6ULL, 0xE1A63853BBD26451ULL, 0x5E7873F8A0396973ULL,
+    0x8D07E33455637EB2ULL, 0xDB0B487B6423E1E8ULL, 0xB049DC016ABC5E5FULL, 0x91CE1A9A3D2CDA62ULL,
+    0xDC5C5301C56B75F7ULL, 0x7641A140CC7810FBULL, 0x89B9B3E11B6329BAULL, 0xA9E904C87FCB0A9DULL,
+    0xAC2820D9623BF429ULL, 0x546345FA9FBDCD44ULL, 0xD732290FBACAF133ULL, 0xA97C177947AD4095ULL,
+    0x867F59A9D4BED6C0ULL, 0x49ED8EABCCCC485DULL, 0xA81F301449EE8C70ULL, 0x5C68F256BFFF5A74ULL,
+    0xD226FC195C6A2F8CULL, 0x73832EEC6FFF3111ULL, 0x83585D8FD9C25DB7ULL, 0xC831FD53C5FF7EABULL,
+    0xA42E74F3D032F525ULL, 0xBA3E7CA8B77F5E55ULL, 0xCD3A1230C43FB26FULL, 0x28CE1BD2E55F35EBULL,
+    0x80444B5E7AA7CF85ULL, 0x7980D163CF5B81B3ULL, 0xA0555E361951C366ULL, 0xD7E105BCC332621FULL,
+    0xC86AB5C39FA63440ULL, 0x8DD9472BF3FEFAA7ULL, 0xFA856334878FC150ULL, 0xB14F98F6F0FEB951ULL,
+    0x9C935E00D4B9D8D2ULL, 0x6ED1BF9A569F33D3ULL, 0xC3B8358109E84F07ULL, 0x0A862F80EC4700C8ULL,
+    0xF4A642E14C6262C8ULL, 0xCD27BB612758C0FAULL, 0x98E7E9CCCFBD7DBDULL, 0x8038D51CB897789CULL,
+    0xBF21E44003ACDD2CULL, 0xE0470A63E6BD56C3ULL, 0xEEEA5D5004981478ULL, 0x1858CCFCE06CAC74ULL,
+    0x95527A5202DF0CCBULL, 0x0F37801E0C43EBC8ULL, 0xBAA718E68396CFFDULL, 0xD30560258F54E6BAULL,
+    0xE950DF20247C83FDULL, 0x47C6B82EF32A2069ULL, 0x91D28B7416CDD27EULL, 0x4CDC331D57FA5441ULL,
+    0xB6472E511C81471DULL, 0xE0133FE4ADF8E952ULL, 0xE3D8F9E563A198E5ULL, 0x58180FDDD97723A6ULL,
+    0x8E679C2F5E44FF8FULL, 0x570F09EAA7EA7648ULL
+};
 
-            for (std::size_t i = bits.size() - 1; i >= static_cast<std::size_t>(shift); --i)
-            {
-                bits[i] = bits[i - shift];
-            }
+inline constexpr int smallest_power_of_five = -342;
 
-            for (std::size_t i = 0; i < static_cast<std::size_t>(shift); ++i)
-            {
-                bits[i] = 0;
-            }
-        }
 
-        cpos += long_binary_to_decimal(bits.rbegin(), bits.rend(), buffer + cpos, true);
+struct uint128_parts
+{
+    std::uint64_t low;
+    std::uint64_t high;
+};
 
-        --value.f;
-    }
+[[nodiscard]] constexpr uint128_parts full_multiplication(std::uint64_t __a, std::uint64_t __b) noexcept
+{
+#if defined(_KWARGS_HAS_UINT128)
+    const _KWARGS_UINT128 product = static_cast<_KWARGS_UINT128>(__a) * __b;
 
-    if (value.f)
-    {
-        buffer[cpos++] = '.';
-    }
+    return { static_cast<std::uint64_t>(product), static_cast<std::uint64_t>(product >> 64) };
+#else
+    const std::uint64_t a_lo = __a & 0xFFFF'FFFFU, a_hi = __a >> 32;
+    const std::uint64_t b_lo = __b & 0xFFFF'FFFFU, b_hi = __b >> 32;
 
-    auto check = [&]() constexpr noexcept -> bool {
-#if defined(KWARGS_CONVERT_REALS_TO_STRINGS_WITH_HEURISTIC_PRECISION)
-        if (exponent < 0)
-        {
-            return static_cast<bool>(value.f);
-        }
-#endif
+    const std::uint64_t lo_lo = a_lo * b_lo;
+    const std::uint64_t hi_lo = a_hi * b_lo;
+    const std::uint64_t lo_hi = a_lo * b_hi;
+    const std::uint64_t hi_hi = a_hi * b_hi;
 
-#if defined(KWARGS_CONVERT_REALS_TO_STRINGS_WITH_FIXED_FLOAT_PRECISION)
-        if constexpr (std::is_same_v<_Tp, float>)
-        {
-            return value.f > static_cast<float>(KWARGS_CONVERT_REALS_TO_STRINGS_WITH_FIXED_FLOAT_PRECISION);
-        }
-#endif
+    const std::uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xFFFF'FFFFU) + lo_hi;
 
-#if defined(KWARGS_CONVERT_REALS_TO_STRINGS_WITH_FIXED_DOUBLE_PRECISION)
-        if constexpr (std::is_same_v<_Tp, double>)
-        {
-            return value.f > static_cast<double>(KWARGS_CONVERT_REALS_TO_STRINGS_WITH_FIXED_DOUBLE_PRECISION);
-        }
+    return { (cross << 32) | (lo_lo & 0xFFFF'FFFFU), (hi_lo >> 32) + (cross >> 32) + hi_hi };
 #endif
+}
 
-#if defined(KWARGS_CONVERT_REALS_TO_STRINGS_WITH_FIXED_LONG_DOUBLE_PRECISION)
-        if constexpr (std::is_same_v<_Tp, long double>)
-        {
-            return value.f > static_cast<long double>(KWARGS_CONVERT_REALS_TO_STRINGS_WITH_FIXED_LONG_DOUBLE_PRECISION);
-        }
-#endif
+_KWARGS_Test_(full_multiplication(0xFFFF'FFFF'FFFF'FFFFULL, 0xFFFF'FFFF'FFFF'FFFFULL).high, 0xFFFF'FFFF'FFFF'FFFEULL);
+_KWARGS_Test_(full_multiplication(0xFFFF'FFFF'FFFF'FFFFULL, 0xFFFF'FFFF'FFFF'FFFFULL).low, 1ULL);
 
-#if defined(KWARGS_CONVERT_REALS_TO_STRINGS_WITH_FIXED_PRECISION)
-        return value.f > static_cast<_Tp>(KWARGS_CONVERT_REALS_TO_STRINGS_WITH_FIXED_PRECISION);
-#elif defined(KWARGS_CONVERT_REALS_TO_STRINGS_WITH_HEURISTIC_PRECISION)
-        if constexpr (sizeof(_Tp) == sizeof(float))
-        {
-            return value.f > 1e-6f;
-        }
-        else if constexpr (sizeof(_Tp) == sizeof(double))
-        {
-            return value.f > 1e-12;
-        }
-        else
+
+[[nodiscard]] constexpr int count_leading_zeros(std::uint64_t __n) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __n ? __builtin_clzll(__n) : 64;
+#else
+    int count = 0;
+
+    for (int shift = 32; shift; shift >>= 1)
+    {
+        if ((__n >> (64 - shift)) == 0)
         {
-            return value.f > 1e-18L;
+            count += shift;
+            __n <<= shift;
         }
-#else
-        return static_cast<bool>(value.f);
+    }
+
+    return count + static_cast<int>(__n == 0);
 #endif
-    };
+}
 
+_KWARGS_Test_(count_leading_zeros(1), 63); _KWARGS_Test_(count_leading_zeros(~0ULL), 0); _KWARGS_Test_(count_leading_zeros(0x10000), 47);
 
-    while (check() && cpos < buffer_size)
-    {
-        value.f *= 10;
-        buffer[cpos++] = '0' + static_cast<char>(value.f);
 
-        value.f -= static_cast<decltype(value.f)>(static_cast<int>(value.f));
-    }
+/**
+ * @brief Parameters of the IEEE-754 binary formats handled by compute_float.
+ */
+template<typename _Tp>
+struct binary_format;
 
-    return std::remove_reference_t<_Res>(static_cast<std::decay_t<decltype(buffer)>>(buffer), cpos);
-}
+template<>
+struct binary_format<float>
+{
+    using bits_type = std::uint32_t;
 
-template<typename _Res, typename _Tp>
-[[nodiscard]] constexpr auto pointer_to_string(const _Tp* __n) noexcept
-    -> std::enable_if_t<is_std_string_v<_Res>, std::remove_reference_t<_Res>>
-{ return integer_to_string<_Res>(reinterpret_cast<std::uintptr_t>(__n), 16); }
+    static constexpr int mantissa_explicit_bits = 23;
+    static constexpr int minimum_exponent = -127;
+    static constexpr int infinite_power = 0xFF;
 
-template<typename _Res, typename _Tp>
-[[nodiscard]] constexpr auto number_to_string(_Tp __n) noexcept
-        -> std::enable_if_t<is_std_string_v<_Res> && std::disjunction_v<is_integral_or_enum<_Tp>, std::is_floating_point<_Tp>, is_pointer<_Tp>>, std::remove_reference_t<_Res>>
+    static constexpr int min_exponent_round_to_even = -17;
+    static constexpr int max_exponent_round_to_even = 10;
+
+    static constexpr int smallest_power_of_ten = -64;
+    static constexpr int largest_power_of_ten = 38;
+
+    static constexpr int max_exponent_fast_path = 10;
+};
+
+template<>
+struct binary_format<double>
 {
-    if constexpr (std::is_integral_v<_Tp>)
-    {
-        return integer_to_string<_Res>(__n);
-    }
-    else if constexpr (std::is_floating_point_v<_Tp>)
+    using bits_type = std::uint64_t;
+
+    static constexpr int mantissa_explicit_bits = 52;
+    static constexpr int minimum_exponent = -1023;
+    static constexpr int infinite_power = 0x7FF;
+
+    static constexpr int min_exponent_round_to_even = -4;
+    static constexpr int max_exponent_round_to_even = 23;
+
+    static constexpr int smallest_power_of_ten = -342;
+    static constexpr int largest_power_of_ten = 308;
+
+    static constexpr int max_exponent_fast_path = 22;
+};
+
+
+/**
+ * @brief A binary floating-point value before it is packed:
+ *        the explicit mantissa bits and the biased exponent.
+ * 
+ * A negative @c power2 means that the value could not be decided and must be recomputed.
+ */
+struct adjusted_mantissa
+{
+    std::uint64_t mantissa = 0;
+    std::int32_t  power2 = 0;
+
+    [[nodiscard]] constexpr bool operator==(const adjusted_mantissa& __other) const noexcept
+    { return mantissa == __other.mantissa && power2 == __other.power2; }
+
+    [[nodiscard]] constexpr bool operator!=(const adjusted_mantissa& __other) const noexcept
+    { return !(*this == __other); }
+};
+
+
+/**
+ * @brief Converts @c __w * 10^__q into the nearest binary floating-point value (Eisel-Lemire).
+ * 
+ * The result is exact for any 64-bit @c __w; it only needs to be double-checked by the caller
+ * when @c __w itself is a truncation of a longer decimal.
+ */
+template<typename _Tp>
+[[nodiscard]] constexpr adjusted_mantissa compute_float(std::int64_t __q, std::uint64_t __w) noexcept
+{
+    using binary = binary_format<_Tp>;
+
+    adjusted_mantissa answer;
+
+    if (__w == 0 || __q < binary::smallest_power_of_ten)
     {
-        return floating_point_to_string<_Res>(__n);
+        return answer;
     }
-    else
+
+    if (__q > binary::largest_power_of_ten)
     {
-        return pointer_to_string<_Res>(__n);
+        answer.power2 = binary::infinite_power;
+        return answer;
     }
-}
 
+    const int lz = count_leading_zeros(__w);
+    __w <<= lz;
 
-using string_hash_type = std::uint64_t;
+    // Only the upper mantissa_explicit_bits + 3 bits of the product have to be exact.
+    const std::size_t index = 2 * static_cast<std::size_t>(__q - smallest_power_of_five);
 
-constexpr string_hash_type string_hash_base = 0X1C1ULL;
-constexpr string_hash_type string_hash_mod  = 0X91F5BCB8BB0243ULL;
+    uint128_parts product = full_multiplication(__w, power_of_five_128[index]);
 
-static_assert(
-    std::less_equal<string_hash_type>{}(string_hash_mod, std::numeric_limits<string_hash_type>::max() / string_hash_base),
-    "cpp-kwargs: The expression 'string_hash_base * string_hash_mod' overflows.");
+    constexpr std::uint64_t precision_mask = ~0ULL >> (binary::mantissa_explicit_bits + 3);
 
-static_assert(is_prime(string_hash_base)
-#if !defined(_KWARGS_HAS_UINT128)
-        || string_hash_base > 0x100000000ULL
-#endif  
-        , "cpp-kwargs: 'string_hash_base' must be a prime number.");
+    if ((product.high & precision_mask) == precision_mask)
+    {
+        const uint128_parts second = full_multiplication(__w, power_of_five_128[index + 1]);
 
-static_assert(is_prime(string_hash_mod)
-#if !defined(_KWARGS_HAS_UINT128)
-        || string_hash_mod > 0x100000000ULL
-#endif  
-        , "cpp-kwargs: 'string_hash_mod' must be a prime number.");
+        product.low += second.high;
 
-static_assert(std::gcd(string_hash_base, string_hash_mod) == 1, "cpp-kwargs: 'string_hash_base' and 'string_hash_mod' must be coprime.");
+        if (second.high > product.low)
+        {
+            ++product.high;
+        }
+    }
 
+    const int upperbit = static_cast<int>(product.high >> 63);
+    const int shift = upperbit + 64 - binary::mantissa_explicit_bits - 3;
 
+    answer.mantissa = product.high >> shift;
 
-constexpr string_hash_type string_hash_character(char __c) noexcept
-{
-    return static_cast<string_hash_type>(__c);
-}
+    // floor(q * log2(10)) + 63
+    const int power = static_cast<int>(((152170 + 65536) * __q) >> 16) + 63;
 
-template<char _Char>
-constexpr string_hash_type string_hash_character() noexcept
-{
-    return string_hash_character(_Char);
-}
+    answer.power2 = static_cast<std::int32_t>(power + upperbit - lz - binary::minimum_exponent);
 
-constexpr string_hash_type string_hash_append(string_hash_type __previous, char __c) noexcept
-{
-    // Define KWARGS_KEY_CASE_INSENSITIVE to enable case-insensitivity for KwargsKey.
+    if (answer.power2 <= 0)
+    {
+        // Subnormal.
+        if (-answer.power2 + 1 >= 64)
+        {
+            answer.power2 = 0;
+            answer.mantissa = 0;
+            return answer;
+        }
 
-#if defined(KWARGS_KEY_CASE_INSENSITIVE)
-    __c = tolower(__c);
-#endif
+        answer.mantissa >>= -answer.power2 + 1;
+        answer.mantissa += (answer.mantissa & 1);
+        answer.mantissa >>= 1;
 
-    return ((__previous * string_hash_base) % string_hash_mod + string_hash_character(__c)) % string_hash_mod;
-}
+        answer.power2 = (answer.mantissa < (1ULL << binary::mantissa_explicit_bits)) ? 0 : 1;
+        answer.mantissa &= ~(1ULL << binary::mantissa_explicit_bits);
 
-template<string_hash_type _Previous>
-constexpr string_hash_type string_hash_append_characters() noexcept
-{
-    return _Previous;
-}
+        return answer;
+    }
 
-template<string_hash_type _Previous, char _Char, char... _Chars>
-constexpr string_hash_type string_hash_append_characters() noexcept
-{
-    return string_hash_append_characters<string_hash_append(_Previous, _Char), _Chars...>();
-}
+    // Exactly halfway between two floats: round to even instead of up.
+    if (product.low <= 1
+        && __q >= binary::min_exponent_round_to_even && __q <= binary::max_exponent_round_to_even
+        && (answer.mantissa & 3) == 1
+        && (answer.mantissa << shift) == product.high)
+    {
+        answer.mantissa &= ~1ULL;
+    }
 
-template<char... _Chars>
-constexpr string_hash_type string_hash_characters() noexcept
-{
-    return string_hash_append_characters<0, _Chars...>();
-}
+    answer.mantissa += (answer.mantissa & 1);
+    answer.mantissa >>= 1;
 
-constexpr string_hash_type string_hash_string(const char* const __str, std::size_t __len) noexcept
-{
-    string_hash_type result = 0;
-    
-    for (std::size_t i = 0; i < __len; ++i)
+    if (answer.mantissa >= (2ULL << binary::mantissa_explicit_bits))
     {
-        result = string_hash_append(result, __str[i]);
+        answer.mantissa = (1ULL << binary::mantissa_explicit_bits);
+        ++answer.power2;
     }
 
-    return result;
-}
+    answer.mantissa &= ~(1ULL << binary::mantissa_explicit_bits);
 
-constexpr string_hash_type string_hash_string(std::string_view __str) noexcept
-{
-    string_hash_type result = 0;
-    
-    for (const char c : __str)
+    if (answer.power2 >= binary::infinite_power)
     {
-        result = string_hash_append(result, c);
+        answer.power2 = binary::infinite_power;
+        answer.mantissa = 0;
     }
 
-    return result;
+    return answer;
 }
 
-#undef _KWARGS_Test_
+_KWARGS_Test_(compute_float<double>(1, 1).power2, 1026);    _KWARGS_Test_(compute_float<double>(1, 1).mantissa, 1ULL << 50);
+_KWARGS_Test_(compute_float<double>(309, 1).power2, 0x7FF); _KWARGS_Test_(compute_float<double>(-343, 1).power2, 0);
+_KWARGS_Test_(compute_float<double>(-324, 5).power2, 0);    _KWARGS_Test_(compute_float<double>(-324, 5).mantissa, 1ULL);
 
-}  // namespace detail
 
+/**
+ * @brief An arbitrary-precision decimal, used when compute_float cannot decide the rounding.
+ * 
+ * Shifting by powers of two and rounding once at the end gives correctly rounded results
+ * for any number of digits (digits beyond max_digits only matter through @c truncated).
+ */
+struct big_decimal
+{
+    static constexpr int max_digits = 800;
 
-#undef _KWARGS_INT128
-#undef _KWARGS_UINT128
+    // Enough for any decimal that rounds to a double, plus room for a left shift.
+    std::uint8_t digits[max_digits + 20] = {};
 
-#undef _KWARGS_HAS_INT128
-#undef _KWARGS_HAS_UINT128
+    int  count = 0;
+    int  point = 0;
+    bool truncated = false;
 
-#undef _KWARGS_HAS_FLOAT128
+    static constexpr int max_shift = 60;
 
+    constexpr void assign(const char* __first, const char* __last, std::int64_t __exponent) noexcept
+    {
+        count = 0;
+        point = 0;
+        truncated = false;
 
-class Type
-{
-private:
+        bool has_point = false;
 
-    enum class NextTypeFlag : std::int32_t
-    {
-        Underlying,
-        PromoteNumeric,
-        ValueType,
-        DereferencedIterator,
-        Dereference,
-        ReturnValue,
-        Iterator,
-        PairFirstType,
-        PairSecondType
-    };
-
-    template<typename _Tp>
-    static constexpr Type _S_nextType(NextTypeFlag __flag) noexcept
-    {
-        switch (__flag)
+        for (; __first != __last; ++__first)
         {
-            case NextTypeFlag::Underlying:
+            if (*__first == '.')
             {
-                return Type().construct<detail::enum_underlying_type_t<_Tp>>();
+                has_point = true;
+                point = count;
             }
-
-            case NextTypeFlag::PromoteNumeric:
+            else if (count == 0 && *__first == '0')
             {
-                return Type().construct<detail::promote_numeric_t<_Tp>>();
+                --point;
             }
-
-            case NextTypeFlag::ValueType:
+            else if (count < max_digits)
             {
-                return Type().construct<detail::container_value_type_t<_Tp>>();
+                digits[count++] = static_cast<std::uint8_t>(*__first - '0');
             }
-
-            case NextTypeFlag::DereferencedIterator:
+            else if (*__first != '0')
             {
-                return Type().construct<detail::dereferenced_iterator_t<_Tp>>();
+                truncated = true;
             }
+        }
 
-            case NextTypeFlag::Dereference:
-            {
-                return Type().construct<detail::dereference_t<_Tp>>();
-            }
+        if (has_point == false)
+        {
+            point = count;
+        }
 
-            case NextTypeFlag::ReturnValue:
-            {
-                return Type().construct<detail::return_type_of_t<_Tp>>();
-            }
+        clamp<std::int64_t>(__exponent, -100'000, 100'000);
 
-            case NextTypeFlag::Iterator:
-            {
-                return Type().construct<detail::container_iterator_t<_Tp>>();
-            }
+        point += static_cast<int>(__exponent);
 
-            case NextTypeFlag::PairFirstType:
-            {
-                if constexpr (detail::is_tuple_like_v<_Tp>)
-                {
-                    if constexpr (std::tuple_size_v<std::remove_reference_t<_Tp>> >= 1)
-                    {
-                        return Type().construct<detail::first_of_tuple_t<_Tp>>();
-                    }
-                    else
-                    {
-                        return Type().construct<_Tp>();
-                    }
-                }
-                else
-                {
-                    return Type().construct<_Tp>();
-                }
-            }
+        trim();
+    }
 
-            case NextTypeFlag::PairSecondType:
-            {
-                if constexpr (detail::is_tuple_like_v<_Tp>)
-                {
-                    if constexpr (std::tuple_size_v<std::remove_reference_t<_Tp>> >= 2)
-                    {
-                        return Type().construct<detail::second_of_tuple_t<_Tp>>();
-                    }
-                    else
-                    {
-                        return Type().construct<_Tp>();
-                    }
-                }
-                else
-                {
-                    return Type().construct<_Tp>();
-                }
-            }
+    constexpr void trim() noexcept
+    {
+        for (; count > 0 && digits[count - 1] == 0; --count);
 
-            default:
-            {
-                return Type().construct<_Tp>();
-            }
+        if (count == 0)
+        {
+            point = 0;
         }
     }
 
-public:
+    constexpr void left_shift(int __shift) noexcept
+    {
+        // Writes from the back, leaving room for at most shift * log10(2) + 1 new digits.
+        int write = count + __shift * 30103 / 100000 + 1;
 
-    using size_type = detail::return_type_of_t<decltype(&std::type_info::hash_code)>;
+        const int end = write;
 
-    static_assert(sizeof(size_type) == sizeof(void*));
+        std::uint64_t n = 0;
 
-    /**
-     * @brief Initializes all member variables to default values.
-     */
-    constexpr Type() noexcept
-        : _M_hash(0), _M_size(0), _M_next(nullptr)
-        , _M_rank(0)
-        , _M_is_lvalue_ref(0)
-        , _M_is_rvalue_ref(0)
-        , _M_is_const(0)
-        , _M_is_volatile(0)
-        , _M_is_signed(0)
-        , _M_is_unsigned(0)
-        , _M_is_integral(0)
-        , _M_is_floating_point(0)
-        , _M_is_char(0)
-        , _M_is_enum(0)
-        , _M_is_class(0)
-        , _M_is_union(0)
-        , _M_is_pointer(0)
-        , _M_is_null_pointer(0)
-        , _M_is_char_pointer(0)
-        , _M_is_function(0)
-        , _M_is_member_function(0)
-        , _M_is_member_object(0)
-        , _M_is_array(0)
-        , _M_is_bounded_array(0)
-        , _M_is_std_array(0)
-        , _M_is_std_vector(0)
-        , _M_is_std_string(0)
-        , _M_is_std_string_view(0)
-        , _M_is_std_pair(0)
-        , _M_is_pair_like(0)
-        , _M_is_std_tuple(0)
-        , _M_is_tuple_like(0)
-        , _M_is_iterable(0)
-        , _M_is_insertable(0)
-        , _M_has_value_type(0)
-        , _M_has_data(0)
-    { }
+        for (int read = count - 1; read >= 0; --read)
+        {
+            n += static_cast<std::uint64_t>(digits[read]) << __shift;
 
-    /**
-     * @brief  Constructs the Type object based on the provided type.
-     * 
-     * @tparam _Tp The type to construct the Type object for.
-     * 
-     * @return Reference to the constructed Type object (*this).
-     */
-    template<typename _Tp>
-    constexpr Type& construct() noexcept
-    {
-        using type = detail::remove_cv_pair_t<detail::remove_reference_cv_t<_Tp>>;
+            const std::uint64_t quotient = n / 10;
 
-        _M_hash = typeid(type).hash_code();
-        _M_size = detail::size_of_v<type>;
-        _M_next = &Type::_S_nextType<type>;
-        _M_name = detail::type_name<_Tp>();
+            digits[--write] = static_cast<std::uint8_t>(n - 10 * quotient);
+            n = quotient;
+        }
 
-        _M_rank               = detail::rank_v<type>;
+        for (; n > 0; n /= 10)
+        {
+            digits[--write] = static_cast<std::uint8_t>(n % 10);
+        }
 
-        _M_is_lvalue_ref      = std::is_lvalue_reference_v<_Tp>;
-        _M_is_rvalue_ref      = std::is_rvalue_reference_v<_Tp>;
+        point += (end - write) - count;
+        count = end - write;
 
-        _M_is_const           = std::is_const_v<std::remove_reference_t<_Tp>>;
-        _M_is_volatile        = std::is_volatile_v<std::remove_reference_t<_Tp>>;
-        
-        _M_is_signed          = detail::is_signed_v<type>;
-        _M_is_unsigned        = detail::is_unsigned_v<type>;
-        _M_is_integral        = std::is_integral_v<type>;
-        _M_is_floating_point  = std::is_floating_point_v<type>;
-        _M_is_char            = detail::is_char_v<type>;
-        _M_is_enum            = std::is_enum_v<type>;
-        
-        _M_is_class           = std::is_class_v<type>;
-        _M_is_union           = std::is_union_v<type>;
-        _M_is_pointer         = detail::is_pointer_v<type>;
-        _M_is_null_pointer    = std::is_null_pointer_v<type>;
-        _M_is_char_pointer    = detail::is_char_pointer_v<type>;
-        _M_is_function        = std::is_function_v<type>;
-        _M_is_member_function = std::is_member_function_pointer_v<type>;
-        _M_is_member_object   = std::is_member_object_pointer_v<type>;
+        for (int i = 0; i < count; ++i)
+        {
+            digits[i] = digits[write + i];
+        }
 
-        _M_is_array           = std::is_array_v<type>;
-        _M_is_bounded_array   = detail::is_bounded_array_v<type>;
-        _M_is_std_array       = detail::is_std_array_v<type>;
-        _M_is_std_vector      = detail::is_std_vector_v<type>;
-        _M_is_std_string      = detail::is_std_string_v<type>;
-        _M_is_std_string_view = detail::is_std_string_view_v<type>;
-        _M_is_std_pair        = detail::is_std_pair_v<type>;
-        _M_is_pair_like       = detail::is_pair_like_v<type>;
-        _M_is_std_tuple       = detail::is_std_tuple_v<type>;
-        _M_is_tuple_like      = detail::is_tuple_like_v<type>;
+        if (count > max_digits)
+        {
+            for (int i = max_digits; i < count; ++i)
+            {
+                truncated |= (digits[i] != 0);
+            }
 
-        _M_is_iterable        = detail::is_iterable_v<type>;
-        _M_is_insertable      = detail::is_insertable_container_v<type>;
-        _M_has_value_type     = detail::has_container_value_type_v<type>;
-        _M_has_data           = detail::has_container_data_v<type>;
+            count = max_digits;
+        }
 
-        return *this;
+        trim();
     }
 
-    /**
-     * @brief  Checks whether the current Type matches the provided type.
-     * 
-     * @tparam _Tp The type to compare against.
-     * 
-     * @return True if the types match, false otherwise.
-     */
-    template<typename _Tp>
-    [[nodiscard]] constexpr bool isSameAs() const noexcept
-    { return _M_hash == typeid(detail::remove_cv_pair_t<detail::remove_reference_cv_t<_Tp>>).hash_code(); }
-
-    /**
-     * @brief  Checks whether the current Type matches any of the provided types.
-     * 
-     * @tparam _Args The types to compare against.
-     * 
-     * @return True if the Type matches any of the provided types, false otherwise.
-     */
-    template<typename... _Args>
-    [[nodiscard]] constexpr bool isAnyOf() const noexcept
+    constexpr void right_shift(int __shift) noexcept
     {
-        if constexpr (sizeof...(_Args) == 0)
+        int read = 0, write = 0;
+
+        std::uint64_t n = 0;
+
+        for (; (n >> __shift) == 0; ++read)
         {
-            return false;
+            if (read >= count)
+            {
+                if (n == 0)
+                {
+                    count = 0;
+                    return;
+                }
+
+                for (; (n >> __shift) == 0; ++read)
+                {
+                    n *= 10;
+                }
+
+                break;
+            }
+
+            n = n * 10 + digits[read];
         }
-        else
+
+        point -= read - 1;
+
+        const std::uint64_t mask = (1ULL << __shift) - 1;
+
+        for (; read < count; ++read)
         {
-            return (... || isSameAs<_Args>());
+            digits[write++] = static_cast<std::uint8_t>(n >> __shift);
+            n = (n & mask) * 10 + digits[read];
         }
-    }
 
+        for (; n > 0; n = (n & mask) * 10)
+        {
+            if (write < max_digits)
+            {
+                digits[write++] = static_cast<std::uint8_t>(n >> __shift);
+            }
+            else if ((n >> __shift) > 0)
+            {
+                truncated = true;
+            }
+        }
 
-    [[nodiscard]] constexpr bool operator==(const Type& __other) const noexcept
-    { return _M_hash == __other._M_hash; }
+        count = write;
 
-    [[nodiscard]] constexpr bool operator!=(const Type& __other) const noexcept
-    { return _M_hash != __other._M_hash; }
+        trim();
+    }
 
-    [[nodiscard]] constexpr bool operator<(const Type& __other) const noexcept
-    { return _M_size < __other._M_size; }
+    constexpr void shift(int __shift) noexcept
+    {
+        if (count == 0)
+        {
+            return;
+        }
 
-    [[nodiscard]] constexpr bool operator<=(const Type& __other) const noexcept
-    { return _M_size <= __other._M_size; }
+        for (; __shift > max_shift; __shift -= max_shift)
+        {
+            left_shift(max_shift);
+        }
 
-    [[nodiscard]] constexpr bool operator>(const Type& __other) const noexcept
-    { return _M_size > __other._M_size; }
+        for (; __shift < -max_shift; __shift += max_shift)
+        {
+            right_shift(max_shift);
+        }
 
-    [[nodiscard]] constexpr bool operator>=(const Type& __other) const noexcept
-    { return _M_size >= __other._M_size; }
-
-    /**
-     * @brief  Converts the Type object to its hash code.
-     * 
-     * @return The hash code of the Type.
-     */
-    [[nodiscard]] constexpr operator size_type() const noexcept
-    { return _M_hash; }
-
-    /**
-     * @brief  Checks whether the Type object has been constructed.
-     * 
-     * @return True if the Type object is constructed, false otherwise.
-     */
-    [[nodiscard]] constexpr operator bool() const noexcept
-    { return !_M_name.empty(); }
-
-    /**
-     * @brief  Retrieves the hash code of the Type.
-     * 
-     * @return The hash code of the Type.
-     */
-    [[nodiscard]] constexpr size_type hashCode() const noexcept
-    { return _M_hash; }
-
-     /**
-     * @brief  Retrieves the size of the Type.
-     * 
-     * @return The size of the Type in bytes.
-     */
-    [[nodiscard]] constexpr size_type size() const noexcept
-    { return _M_size; }
-
-    /**
-     * @brief  Retrieves the rank of the Type.
-     * 
-     * @return The rank of the Type.
-     */
-    [[nodiscard]] constexpr size_type rank() const noexcept
-    { return _M_rank; }
+        if (__shift > 0)
+        {
+            left_shift(__shift);
+        }
+        else if (__shift < 0)
+        {
+            right_shift(-__shift);
+        }
+    }
 
+    [[nodiscard]] constexpr std::uint64_t rounded_integer() const noexcept
+    {
+        if (point > 20)
+        {
+            return ~0ULL;
+        }
 
-    [[nodiscard]] constexpr bool isReference() const noexcept
-    { return _M_is_lvalue_ref || _M_is_rvalue_ref; }
+        std::uint64_t n = 0;
 
-    [[nodiscard]] constexpr bool isLeftValueReference() const noexcept
-    { return _M_is_lvalue_ref; }
+        int i = 0;
 
-    [[nodiscard]] constexpr bool isRightValueReference() const noexcept
-    { return _M_is_rvalue_ref; }
+        for (; i < point && i < count; ++i)
+        {
+            n = n * 10 + digits[i];
+        }
 
+        for (; i < point; ++i)
+        {
+            n *= 10;
+        }
 
-    [[nodiscard]] constexpr bool isConst() const noexcept
-    { return _M_is_const; }
+        if (point >= 0 && point < count)
+        {
+            // Exactly halfway rounds to even, unless nonzero digits were dropped.
+            if (digits[point] == 5 && point + 1 == count)
+            {
+                n += (truncated || (point > 0 && digits[point - 1] % 2 != 0));
+            }
+            else
+            {
+                n += (digits[point] >= 5);
+            }
+        }
 
-    [[nodiscard]] constexpr bool isVolatile() const noexcept
-    { return _M_is_volatile; }
+        return n;
+    }
+};
 
-    [[nodiscard]] constexpr bool isSigned() const noexcept
-    { return _M_is_signed; }
 
-    [[nodiscard]] constexpr bool isUnsigned() const noexcept
-    { return _M_is_unsigned; }
+/**
+ * @brief Correctly rounded conversion of the digits in [__first, __last) (with an optional '.')
+ *        times 10^__exponent, by simple decimal conversion.
+ */
+template<typename _Tp>
+[[nodiscard]] constexpr adjusted_mantissa compute_float_slow(const char* __first, const char* __last, std::int64_t __exponent) noexcept
+{
+    return with_scratch<big_decimal>([=](big_decimal& __decimal) constexpr noexcept -> adjusted_mantissa {
+        using binary = binary_format<_Tp>;
 
-    [[nodiscard]] constexpr bool isIntegral() const noexcept
-    { return _M_is_integral; }
+        constexpr int bias = binary::minimum_exponent;
 
-    [[nodiscard]] constexpr bool isIntegralOrEnum() const noexcept
-    { return _M_is_integral || _M_is_enum; }
+        __decimal.assign(__first, __last, __exponent);
 
-    [[nodiscard]] constexpr bool isFloatingPoint() const noexcept
-    { return _M_is_floating_point; }
+        adjusted_mantissa answer;
 
-    [[nodiscard]] constexpr bool isCharacter() const noexcept
-    { return _M_is_char; }
+        if (__decimal.count == 0 || __decimal.point < -330)
+        {
+            return answer;
+        }
 
-    [[nodiscard]] constexpr bool isEnum() const noexcept
-    { return _M_is_enum; }
+        if (__decimal.point > 310)
+        {
+            answer.power2 = binary::infinite_power;
+            return answer;
+        }
 
-    [[nodiscard]] constexpr bool isClass() const noexcept
-    { return _M_is_class; }
+        // Number of bits that 10^i, i < 9, is guaranteed to exceed.
+        constexpr int shifts[] = { 1, 3, 6, 9, 13, 16, 19, 23, 26 };
 
-    [[nodiscard]] constexpr bool isStruct() const noexcept
-    { return _M_is_class; }
+        int exponent = 0;
 
-    [[nodiscard]] constexpr bool isUnion() const noexcept
-    { return _M_is_union; }
+        // Scale into [0.5, 1).
+        while (__decimal.point > 0)
+        {
+            const int n = __decimal.point < 9 ? shifts[__decimal.point] : 27;
 
-    [[nodiscard]] constexpr bool isPointer() const noexcept
-    { return _M_is_pointer; }
+            __decimal.shift(-n);
+            exponent += n;
+        }
 
-    [[nodiscard]] constexpr bool isNullPointer() const noexcept
-    { return _M_is_null_pointer; }
+        while (__decimal.point < 0 || (__decimal.point == 0 && __decimal.digits[0] < 5))
+        {
+            const int n = -__decimal.point < 9 ? shifts[-__decimal.point] : 27;
 
-    [[nodiscard]] constexpr bool isCharacterPointer() const noexcept
-    { return _M_is_char_pointer; }
+            __decimal.shift(n);
+            exponent -= n;
+        }
 
-    [[nodiscard]] constexpr bool isFunction() const noexcept
-    { return _M_is_function; }
+        // [0.5, 1) -> [1, 2)
+        --exponent;
 
-    [[nodiscard]] constexpr bool isMemberFunctionPointer() const noexcept
-    { return _M_is_member_function; }
+        if (exponent < bias + 1)
+        {
+            __decimal.shift(exponent - (bias + 1));
+            exponent = bias + 1;
+        }
 
-    [[nodiscard]] constexpr bool isMemberObjectPointer() const noexcept
-    { return _M_is_member_object; }
+        if (exponent - bias >= binary::infinite_power)
+        {
+            answer.power2 = binary::infinite_power;
+            return answer;
+        }
 
-    [[nodiscard]] constexpr bool isArray() const noexcept
-    { return _M_is_array; }
+        __decimal.shift(binary::mantissa_explicit_bits + 1);
 
-    [[nodiscard]] constexpr bool isBoundedArray() const noexcept
-    { return _M_is_bounded_array; }
+        std::uint64_t mantissa = __decimal.rounded_integer();
 
-    [[nodiscard]] constexpr bool isUnboundedArray() const noexcept
-    { return _M_is_array && !_M_is_bounded_array; }
+        if (mantissa == (2ULL << binary::mantissa_explicit_bits))
+        {
+            mantissa >>= 1;
 
-    [[nodiscard]] constexpr bool isStdArray() const noexcept
-    { return _M_is_std_array; }
+            if (++exponent - bias >= binary::infinite_power)
+            {
+                answer.power2 = binary::infinite_power;
+                return answer;
+            }
+        }
 
-    [[nodiscard]] constexpr bool isStdVector() const noexcept
-    { return _M_is_std_vector; }
+        if ((mantissa & (1ULL << binary::mantissa_explicit_bits)) == 0)
+        {
+            exponent = bias;
+        }
 
-    [[nodiscard]] constexpr bool isStdString() const noexcept
-    { return _M_is_std_string; }
+        answer.mantissa = mantissa & ((1ULL << binary::mantissa_explicit_bits) - 1);
+        answer.power2 = exponent - bias;
 
-    [[nodiscard]] constexpr bool isStdStringView() const noexcept
-    { return _M_is_std_string_view; }
+        return answer;
+    });
+}
 
-    [[nodiscard]] constexpr bool isStdPair() const noexcept
-    { return _M_is_std_pair; }
 
-    [[nodiscard]] constexpr bool isPairLike() const noexcept
-    { return _M_is_pair_like; }
+template<typename _Tp>
+[[nodiscard]] constexpr _Tp make_floating_point(adjusted_mantissa __am, bool __negative) noexcept
+{
+    using binary = binary_format<_Tp>;
+    using bits_type = typename binary::bits_type;
 
-    [[nodiscard]] constexpr bool isStdTuple() const noexcept
-    { return _M_is_std_tuple; }
+    if (is_constant_evaluated())
+    {
+        _Tp result = std::numeric_limits<_Tp>::infinity();
 
-    [[nodiscard]] constexpr bool isTupleLike() const noexcept
-    { return _M_is_tuple_like; }
+        if (__am.power2 != binary::infinite_power)
+        {
+            const std::uint64_t significand = (__am.power2 == 0 ? __am.mantissa : __am.mantissa | (1ULL << binary::mantissa_explicit_bits));
 
-    [[nodiscard]] constexpr bool isIterable() const noexcept
-    { return _M_is_iterable; }
+            int exponent = (__am.power2 == 0 ? 1 : __am.power2) + binary::minimum_exponent - binary::mantissa_explicit_bits;
 
-    [[nodiscard]] constexpr bool isInsertable() const noexcept
-    { return _M_is_insertable; }
+            // Every step is exact, since the final value is representable.
+            constexpr auto step = static_cast<_Tp>(1ULL << 60);
 
-    /**
-     * @brief  Checks whether the Type has a value_type.
-     * 
-     * @return True if the Type has a value_type, false otherwise.
-     */
-    [[nodiscard]] constexpr bool hasValueType() const noexcept
-    { return _M_has_value_type; }
+            result = static_cast<_Tp>(significand);
 
-    /**
-     * @brief  Checks whether the Type has a data member.
-     * 
-     * @return True if the Type has a data member, false otherwise.
-     */
-    [[nodiscard]] constexpr bool hasData() const noexcept
-    { return _M_has_data; }
+            for (; exponent > 60; exponent -= 60) result *= step;
+            for (; exponent < -60; exponent += 60) result /= step;
 
+            if (exponent >= 0)
+            {
+                result *= static_cast<_Tp>(1ULL << exponent);
+            }
+            else
+            {
+                result /= static_cast<_Tp>(1ULL << -exponent);
+            }
+        }
 
-    [[nodiscard]] constexpr Type underlyingType() const noexcept
-    { return _M_next(NextTypeFlag::Underlying); }
+        return __negative ? -result : result;
+    }
+    else
+    {
+        bits_type bits = static_cast<bits_type>(__am.mantissa)
+                | static_cast<bits_type>(static_cast<bits_type>(__am.power2) << binary::mantissa_explicit_bits);
 
-    [[nodiscard]] constexpr Type promoteNumericType() const noexcept
-    { return _M_next(NextTypeFlag::PromoteNumeric); }
+        if (__negative)
+        {
+            bits |= static_cast<bits_type>(static_cast<bits_type>(1) << (sizeof(bits_type) * 8 - 1));
+        }
 
-    [[nodiscard]] constexpr Type valueType() const noexcept
-    { return _M_next(NextTypeFlag::ValueType); }
+        _Tp result{};
+        std::memcpy(&result, &bits, sizeof(result));
 
-    [[nodiscard]] constexpr Type dereferencedIteratorType() const noexcept
-    { return _M_next(NextTypeFlag::DereferencedIterator); }
+        return result;
+    }
+}
 
-    [[nodiscard]] constexpr Type dereferenceType() const noexcept
-    { return _M_next(NextTypeFlag::Dereference); }
 
-    [[nodiscard]] constexpr Type returnValueType() const noexcept
-    { return _M_next(NextTypeFlag::ReturnValue); }
+template<typename _Tp>
+[[nodiscard]] constexpr auto string_to_floating_point(std::string_view __str)  noexcept
+        -> std::enable_if_t<std::is_floating_point_v<std::remove_reference_t<_Tp>>, std::remove_reference_t<_Tp>>
+{
+    using result_type = remove_reference_cv_t<_Tp>;
 
-    [[nodiscard]] constexpr Type iteratorType() const noexcept
-    { return _M_next(NextTypeFlag::Iterator); }
+    constexpr auto zero = static_cast<result_type>(0);
+    constexpr auto one  = static_cast<result_type>(1);
+    constexpr auto ten  = static_cast<result_type>(10);
 
-    /**
-     * @brief  Retrieves the first type of the Type if it is tuple-like.
-     * 
-     * @return The first Type.
-     */
-    [[nodiscard]] constexpr Type firstType() const noexcept
-    { return _M_next(NextTypeFlag::PairFirstType); }
 
-    /**
-     * @brief  Retrieves the second type of the Type if it is tuple-like.
-     * 
-     * @return The second Type.
-     */
-    [[nodiscard]] constexpr Type secondType() const noexcept
-    { return _M_next(NextTypeFlag::PairSecondType); }
+    if (string_view_trimmed(__str), __str.empty())
+    {
+        return zero;
+    }
 
-private:
 
-    size_type _M_hash;
-    size_type _M_size;
+    bool negative = false;
 
-    Type (*_M_next)(NextTypeFlag);
-    std::string_view _M_name;
+    auto $ = [&negative](result_type __value) constexpr noexcept -> result_type { return negative ? -__value : __value; };
 
-    size_type _M_rank               : 4;
+    if (__str.front() == '-')
+    {
+        negative = true;
+        __str.remove_prefix(1);
+    }
+    else if (__str.front() == '+')
+    {
+        __str.remove_prefix(1);
+    }
 
-    size_type _M_is_lvalue_ref      : 1;
-    size_type _M_is_rvalue_ref      : 1;
 
-    size_type _M_is_const           : 1;
-    size_type _M_is_volatile        : 1;
+    if (string_view_left_trimmed(__str), __str.empty())
+    {
+        return zero;
+    }
 
-    size_type _M_is_signed          : 1;
-    size_type _M_is_unsigned        : 1;
-    size_type _M_is_integral        : 1;
-    size_type _M_is_floating_point  : 1;
-    size_type _M_is_char            : 1;
-    size_type _M_is_enum            : 1;
 
-    size_type _M_is_class           : 1;
-    size_type _M_is_union           : 1;
-    size_type _M_is_pointer         : 1;
-    size_type _M_is_null_pointer    : 1;
-    size_type _M_is_char_pointer    : 1;
-    size_type _M_is_function        : 1;
-    size_type _M_is_member_function : 1;
-    size_type _M_is_member_object   : 1;
-
-    size_type _M_is_array           : 1;
-    size_type _M_is_bounded_array   : 1;
-    size_type _M_is_std_array       : 1;
-    size_type _M_is_std_vector      : 1;
-    size_type _M_is_std_string      : 1;
-    size_type _M_is_std_string_view : 1;
-    size_type _M_is_std_pair        : 1;
-    size_type _M_is_pair_like       : 1;
-    size_type _M_is_std_tuple       : 1;
-    size_type _M_is_tuple_like      : 1;
-
-    size_type _M_is_iterable        : 1;
-    size_type _M_is_insertable      : 1;
-    size_type _M_has_value_type     : 1;
-    size_type _M_has_data           : 1;
-};
-
-
-class KwargsKey
-{
-public:
-
-    using value_type = detail::string_hash_type;
-    using ValueType  = value_type;
-
-    constexpr KwargsKey() = default;
+    if (is_same_string_ignore_case(__str, "inf") || is_same_string_ignore_case(__str, "infinity"))
+    {
+        return $(std::numeric_limits<result_type>::infinity());
+    }
+    else if (is_same_string_ignore_case(__str, "nan"))
+    {
+        return $(std::numeric_limits<result_type>::quiet_NaN());
+    }
+    else if (is_same_string_ignore_case(__str, "max"))
+    {
+        return $(std::numeric_limits<result_type>::max());
+    }
+    else if (is_same_string_ignore_case(__str, "min"))
+    {
+        return $(std::numeric_limits<result_type>::min());
+    }
+    else if (is_same_string_ignore_case(__str, "pi"))
+    {
+#if defined(_KWARGS_HAS_FLOAT128)
+        return $(static_cast<result_type>(3.141592653589793238462643383279502884L));
+#else
+        return $(static_cast<result_type>(3.141592653589793));
+#endif
+    }
+    else if (is_same_string_ignore_case(__str, "e"))
+    {
+#if defined(_KWARGS_HAS_FLOAT128)
+        return $(static_cast<result_type>(2.718281828459045235360287471352662498L));
+#else
+        return $(static_cast<result_type>(2.718281828459045));
+#endif
+    }
 
-    template<std::size_t _Size>
-    constexpr KwargsKey(const char (&__str)[_Size]) noexcept
-        : KwargsKey(__str, _Size - 1)
-    { }
 
-    /// @note It does not need to contains '\0' at the end.
-    constexpr KwargsKey(const char* const __str, std::size_t __size) noexcept
-        : _M_key(detail::string_hash_string(__str, __size))
-    { }
+    if constexpr (std::numeric_limits<result_type>::is_iec559
+                  && (std::numeric_limits<result_type>::digits == 24 || std::numeric_limits<result_type>::digits == 53))
+    {
+        using engine_type = std::conditional_t<std::numeric_limits<result_type>::digits == 24, float, double>;
 
-    constexpr explicit KwargsKey(value_type __option) noexcept
-        : _M_key(__option)
-    { }
+        const char* it = __str.data();
+        const char* const last = __str.data() + __str.size();
 
-    constexpr KwargsKey(const class KwargsKeyLiteral& __literal) noexcept;
+        const char* const digits_first = it;
 
-    [[nodiscard]] constexpr value_type value() const noexcept
-    { return _M_key; }
+        // At most 19 significant digits go into mantissa; value = mantissa * 10^exponent.
+        std::uint64_t mantissa = 0;
+        std::int64_t exponent = 0;
 
-    [[nodiscard]] constexpr operator value_type() const noexcept
-    { return _M_key; }
+        int  significant = 0;
+        bool truncated = false;
+        bool has_digits = false;
 
-    [[nodiscard]] constexpr bool operator==(KwargsKey __other) const noexcept
-    { return _M_key == __other._M_key; }
+        auto take_digits = [&](bool __fractional) constexpr noexcept -> void
+        {
+            for (; it != last; ++it)
+            {
+                if (is_constant_evaluated() == false && mantissa != 0 && significant <= 19 - 8 && last - it >= 8)
+                {
+                    std::uint64_t chunk = 0;
+                    std::uint32_t value = 0;
 
-    [[nodiscard]] constexpr bool operator!=(KwargsKey __other) const noexcept
-    { return _M_key != __other._M_key; }
+                    std::memcpy(&chunk, it, sizeof(chunk));
 
-    [[nodiscard]] constexpr bool operator<(KwargsKey __other) const noexcept
-    { return _M_key < __other._M_key; }
+                    if (_KWARGS_LITTLE_ENDIAN && swar_parse_8_digits(chunk, value))
+                    {
+                        mantissa = mantissa * 100'000'000U + value;
+                        significant += 8;
+                        exponent -= (__fractional ? 8 : 0);
 
-    [[nodiscard]] constexpr bool operator>(KwargsKey __other) const noexcept
-    { return _M_key > __other._M_key; }
+                        it += 7;
+                        continue;
+                    }
+                }
 
-    [[nodiscard]] constexpr bool operator<=(KwargsKey __other) const noexcept
-    { return _M_key <= __other._M_key; }
+                const auto digit = static_cast<unsigned char>(*it - '0');
 
-    [[nodiscard]] constexpr bool operator>=(KwargsKey __other) const noexcept
-    { return _M_key >= __other._M_key; }
+                if (digit >= 10)
+                {
+                    break;
+                }
 
+                has_digits = true;
 
-    /// @brief Multiple KwargsKeys can be joined using the `or` operator.
-    [[nodiscard]] friend constexpr std::array<KwargsKey, 2>
-        operator||(KwargsKey __first, KwargsKey __second) noexcept
-    { return {{__first, __second}}; }
+                if (mantissa == 0 && digit == 0)
+                {
+                    // Leading zeros.
+                    exponent -= __fractional;
+                }
+                else if (significant < 19)
+                {
+                    mantissa = mantissa * 10 + digit;
+                    ++significant;
+                    exponent -= __fractional;
+                }
+                else
+                {
+                    truncated |= (digit != 0);
+                    exponent += (__fractional == false);
+                }
+            }
+        };
 
-    template<std::size_t _StringSize>
-    [[nodiscard]] friend constexpr std::array<KwargsKey, 2>
-        operator||(KwargsKey __first, const char (&__second)[_StringSize]) noexcept
-    { return {{__first, KwargsKey(__second)}}; }
+        take_digits(false);
 
-    template<std::size_t _Size>
-    [[nodiscard]] friend constexpr std::array<KwargsKey, _Size + 1>
-        operator||(const std::array<KwargsKey, _Size>& __first, KwargsKey __second) noexcept
-    {
-        std::array<KwargsKey, _Size + 1> res;
-        detail::copy(__first.begin(), __first.end(), res.begin());
-        res.back() = __second;
-        return res;
-    }
+        if (it != last && *it == '.')
+        {
+            ++it;
+            take_digits(true);
+        }
 
-    template<std::size_t _Size, std::size_t _StringSize>
-    [[nodiscard]] friend constexpr std::array<KwargsKey, _Size + 1>
-        operator||(const std::array<KwargsKey, _Size>& __first, const char (&__second)[_StringSize]) noexcept
-    {
-        std::array<KwargsKey, _Size + 1> res;
-        detail::copy(__first.begin(), __first.end(), res.begin());
-        res.back() = KwargsKey(__second);
-        return res;
-    }
+        if (has_digits == false)
+        {
+            return $(zero);
+        }
 
-private:
+        const char* const digits_last = it;
 
-    value_type _M_key = 0;
-};
+        std::int64_t explicit_exponent = 0;
 
+        if (it != last && is_same_char_ignore_case(*it, 'e') && ++it != last)
+        {
+            const bool negative_exponent = (*it == '-');
 
-class KwargsValue
-{
-public:
+            if (*it == '-' || *it == '+')
+            {
+                ++it;
+            }
 
-    enum ValueTag : std::int32_t
-    {
-        PointerFlag = 0,
-        ValueFlag,
-        AppliedFlag
-    };
+            for (; it != last && static_cast<unsigned char>(*it - '0') < 10; ++it)
+            {
+                if (explicit_exponent < 0x1000'0000)
+                {
+                    explicit_exponent = explicit_exponent * 10 + (*it - '0');
+                }
+            }
 
-    template<typename _Tp>
-    static constexpr ValueTag checkTag() noexcept
-    {
-        if constexpr (
-            std::disjunction_v<
-                detail::is_integral_or_enum<_Tp>,
-                detail::is_pointer<_Tp>,
-                std::is_array<std::remove_reference_t<_Tp>>,
-                std::is_floating_point<std::remove_reference_t<_Tp>>> &&
-            detail::size_of_v<std::decay_t<_Tp>> <= sizeof(void*))
-        {
-            return ValueFlag;
-        }
-        else if constexpr (std::is_lvalue_reference_v<_Tp>)
-        {
-            return PointerFlag;
+            explicit_exponent = negative_exponent ? -explicit_exponent : explicit_exponent;
         }
-        else
+
+        if (mantissa == 0)
         {
-            static_assert(std::disjunction_v<std::is_rvalue_reference<_Tp>, std::negation<std::is_reference<_Tp>>>);
-            return AppliedFlag;
+            return $(zero);
         }
-    }
-
-protected:
 
-    template<typename _Tp>
-    void _M_place(_Tp&& __value) noexcept
-    {
-        constexpr auto tag = checkTag<_Tp&&>();
+        exponent += explicit_exponent;
 
-        if constexpr (tag == ValueFlag)
+#if !defined(FLT_EVAL_METHOD) || FLT_EVAL_METHOD == 0
+        // Both the mantissa and the power of ten are exact, so a single operation rounds correctly.
+        if (truncated == false
+            && mantissa <= (2ULL << binary_format<engine_type>::mantissa_explicit_bits)
+            && exponent >= -binary_format<engine_type>::max_exponent_fast_path
+            && exponent <= binary_format<engine_type>::max_exponent_fast_path)
         {
-            _M_data._M_value = 0;
-
-            auto ptr = detail::pointer_cast<std::byte*>(std::addressof(__value));
+            auto value = static_cast<engine_type>(mantissa);
 
-            for (std::size_t i = 0; i < sizeof(_Tp); ++i, ++ptr)
+            if (exponent < 0)
             {
-                _M_data._M_bytes[i] = *ptr;
+                value /= power10<engine_type>(-exponent);
+            }
+            else
+            {
+                value *= power10<engine_type>(exponent);
             }
-        }
-        else if constexpr (tag == AppliedFlag)
-        {
-            _M_data._M_ptr = new (std::nothrow) _Tp(std::move(__value));
 
+            return $(static_cast<result_type>(value));
         }
-        else if constexpr (tag == PointerFlag)
+#endif
+
+        adjusted_mantissa am = compute_float<engine_type>(exponent, mantissa);
+
+        // The dropped digits lie between mantissa and mantissa + 1; if both round alike, so does the input.
+        if (truncated && am != compute_float<engine_type>(exponent, mantissa + 1))
         {
-            _M_data._M_ptr = detail::pointer_cast<void*>(std::addressof(__value));
+            am = compute_float_slow<engine_type>(digits_first, digits_last, explicit_exponent);
         }
-    }
 
-protected:
-
-    enum WorkFlags : std::int32_t
+        return static_cast<result_type>(make_floating_point<engine_type>(am, negative));
+    }
+    else
     {
-        DoGetTag,             // [unused]                      , ValueTag*
-        DoApplyAndCopy,       // type*                         , type**
-        DoFree,               // type*                         , [unused]
-        DoCompareEqual,       // std::pair<this, KwargsValue*>*, bool*
-        DoGetType,            // [unused]                      , Type*
-        DoGetUnderlyingType,  // [unused]                      , Type*
-        DoGetBeginIterator,   // this                          , iterator**
-        DoGetBeginValue,      // this                          , value_type*
-        DoGetBeginAnyValue,   // this                          , KwargsValue*
-        DoGetContainerSize,   // this                          , std::size_t*
-        DoGetContainerData,   // this                          , value_type**
-        DoIterate,            // std::pair<this, iterator**>*  , value_type*
-        DoIterateAny,         // std::pair<this, iterator**>*  , KwargsValue*
-        DoEndIteration,       // iterator*                     , [unused]
-        DoGetPairFirst,       // this                          , KwargsValue*
-        DoGetPairSecond       // this                          , KwargsValue*
-    };
+        result_type result = zero;
 
-    template<typename _Tp>
-    static constexpr void _S_manage(WorkFlags __work, void* __inData, void* __outData)
-    {
-        using type = detail::enum_underlying_type_t<detail::remove_reference_cv_t<_Tp>>;
+        std::size_t i = 0;
 
-        static_assert(std::negation_v<std::is_void<type>>);
+        for (; i < __str.size() && __str[i] >= '0' && __str[i] <= '9'; ++i)
+        {
+            result = result * ten + static_cast<result_type>(__str[i] - '0');
+        }
 
-        switch (__work)
+
+        if (i < __str.size() && __str[i] == '.' && (++i, true))
         {
-            case DoGetTag:
+            result_type fractional_part = zero;
+        
+            result_type power = one;
+
+            for (; i < __str.size() && __str[i] >= '0' && __str[i] <= '9'; ++i, power *= 10)
             {
-               *detail::pointer_cast<ValueTag*>(__outData) = checkTag<_Tp>();
-                break;
+                fractional_part = fractional_part * ten + static_cast<result_type>(__str[i] - '0');
             }
+        
+            result += fractional_part / power;
+        }
 
-            case DoApplyAndCopy:
-            {
-                if constexpr (std::negation_v<std::is_array<type>>)
-                {
-                    type*  iptr = detail::pointer_cast<type*>(__inData);
-                    type** optr = detail::pointer_cast<type**>(__outData);
 
-                    *optr = new type(*iptr);
-                }
+        if (i < __str.size() && is_same_char_ignore_case(__str[i], 'e') && ++i < __str.size())
+        {
+            auto exponent = string_to_integer<std::int64_t>(__str.substr(i));
 
-                break;
-            }
+            // Apply exponents beyond the power10 table in steps; stops once the result saturates.
+            constexpr std::int64_t step = std::numeric_limits<result_type>::max_exponent10;
 
-            case DoFree:
+            for (; exponent > step && result != zero && result != std::numeric_limits<result_type>::infinity(); exponent -= step)
             {
-                if constexpr (std::negation_v<std::is_array<type>>)
-                {
-                    delete detail::pointer_cast<type*>(__inData);
-                }
-
-                break;
+                result *= power10<result_type>(step);
             }
 
-            case DoCompareEqual:
+            for (; exponent < -step && result != zero; exponent += step)
             {
-                auto optr = detail::pointer_cast<bool*>(__outData);
-
-                if constexpr (detail::is_equality_comparable_v<type>)
-                {
-                    auto iptr = detail::pointer_cast<std::pair<KwargsValue*, KwargsValue*>*>(__inData);
-
-                    *optr = (iptr->first->value<type>() == iptr->second->value<type>());
-                }
-                else
-                {
-                    *optr = false;
-                }
-
-                break;
+                result *= power10<result_type>(-step);
             }
 
-            case DoGetType:
+            if (exponent >= -step && exponent <= step)
             {
-                *detail::pointer_cast<Type*>(__outData) = Type().construct<_Tp>();
-                break;
+                result *= power10<result_type>(exponent);
             }
+        }
 
-            case DoGetUnderlyingType:
-            {
-                *detail::pointer_cast<Type*>(__outData) = Type().construct<type>();
-                break;
-            }
+        return $(result);
+    }
+}
 
-            case DoGetBeginIterator:
-            {
-                auto iptr = detail::pointer_cast<KwargsValue*>(__inData);
-                auto optr = detail::pointer_cast<detail::container_iterator_t<type>**>(__outData);
+_KWARGS_Test_(string_to_floating_point<float>("123.123"), 123.123f);   _KWARGS_Test_(string_to_floating_point<float>("-123.123"), -123.123f);
+_KWARGS_Test_(string_to_floating_point<float>("0.520"), 0.520f);       _KWARGS_Test_(string_to_floating_point<float>("-0.1314"), -0.1314f);
+_KWARGS_Test_(string_to_floating_point<double>("0.520"), 0.520);       _KWARGS_Test_(string_to_floating_point<double>("-0.1314"), -0.1314);
+_KWARGS_Test_(string_to_floating_point<double>("0.520E4"), 0.520E4);   _KWARGS_Test_(string_to_floating_point<double>("-0.1314e10"), -0.1314e10);
+_KWARGS_Test_(string_to_floating_point<double>("0.520E-5"), 0.520E-5); _KWARGS_Test_(string_to_floating_point<double>("-0.1314e-10"), -0.1314e-10);
+_KWARGS_Test_(string_to_floating_point<double>("1e308"), 1e308);       _KWARGS_Test_(string_to_floating_point<double>("-1e308"), -1e308);
+_KWARGS_Test_(string_to_floating_point<double>("1e-308"), 1e-308);     _KWARGS_Test_(string_to_floating_point<double>("-1e-308"), -1e-308);
 
-                *optr = new detail::container_iterator_t<type>(detail::container_begin_iterator(iptr->reference<type>()));
-                break;
-            }
+_KWARGS_Test_(string_to_floating_point<double>("2.2250738585072011e-308"), 2.2250738585072011e-308);
+_KWARGS_Test_(string_to_floating_point<double>("4.9406564584124654e-324"), 4.9406564584124654e-324);
+_KWARGS_Test_(string_to_floating_point<double>("9007199254740993"), 9007199254740992.0);
+_KWARGS_Test_(string_to_floating_point<double>("9007199254740993.000000000000000000001"), 9007199254740994.0);
+_KWARGS_Test_(string_to_floating_point<float>("1.000000059604644775390625"), 1.0f);
 
-            case DoGetBeginValue:
-            {
-                using value_type = std::conditional_t<
-                    std::is_default_constructible_v<detail::remove_reference_cv_t<detail::dereferenced_iterator_t<type>>>,
-                    detail::remove_reference_cv_t<detail::dereferenced_iterator_t<type>>,
-                    detail::remove_reference_cv_t<detail::container_value_type_t<detail::remove_reference_cv_t<type>>>
-                >;
+_KWARGS_Test_(string_to_floating_point<long double>("134567890.0987654321"), 134567890.0987654321L);
+_KWARGS_Test_(string_to_floating_point<long double>("-134567890.0987654321"), -134567890.0987654321L);
 
-                auto iptr = detail::pointer_cast<KwargsValue*>(__inData);
-                auto optr = detail::pointer_cast<std::add_pointer_t<detail::remove_const_key_t<value_type>>>(__outData);
+#if defined(_KWARGS_HAS_FLOAT128)
+_KWARGS_Test_(string_to_floating_point<long double>("1e+4932"), 1e+4932L);
+_KWARGS_Test_(string_to_floating_point<long double>("1e-4932"), 1e-4932L);
+#endif
 
-                *optr = *detail::container_begin_iterator(iptr->reference<type>());
-                break;
-            }
 
-            case DoGetBeginAnyValue:
-            {
-                auto iptr = detail::pointer_cast<KwargsValue*>(__inData);
-                auto optr = detail::pointer_cast<KwargsValue*>(__outData);
+template<typename _Tp>
+[[nodiscard]] constexpr auto string_to_number(std::string_view __str) noexcept
+        -> std::enable_if_t<std::disjunction_v<is_integral_or_enum<std::remove_reference_t<_Tp>>, std::is_floating_point<std::remove_reference_t<_Tp>>>, std::remove_reference_t<_Tp>>
+{
+    using result_type = std::remove_reference_t<_Tp>;
 
-                *optr = *detail::container_begin_iterator(iptr->reference<type>());
-                break;
-            }
+    if constexpr (std::is_integral_v<result_type>)
+    {
+        return string_to_integer<result_type>(__str);
+    }
+    else
+    {
+        return string_to_floating_point<result_type>(__str);
+    }
+}
 
-            case DoGetContainerSize:
-            {
-                auto optr = detail::pointer_cast<std::size_t*>(__outData);
 
-                if constexpr (detail::has_container_size_v<type>)
-                {
-                    auto iptr = detail::pointer_cast<KwargsValue*>(__inData);
-                    *optr = static_cast<std::remove_reference_t<decltype(*optr)>>(iptr->pointer<type>()->size());
-                }
-                else if constexpr (detail::is_bounded_array_v<type>)
-                {
-                    *optr = std::extent_v<type>;
-                }
-                else if constexpr (detail::is_tuple_like_v<type>)
-                {
-                    *optr = std::tuple_size_v<type>;
-                }
-                else
-                {
-                    *optr = 1;
-                }
+[[nodiscard]] constexpr bool starts_with_word_ignore_case(const char* __first, const char* __last, std::string_view __word) noexcept
+{
+    if (static_cast<std::size_t>(__last - __first) < __word.size())
+    {
+        return false;
+    }
 
-                break;
-            }
+    for (std::size_t i = 0; i < __word.size(); ++i)
+    {
+        if (is_same_char_ignore_case(__first[i], __word[i]) == false)
+        {
+            return false;
+        }
+    }
 
-            case DoGetContainerData:
-            {
-                if constexpr (detail::has_container_data_v<type>)
-                {
-                    if constexpr (detail::is_dereferenceable_v<decltype(std::declval<type&>().data())>)
-                    {
-                        auto iptr = detail::pointer_cast<KwargsValue*>(__inData);
-                        auto optr = detail::pointer_cast<decltype(std::declval<type&>().data())*>(__outData);
+    if (__first + __word.size() == __last)
+    {
+        return true;
+    }
 
-                        *optr = iptr->pointer<type>()->data();
-                    }
-                }
+    const char next = __first[__word.size()];
 
-                break;
-            }
+    return radix_character_to_integer(next) == -1 && next != '_';
+}
 
-            case DoIterate:
-            {
-                using value_type = std::conditional_t<
-                    std::is_default_constructible_v<detail::remove_reference_cv_t<detail::dereferenced_iterator_t<type>>>,
-                    detail::remove_reference_cv_t<detail::dereferenced_iterator_t<type>>,
-                    detail::remove_reference_cv_t<detail::container_value_type_t<detail::remove_reference_cv_t<type>>>
-                >;
+_KWARGS_Test_(starts_with_word_ignore_case("max", "max" + 3, "max"));
+_KWARGS_Test_(starts_with_word_ignore_case("MAX,", "MAX," + 4, "max"));
+_KWARGS_Test_(starts_with_word_ignore_case("maximum", "maximum" + 7, "max") == false);
 
-                auto iptr = detail::pointer_cast<std::add_pointer_t<std::pair<KwargsValue*, detail::container_iterator_t<type>**>>>(__inData);
-                auto optr = detail::pointer_cast<std::add_pointer_t<detail::remove_const_key_t<value_type>>>(__outData);
 
-                if (**iptr->second == detail::container_end_iterator(iptr->first->template reference<type>()))
-                {
-                    delete *iptr->second;
-                    *iptr->second = nullptr;
-                }
-                else
-                {
-                    *optr = static_cast<detail::remove_reference_cv_t<detail::dereferenced_iterator_t<type>>>(***iptr->second);
-                    ++**iptr->second;
-                }
+/**
+ * @brief Parses an integer from [__first, __last) and reports where parsing stopped.
+ * 
+ * Accepts the same syntax as string_to_integer (leading spaces, sign, radix prefixes and
+ * keywords), but never wraps: a value that does not fit into _Tp is clamped to the nearest
+ * bound and @c __ec is set to @c std::errc::result_out_of_range.
+ * 
+ * @return Pointer to the first character not consumed, or @c __first if nothing was parsed.
+ */
+template<typename _Tp, std::enable_if_t<is_integral_or_enum_v<_Tp>, int> = 0>
+constexpr const char* parse_integer(const char* __first, const char* __last, _Tp& __value, std::errc& __ec) noexcept
+{
+    using type = std::conditional_t<
+            std::is_same_v<_Tp, bool>,
+            std::uint8_t,
+            enum_underlying_type_t<_Tp>>;
 
-                break;
-            }
+    using unsigned_type = std::make_unsigned_t<type>;
 
-            case DoIterateAny:
-            {
-                auto iptr = detail::pointer_cast<std::pair<KwargsValue*, detail::container_iterator_t<type>**>*>(__inData);
-                auto optr = detail::pointer_cast<KwargsValue*>(__outData);
+    constexpr bool is_signed = std::is_same_v<_Tp, bool> == false && std::is_signed_v<type>;
 
-                if (**iptr->second == detail::container_end_iterator(iptr->first->template reference<type>()))
-                {
-                    delete *iptr->second;
-                    *iptr->second = nullptr;
-                }
-                else
-                {
-                    *optr = ***iptr->second;
-                    ++**iptr->second;
-                }
+    constexpr auto max_value = std::is_same_v<_Tp, bool> ? type(1) : std::numeric_limits<type>::max();
+    constexpr auto min_value = std::numeric_limits<type>::min();
 
-                break;
-            }
+    const char* it = __first;
 
-            case DoEndIteration:
-            {
-                auto iptr = detail::pointer_cast<detail::container_iterator_t<type>*>(__inData);
-                delete iptr;
+    auto skip_spaces = [&it, __last]() constexpr noexcept -> void
+    {
+        for (; it != __last && is_space_character(*it); ++it);
+    };
 
-                break;
-            }
+    auto finish = [&__value, &__ec](type __result, std::errc __error = std::errc{}) constexpr noexcept -> void
+    {
+        __value = static_cast<_Tp>(__result);
+        __ec = __error;
+    };
 
-            case DoGetPairFirst:
-            {
-                if constexpr (detail::is_pair_like_v<type>)
-                {
-                    auto iptr = detail::pointer_cast<KwargsValue*>(__inData);
-                    auto optr = detail::pointer_cast<KwargsValue*>(__outData);
+    skip_spaces();
 
-                    auto& [first, second] = iptr->reference<type>();
+    bool negative = false;
 
-                    *optr = first;
-                }
-                else if constexpr (detail::is_tuple_like_v<type>)
-                {
-                    if constexpr (std::tuple_size_v<type> == 2)
-                    {
-                        auto iptr = detail::pointer_cast<KwargsValue*>(__inData);
-                        auto optr = detail::pointer_cast<KwargsValue*>(__outData);
+    if (it != __last && (*it == '+' || (is_signed && *it == '-')))
+    {
+        negative = (*it == '-');
+        ++it;
+        skip_spaces();
+    }
 
-                        auto& [first, second] = iptr->reference<type>();
+    if (it == __last)
+    {
+        __ec = std::errc::invalid_argument;
+        return __first;
+    }
 
-                        *optr = first;
-                    }
-                }
-                
-                break;
-            }
 
-            case DoGetPairSecond:
+    // Keywords never start with a digit.
+    if (static_cast<unsigned char>(*it - '0') >= 10)
+    {
+        if (starts_with_word_ignore_case(it, __last, "max"))
+        {
+            finish(negative ? type(-max_value) : max_value);
+            return it + 3;
+        }
+        else if (starts_with_word_ignore_case(it, __last, "min"))
+        {
+            if constexpr (is_signed)
             {
-                if constexpr (detail::is_pair_like_v<type>)
+                if (negative)
                 {
-                    auto iptr = detail::pointer_cast<KwargsValue*>(__inData);
-                    auto optr = detail::pointer_cast<KwargsValue*>(__outData);
+                    finish(max_value, std::errc::result_out_of_range);
+                    return it + 3;
+                }
+            }
 
-                    auto& [first, second] = iptr->reference<type>();
+            finish(min_value);
+            return it + 3;
+        }
+        else if (starts_with_word_ignore_case(it, __last, "true"))
+        {
+            finish(negative ? type(-1) : type(1));
+            return it + 4;
+        }
+        else if (starts_with_word_ignore_case(it, __last, "false"))
+        {
+            finish(type(0));
+            return it + 5;
+        }
 
-                    *optr = second;
-                }
-                else if constexpr (detail::is_tuple_like_v<type>)
-                {
-                    if constexpr (std::tuple_size_v<type> == 2)
-                    {
-                        auto iptr = detail::pointer_cast<KwargsValue*>(__inData);
-                        auto optr = detail::pointer_cast<KwargsValue*>(__outData);
+        __ec = std::errc::invalid_argument;
+        return __first;
+    }
 
-                        auto& [first, second] = iptr->reference<type>();
 
-                        *optr = second;
-                    }
-                }
-                
-                break;
+    int radix = 10;
+
+    if (__last - it >= 3 && *it == '0')
+    {
+        switch (it[1])
+        {
+            case 'b': case 'B': radix = 2;  break;
+            case 'o': case 'O': radix = 8;  break;
+            case 'x': case 'X':
+            case 'h': case 'H': radix = 16; break;
+        }
+
+        // "0x" without a digit after it is just a zero followed by 'x'.
+        if (radix != 10)
+        {
+            if (is_radix_character(it[2], radix))
+            {
+                it += 2;
+            }
+            else
+            {
+                radix = 10;
             }
         }
     }
 
-public:
 
-    constexpr KwargsValue() noexcept = default;
+    const unsigned_type limit = negative ? unsigned_type(unsigned_type(max_value) + 1U) : unsigned_type(max_value);
 
-    constexpr KwargsValue(const KwargsValue& __other) noexcept
-    {
-        if (__other.valueTag() == AppliedFlag)
-            __other._M_manager(DoApplyAndCopy, __other._M_data._M_ptr, &_M_data._M_ptr);
-        else
-            _M_data._M_value = __other._M_data._M_value;
+    unsigned_type result = 0;
 
-        _M_manager = __other._M_manager;
-    }
+    bool overflow = false;
 
-    constexpr KwargsValue(KwargsValue&& __other) noexcept
-        : _M_manager(detail::exchange(__other._M_manager, &KwargsValue::_S_manage<int>))
+    const char* const digits = it;
+
+    if (radix == 10 && is_constant_evaluated() == false)
     {
-       _M_data._M_value = __other._M_data._M_value;
+        // Up to digits10 digits always fit, so the unchecked kernel can take them.
+        constexpr std::ptrdiff_t safe_digits = std::numeric_limits<unsigned_type>::digits10;
+
+        it = parse_decimal_digits_fast(it, __last - it > safe_digits ? it + safe_digits : __last, result);
+
+        overflow = result > limit;
     }
 
-    template<typename _Tp>
-    constexpr KwargsValue(_Tp&& __value) noexcept
-        : _M_manager(&KwargsValue::_S_manage<_Tp&&>)
+    for (; it != __last; ++it)
     {
-        if constexpr (std::is_array_v<std::remove_reference_t<_Tp>>)
+        const int digit = radix_character_to_integer(*it);
+
+        if (digit == -1 || digit >= radix)
         {
-            static_assert(checkTag<decltype(__value)>() == ValueFlag);
-            _M_data._M_ptr = detail::pointer_cast<std::decay_t<_Tp>>(__value);
+            break;
         }
-        else
+
+        if (overflow == false && (unsigned_type(digit) > limit || result > unsigned_type((limit - unsigned_type(digit)) / unsigned_type(radix))))
         {
-            _M_place(std::forward<_Tp>(__value));
+            overflow = true;
         }
+
+        result = unsigned_type(result * unsigned_type(radix) + unsigned_type(digit));
     }
-    
-    template<typename _Tp, std::size_t _Size>
-    constexpr KwargsValue(const _Tp (&__value)[_Size]) noexcept
-        : _M_manager(&KwargsValue::_S_manage<const _Tp (&)[_Size]>)
+
+    if (it == digits)
     {
-        static_assert(checkTag<decltype(__value)>() == ValueFlag);
-        _M_data._M_ptr = detail::pointer_cast<_Tp*>(__value);
+        __ec = std::errc::invalid_argument;
+        return __first;
     }
 
-    _KWARGS_DESTRUCTOR_CONSTEXPR ~KwargsValue() noexcept
+    if (overflow)
     {
-        if (valueTag() == AppliedFlag)
-        {
-            _M_manager(DoFree, _M_data._M_ptr, nullptr);
-        }
+        finish(negative ? min_value : max_value, std::errc::result_out_of_range);
     }
-
-    [[nodiscard]] constexpr ValueTag valueTag() const noexcept
+    else
     {
-        ValueTag _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(result);
-        _M_manager(DoGetTag, nullptr, &result);
-
-        return result;
+        finish(negative ? static_cast<type>(unsigned_type(0U - result)) : static_cast<type>(result));
     }
 
-    [[nodiscard]] constexpr Type type() const noexcept
-    {
-        Type _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(result);
-        _M_manager(DoGetType, nullptr, &result);
+    return it;
+}
 
-        return result;
-    }
 
-    [[nodiscard]] constexpr Type underlyingType() const noexcept
+/**
+ * @brief Parses a floating-point number from [__first, __last) and reports where parsing stopped.
+ * 
+ * The accepted syntax is the one of string_to_floating_point, which performs the conversion.
+ * A result that overflows to infinity or underflows to zero sets @c __ec to
+ * @c std::errc::result_out_of_range.
+ * 
+ * @return Pointer to the first character not consumed, or @c __first if nothing was parsed.
+ */
+template<typename _Tp, std::enable_if_t<std::is_floating_point_v<_Tp>, int> = 0>
+constexpr const char* parse_floating_point(const char* __first, const char* __last, _Tp& __value, std::errc& __ec) noexcept
+{
+    const char* it = __first;
+
+    auto skip_spaces = [&it, __last]() constexpr noexcept -> void
     {
-        Type _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(result);
-        _M_manager(DoGetUnderlyingType, nullptr, &result);
+        for (; it != __last && is_space_character(*it); ++it);
+    };
 
-        return result;
-    }
+    auto is_digit = [&it, __last]() constexpr noexcept -> bool
+    {
+        return it != __last && static_cast<unsigned char>(*it - '0') < 10;
+    };
 
-    template<typename _Tp>
-    [[nodiscard]] constexpr auto data() const noexcept -> std::remove_reference_t<_Tp>
+    skip_spaces();
+
+    const char* const start = it;
+
+    if (it != __last && (*it == '+' || *it == '-'))
     {
-        std::remove_reference_t<_Tp> _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(result);
-        _M_manager(DoGetContainerData, detail::as_non_cv(this), &result);
+        ++it;
+        skip_spaces();
+    }
 
-        return result;
+    if (it == __last)
+    {
+        __ec = std::errc::invalid_argument;
+        return __first;
     }
 
-    [[nodiscard]] constexpr std::size_t elementCount() const noexcept
+
+    if (static_cast<unsigned char>(*it - '0') >= 10 && *it != '.')
     {
-        std::size_t _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(result);
-        _M_manager(DoGetContainerSize, detail::as_non_cv(this), &result);
+        for (std::string_view keyword : { "infinity", "inf", "nan", "max", "min", "pi", "e" })
+        {
+            if (starts_with_word_ignore_case(it, __last, keyword))
+            {
+                it += keyword.size();
 
-        return result;
+                __value = string_to_floating_point<_Tp>(std::string_view(start, static_cast<std::size_t>(it - start)));
+                __ec = std::errc{};
+
+                return it;
+            }
+        }
+
+        __ec = std::errc::invalid_argument;
+        return __first;
     }
 
-    [[nodiscard]] constexpr std::size_t size() const noexcept
-    { return elementCount(); }
 
-    template<typename _Tp>
-    [[nodiscard]] _KWARGS_NON_LITERAL_FUNCTION_CONSTEXPR _Tp first() const noexcept
-    {
-        KwargsValue _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(result);
-        _M_manager(DoGetPairFirst, detail::as_non_cv(this), &result);
+    bool has_digits = false;
+    bool has_nonzero_digits = false;
 
-        return result.value<_Tp>();
+    for (; is_digit(); ++it)
+    {
+        has_digits = true;
+        has_nonzero_digits |= (*it != '0');
     }
 
-    template<typename _Tp>
-    [[nodiscard]] _KWARGS_NON_LITERAL_FUNCTION_CONSTEXPR _Tp second() const noexcept
+    if (it != __last && *it == '.')
     {
-        KwargsValue _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(result);
-        _M_manager(DoGetPairSecond, detail::as_non_cv(this), &result);
+        ++it;
 
-        return result.value<_Tp>();
+        for (; is_digit(); ++it)
+        {
+            has_digits = true;
+            has_nonzero_digits |= (*it != '0');
+        }
     }
 
-    template<typename _Tp>
-    [[nodiscard]] constexpr auto pointer() noexcept
-        -> std::add_pointer_t<std::remove_reference_t<_Tp>>
+    if (has_digits == false)
     {
-        using result_type = std::add_pointer_t<std::remove_reference_t<_Tp>>;
+        __ec = std::errc::invalid_argument;
+        return __first;
+    }
 
-        switch (valueTag())
+    // The exponent is only taken when at least one digit follows it.
+    if (it != __last && is_same_char_ignore_case(*it, 'e'))
+    {
+        const char* const mark = it++;
+
+        if (it != __last && (*it == '+' || *it == '-'))
         {
-            case PointerFlag:
-            case AppliedFlag:
-                
-                return detail::pointer_cast<result_type>(_M_data._M_ptr);
+            ++it;
+        }
 
+        if (is_digit())
+        {
+            for (; is_digit(); ++it);
+        }
+        else
+        {
+            it = mark;
+        }
+    }
 
-            case ValueFlag:
 
-                // Taking the address of an array causes it to decay to a pointer to its first element.
-                if constexpr (std::is_array_v<std::remove_reference_t<_Tp>>)
-                {
-                    return detail::pointer_cast<result_type>(_M_data._M_ptr);
-                }
-                else
-                {
-                    return detail::pointer_cast<result_type>(&_M_data._M_value);
-                }
+    __value = string_to_floating_point<_Tp>(std::string_view(start, static_cast<std::size_t>(it - start)));
 
-            _KWARGS_ATTRIBUTE_UNLIKELY
-            default:
-                
-                assert(false);
-                return nullptr;
-        }
+    if (__value == std::numeric_limits<_Tp>::infinity() || __value == -std::numeric_limits<_Tp>::infinity()
+        || (__value == _Tp(0) && has_nonzero_digits))
+    {
+        __ec = std::errc::result_out_of_range;
+    }
+    else
+    {
+        __ec = std::errc{};
     }
 
-    template<typename _Tp>
-    [[nodiscard]] constexpr auto pointer() const noexcept
-        -> std::add_pointer_t<std::add_const_t<std::remove_reference_t<_Tp>>>
+    return it;
+}
+
+
+/**
+ * @brief The factor that converts a number followed by @c __suffix into units of @c _Period,
+ *        as the reduced fraction @c __num / @c __den; a number without a known suffix is already in them.
+ * 
+ * @return Whether the fraction fits; a part that overflows @c std::intmax_t is saturated at its maximum.
+ */
+template<typename _Period, typename _Suffix>
+constexpr bool unit_scale(const _Suffix* __suffix, std::intmax_t& __num, std::intmax_t& __den) noexcept
+{
+    if (__suffix == nullptr)
     {
-        using result_type = std::add_pointer_t<std::remove_reference_t<_Tp>>;
+        __num = __den = 1;
+        return true;
+    }
 
-        switch (valueTag())
+    const std::intmax_t g1 = std::gcd(__suffix->num, _Period::num);
+    const std::intmax_t g2 = std::gcd(__suffix->den, _Period::den);
+
+    auto multiply = [](std::intmax_t __left, std::intmax_t __right, std::intmax_t& __result) constexpr noexcept -> bool
+    {
+        if (__left > std::numeric_limits<std::intmax_t>::max() / __right)
         {
-            case PointerFlag:
-            case AppliedFlag:
-                
-                return detail::pointer_cast<result_type>(_M_data._M_ptr);
+            __result = std::numeric_limits<std::intmax_t>::max();
+            return false;
+        }
 
-            case ValueFlag:
+        __result = __left * __right;
+        return true;
+    };
 
-                // Taking the address of an array causes it to decay to a pointer to its first element.
-                if constexpr (std::is_array_v<std::remove_reference_t<_Tp>>)
-                {
-                    return detail::pointer_cast<result_type>(_M_data._M_ptr);
-                }
-                else
-                {
-                    return detail::pointer_cast<result_type>(&_M_data._M_value);
-                }
+    const bool num_fits = multiply(__suffix->num / g1, _Period::den / g2, __num);
+    const bool den_fits = multiply(__suffix->den / g2, _Period::num / g1, __den);
 
-            _KWARGS_ATTRIBUTE_UNLIKELY
-            default:
-                
-                assert(false);
-                return nullptr;
-        }
-    }
+    return num_fits && den_fits;
+}
 
+/**
+ * @brief The count of a stored duration and its period, read through the type-erased manager of KwargsValue.
+ *        @c num is zero when the value is not a duration.
+ */
+struct duration_count
+{
+    std::intmax_t num = 0;
+    std::intmax_t den = 1;
 
-    template<typename _Tp>
-    [[nodiscard]] constexpr _Tp& reference() noexcept
-    { return *pointer<_Tp>(); }
+    bool is_floating_point = false;
 
-    template<typename _Tp>
-    [[nodiscard]] constexpr const _Tp& reference() const noexcept
-    { return *pointer<_Tp>(); }
+    std::intmax_t integer = 0;
+    long double real = 0;
+};
+
+/**
+ * @brief Converts @c __count to a count of @c _Period as @c std::chrono::duration_cast does,
+ *        truncating toward zero; integer results saturate at the bounds of @c _Rep.
+ */
+template<typename _Rep, typename _Period>
+[[nodiscard]] constexpr _Rep rescale_duration(const duration_count& __count) noexcept
+{
+    const std::intmax_t g1 = std::gcd(__count.num, _Period::num);
+    const std::intmax_t g2 = std::gcd(__count.den, _Period::den);
 
+    const std::intmax_t num = (__count.num / g1) * (_Period::den / g2);
+    const std::intmax_t den = (__count.den / g2) * (_Period::num / g1);
 
-    template<typename _Tp>
-    [[nodiscard]] constexpr operator _Tp() const noexcept
+    if constexpr (std::is_floating_point_v<_Rep>)
     {
-        static_assert(std::negation_v<std::disjunction<std::is_reference<_Tp>, std::is_array<_Tp>>>);
-        return value<_Tp>();
-    }
+        const long double value = __count.is_floating_point ? __count.real : static_cast<long double>(__count.integer);
 
-    template<typename _Tp, typename... _Args>
-    [[nodiscard]] constexpr auto value(_Args&&... __args) const noexcept
-        -> std::enable_if_t<std::is_same_v<detail::remove_reference_cv_t<_Tp>, char>, std::remove_reference_t<_Tp>>
+        return static_cast<_Rep>(value * static_cast<long double>(num) / static_cast<long double>(den));
+    }
+    else if (__count.is_floating_point)
     {
-        using result_type = std::remove_reference_t<_Tp>;
-
-        Type&& ty = type();
+        const long double value = __count.real * static_cast<long double>(num) / static_cast<long double>(den);
 
-        if (ty.isSameAs<bool>())
-        {
-            return static_cast<result_type>(static_cast<bool>(_M_data._M_bytes[0]) ? 't' : 'f');
-        }
-        else if (ty.isCharacter())
-        {
-            return static_cast<result_type>(_M_data._M_bytes[0]);
-        }
-        else if (ty.isCharacterPointer())
+        if (value >= static_cast<long double>(std::numeric_limits<_Rep>::max()))
         {
-            return reference<result_type*>()[0];
+            return std::numeric_limits<_Rep>::max();
         }
-        else if (ty.isIterable())
+        else if (value <= static_cast<long double>(std::numeric_limits<_Rep>::min()))
         {
-            return _M_beginValue<result_type>(ty);
+            return std::numeric_limits<_Rep>::min();
         }
         else
         {
-            return static_cast<result_type>(value<int>(std::forward<_Args>(__args)...));
+            return static_cast<_Rep>(value);
         }
     }
-
-    template<typename _Tp, typename... _Args>
-    [[nodiscard]] constexpr auto value(_Args&&... __args) const noexcept
-        -> std::enable_if_t<detail::is_char_pointer_v<_Tp>, std::remove_reference_t<_Tp>>
+    else
     {
-        using result_type = std::remove_reference_t<_Tp>;
+        constexpr std::intmax_t max = std::numeric_limits<std::intmax_t>::max();
 
-        Type&& ty = type();
+        std::intmax_t value = __count.integer;
 
-        if (ty.isSameAs<bool>())
-        {
-            return detail::pointer_cast<result_type>(static_cast<bool>(_M_data._M_bytes[0]) ? "true" : "false");
-        }
-        else if (ty.isCharacter())
-        {
-            return detail::pointer_cast<result_type>(&_M_data._M_bytes[0]);
-        }
-        else if (ty.isCharacterPointer())
-        {
-            return detail::pointer_cast<result_type>(reference<const char*>());
-        }
-        else if (ty.isStdString())
-        {
-            return detail::pointer_cast<result_type>(pointer<std::string>()->c_str());
-        }
-        else if (ty.isStdStringView())
-        {
-            return detail::pointer_cast<result_type>(pointer<std::string_view>()->data());
-        }
-        else if (Type&& vty = ty.valueType(); ty.isStdVector() && vty.isCharacter())
+        if (value > max / num || value < -(max / num))
         {
-            return detail::pointer_cast<result_type>(pointer<std::vector<char>>()->data());
+            value = value < 0 ? std::numeric_limits<std::intmax_t>::min() : max;
         }
-        else if (ty.isStdArray() && vty.isCharacter())
+        else
         {
-            return detail::pointer_cast<result_type>(pointer<std::array<char, 1>>()->data());
+            value = value * num / den;
         }
 
-        if constexpr (sizeof...(_Args) == 0)
+        if constexpr (std::is_signed_v<_Rep> || sizeof(_Rep) < sizeof(std::intmax_t))
         {
-            return detail::pointer_cast<result_type>("");
+            constexpr auto lowest = static_cast<std::intmax_t>(std::numeric_limits<_Rep>::min());
+            constexpr auto highest = static_cast<std::intmax_t>(std::numeric_limits<_Rep>::max());
+
+            value = value < lowest ? lowest : (value > highest ? highest : value);
         }
-        else
+        else if (value < 0)
         {
-            return result_type(std::forward<_Args>(__args)...);
+            value = 0;
         }
+
+        return static_cast<_Rep>(value);
     }
+}
 
-    template<typename _Tp, typename... _Args>
-    [[nodiscard]] constexpr auto value(_Args&&...) const noexcept
-        -> std::enable_if_t<detail::is_std_string_v<_Tp>, std::remove_reference_t<_Tp>>
-    {
-        using result_type = std::remove_reference_t<_Tp>;
+_KWARGS_Test_(rescale_duration<int, std::milli>(duration_count{ 1, 1, false, 2, 0 }), 2000);
+_KWARGS_Test_(rescale_duration<int, std::ratio<60>>(duration_count{ 1, 1000, false, 150'000, 0 }), 2);
+_KWARGS_Test_(rescale_duration<long long, std::nano>(duration_count{ 3600, 1, false, 1'000'000'000'000, 0 }), std::numeric_limits<long long>::max());
 
-        Type&& ty = type();
+/**
+ * @brief Looks up the text after a number in @c __table; @c __ec is set to @c std::errc::invalid_argument
+ *        when there is a suffix that the table does not know.
+ */
+template<typename _Table>
+[[nodiscard]] constexpr auto find_unit_suffix(const char* __first, const char* __last, const _Table& __table, std::errc& __ec) noexcept
+{
+    std::string_view suffix(__first, static_cast<std::size_t>(__last - __first));
+    string_view_trimmed(suffix);
 
-        if (ty.isSameAs<bool>())
-        {
-            return result_type(
-                detail::pointer_cast<
-                    const detail::container_value_type_t<result_type>*>(
-                        static_cast<bool>(_M_data._M_bytes[0]) ? "true" : "false"));
-        }
-        else if (ty.isCharacter())
+    const auto* found = __table.find(suffix);
+
+    __ec = (found == nullptr && suffix.empty() == false) ? std::errc::invalid_argument : std::errc{};
+
+    return found;
+}
+
+/**
+ * @brief Converts a number followed by an optional unit suffix from @c __table, such as "64MiB" or "1.5k",
+ *        into an integer counting units of @c _Period.
+ * 
+ * The digits and the suffix are read in one pass and scaled in integer arithmetic when the result fits,
+ * so "0.29s" is exactly 290 milliseconds. The result is truncated toward zero and saturates at the
+ * bounds of @c _Tp, setting @c __ec to @c std::errc::result_out_of_range; radix prefixes and keywords
+ * take the plain string_to_integer path, without a unit.
+ * 
+ * A suffix that is not in @c __table, such as "64XB" or "10m" in kwargs::unit::durations, or any suffix
+ * after a radix prefix, such as "0x10k", is not read as the base unit: the result is zero and @c __ec
+ * is set to @c std::errc::invalid_argument.
+ */
+template<typename _Tp, typename _Period = std::ratio<1>, typename _Table, std::enable_if_t<is_integral_or_enum_v<_Tp>, int> = 0>
+[[nodiscard]] constexpr auto string_to_integer(std::string_view __str, const _Table& __table, std::errc& __ec) noexcept
+{
+    __ec = std::errc{};
+
+    using result_type = std::remove_reference_t<_Tp>;
+    using type = enum_underlying_type_t<remove_reference_cv_t<_Tp>>;
+
+    const char* it = __str.data();
+    const char* const last = __str.data() + __str.size();
+
+    for (; it != last && is_space_character(*it); ++it);
+
+    bool negative = false;
+
+    if (it != last && (*it == '+' || *it == '-'))
+    {
+        negative = (*it == '-');
+        ++it;
+    }
+
+    // Radix prefixes ("0x10") and keywords ("max") carry no unit.
+    const bool has_radix_prefix = (last - it >= 2 && it[0] == '0' && std::string_view("bBoOxXhH").find(it[1]) != std::string_view::npos);
+
+    if (has_radix_prefix)
+    {
+        // "0x10k" is rejected rather than read as 16; a suffix such as B would be a hexadecimal digit.
+        std::intmax_t ignored = 0;
+        std::errc ec = std::errc{};
+
+        std::string_view rest(__str);
+        rest.remove_prefix(static_cast<std::size_t>(parse_integer(__str.data(), last, ignored, ec) - __str.data()));
+        string_view_trimmed(rest);
+
+        if (rest.empty() == false)
         {
-            return result_type(1, static_cast<detail::container_value_type_t<result_type>>(_M_data._M_bytes[0]));
+            __ec = std::errc::invalid_argument;
+            return result_type{};
         }
-        else if (ty.isCharacterPointer())
+
+        return string_to_integer<result_type>(__str);
+    }
+
+    if (it == last || (static_cast<unsigned char>(*it - '0') >= 10 && *it != '.'))
+    {
+        return string_to_integer<result_type>(__str);
+    }
+
+    // The number is mantissa * 10^exponent.
+    std::uint64_t mantissa = 0;
+    int exponent = 0;
+
+    bool has_digits = false;
+
+    auto take_digits = [&](bool __fractional) constexpr noexcept -> void
+    {
+        for (; it != last && static_cast<unsigned char>(*it - '0') < 10; ++it)
         {
-            if (ty.isArray())
+            has_digits = true;
+
+            const auto digit = static_cast<std::uint64_t>(*it - '0');
+
+            if (mantissa <= (std::numeric_limits<std::uint64_t>::max() - digit) / 10)
             {
-                return result_type(reference<const detail::container_value_type_t<result_type>*>(), ty.size() / sizeof(char) - 1);
+                mantissa = mantissa * 10 + digit;
+                exponent -= __fractional;
             }
             else
             {
-                return result_type(reference<const detail::container_value_type_t<result_type>*>());
+                exponent += (__fractional == false);
             }
         }
-        else if (ty.isStdString())
-        {
-            return reference<result_type>();
-        }
-        else if (ty.isStdStringView())
+    };
+
+    take_digits(false);
+
+    if (it != last && *it == '.')
+    {
+        ++it;
+        take_digits(true);
+    }
+
+    if (has_digits == false)
+    {
+        return string_to_integer<result_type>(__str);
+    }
+
+    // "1e3" is an exponent, "1EiB" is a suffix.
+    if (last - it >= 2 && is_same_char_ignore_case(*it, 'e'))
+    {
+        const char* mark = it + 1;
+
+        const bool negative_exponent = (*mark == '-');
+
+        if (*mark == '+' || *mark == '-')
         {
-            const auto* ptr = pointer<std::basic_string_view<detail::container_value_type_t<result_type>>>();
-            return result_type(ptr->data(), ptr->size());
+            ++mark;
         }
-        else if (ty.isIntegralOrEnum())
+
+        if (mark != last && static_cast<unsigned char>(*mark - '0') < 10)
         {
-            if (ty.isSigned())
-            {
-                if (ty.size() == sizeof(std::int8_t))
-                {
-                    return detail::integer_to_string<result_type>(reference<std::int8_t >());
-                }
-                else if (ty.size() == sizeof(std::int16_t))
-                {
-                    return detail::integer_to_string<result_type>(reference<std::int16_t>());
-                }
-                else if (ty.size() == sizeof(std::int32_t))
-                {
-                    return detail::integer_to_string<result_type>(reference<std::int32_t>());
-                }
-                else // if (ty.size() == sizeof(std::int64_t))
-                {
-                    return detail::integer_to_string<result_type>(reference<std::int64_t>());
-                }
-            }
-            else
+            int explicit_exponent = 0;
+
+            for (it = mark; it != last && static_cast<unsigned char>(*it - '0') < 10; ++it)
             {
-                return detail::integer_to_string<result_type>(reference<std::uint64_t>());
+                explicit_exponent = std::min(explicit_exponent * 10 + (*it - '0'), 100'000);
             }
+
+            exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
         }
-        else if (ty.isFloatingPoint())
+    }
+
+    std::intmax_t num = 1, den = 1;
+    const bool scale_fits = unit_scale<_Period>(find_unit_suffix(it, last, __table, __ec), num, den);
+
+    if (__ec != std::errc{})
+    {
+        return result_type{};
+    }
+
+    // Net the decimal exponent against the trailing zeros of the mantissa and the powers of ten
+    // in the scale first, so that "1.0000000000000000000EB" does not run out of room in den.
+    for (; exponent < 0 && mantissa != 0 && mantissa % 10 == 0; ++exponent)
+    {
+        mantissa /= 10;
+    }
+
+    for (; exponent < 0 && num % 10 == 0; ++exponent)
+    {
+        num /= 10;
+    }
+
+    for (; exponent > 0 && den % 10 == 0; --exponent)
+    {
+        den /= 10;
+    }
+
+    for (; exponent > 0 && num <= std::numeric_limits<std::intmax_t>::max() / 10; --exponent)
+    {
+        num *= 10;
+    }
+
+    for (; exponent < 0 && den <= std::numeric_limits<std::intmax_t>::max() / 10; ++exponent)
+    {
+        den *= 10;
+    }
+
+    using unsigned_type = std::make_unsigned_t<std::conditional_t<std::is_same_v<type, bool>, unsigned char, type>>;
+
+    const auto max_magnitude = static_cast<std::uint64_t>(std::is_same_v<type, bool>
+        ? 1U : (negative ? unsigned_type(0U - static_cast<unsigned_type>(std::numeric_limits<type>::min())) : static_cast<unsigned_type>(std::numeric_limits<type>::max())));
+
+    std::uint64_t magnitude = 0;
+
+    // A scale that overflowed intmax_t cannot give an exact count either.
+    bool saturated = (scale_fits == false && mantissa != 0);
+
+    auto saturate = [&saturated, max_magnitude](long double __value) constexpr noexcept -> std::uint64_t
+    {
+        saturated = saturated || __value > static_cast<long double>(max_magnitude);
+        return __value >= static_cast<long double>(max_magnitude) ? max_magnitude : static_cast<std::uint64_t>(__value);
+    };
+
+    if (mantissa == 0)
+    {
+        magnitude = 0;
+    }
+    else if (exponent < 0)
+    {
+        // den is full; the remaining divisions by ten are made in floating point.
+        long double value = static_cast<long double>(mantissa) * static_cast<long double>(num) / static_cast<long double>(den);
+
+        for (; exponent < 0 && value >= 1; ++exponent)
         {
-            if (ty.size() == sizeof(float))
-            {
-                return detail::floating_point_to_string<result_type>(reference<float>());
-            }
-            else if (ty.size() == sizeof(double))
-            {
-                return detail::floating_point_to_string<result_type>(reference<double>());
-            }
-            else // if (ty.size() == sizeof(long double))
-            {
-                return detail::floating_point_to_string<result_type>(reference<long double>());
-            }
+            value /= 10;
         }
-        else if (ty.isPointer())
+
+        magnitude = exponent < 0 ? 0 : saturate(value);
+    }
+    else if (exponent > 0)
+    {
+        // num is full; the remaining multiplications by ten are made in floating point.
+        long double value = static_cast<long double>(mantissa) * static_cast<long double>(num) / static_cast<long double>(den);
+
+        for (; exponent > 0 && value <= static_cast<long double>(max_magnitude); --exponent)
         {
-            return detail::pointer_to_string<result_type>(reference<void*>());
+            value *= 10;
         }
-        else
+
+        magnitude = saturate(value);
+    }
+    else if (mantissa <= std::numeric_limits<std::uint64_t>::max() / static_cast<std::uint64_t>(num))
+    {
+        const std::uint64_t value = mantissa * static_cast<std::uint64_t>(num) / static_cast<std::uint64_t>(den);
+
+        magnitude = std::min<std::uint64_t>(value, max_magnitude);
+        saturated = saturated || value > max_magnitude;
+    }
+    else
+    {
+        magnitude = saturate(static_cast<long double>(mantissa) * static_cast<long double>(num) / static_cast<long double>(den));
+    }
+
+    if (saturated)
+    {
+        __ec = std::errc::result_out_of_range;
+    }
+
+    if (negative)
+    {
+        return static_cast<result_type>(static_cast<type>(unsigned_type(0U - static_cast<unsigned_type>(magnitude))));
+    }
+    else
+    {
+        return static_cast<result_type>(static_cast<type>(magnitude));
+    }
+}
+
+template<typename _Tp, typename _Period = std::ratio<1>, typename _Table, std::enable_if_t<is_integral_or_enum_v<_Tp>, int> = 0>
+[[nodiscard]] constexpr auto string_to_integer(std::string_view __str, const _Table& __table) noexcept
+{
+    std::errc ec = std::errc{};
+    return string_to_integer<_Tp, _Period>(__str, __table, ec);
+}
+
+/**
+ * @brief Converts a number followed by an optional unit suffix from @c __table, such as "1.5k" or "250ms",
+ *        into a floating-point number of units of @c _Period; an unknown suffix gives zero and sets @c __ec.
+ */
+template<typename _Tp, typename _Period = std::ratio<1>, typename _Table>
+[[nodiscard]] constexpr auto string_to_floating_point(std::string_view __str, const _Table& __table, std::errc& __ec) noexcept
+        -> std::enable_if_t<std::is_floating_point_v<std::remove_reference_t<_Tp>>, std::remove_reference_t<_Tp>>
+{
+    using result_type = remove_reference_cv_t<_Tp>;
+
+    __ec = std::errc{};
+
+    const char* const first = __str.data();
+    const char* const last = __str.data() + __str.size();
+
+    result_type value = 0;
+    std::errc ec = std::errc{};
+
+    const char* const it = parse_floating_point(first, last, value, ec);
+
+    if (it == first)
+    {
+        return string_to_floating_point<result_type>(__str);
+    }
+
+    const auto* suffix = find_unit_suffix(it, last, __table, __ec);
+
+    if (__ec != std::errc{})
+    {
+        return result_type{};
+    }
+
+    std::intmax_t num = 1, den = 1;
+
+    if (unit_scale<_Period>(suffix, num, den) == false)
+    {
+        // The scale is too large for intmax_t, but not for long double.
+        const long double scale = static_cast<long double>(suffix->num / std::gcd(suffix->num, _Period::num))
+            * static_cast<long double>(_Period::den / std::gcd(suffix->den, _Period::den))
+            / static_cast<long double>(suffix->den / std::gcd(suffix->den, _Period::den))
+            / static_cast<long double>(_Period::num / std::gcd(suffix->num, _Period::num));
+
+        value = static_cast<result_type>(static_cast<long double>(value) * scale);
+
+        if (value == std::numeric_limits<result_type>::infinity() || value == -std::numeric_limits<result_type>::infinity())
         {
-            return _M_getInsertableContainer<result_type>(ty);
+            __ec = std::errc::result_out_of_range;
         }
+
+        return value;
+    }
+
+    return num == den ? value : value * static_cast<result_type>(num) / static_cast<result_type>(den);
+}
+
+template<typename _Tp, typename _Period = std::ratio<1>, typename _Table>
+[[nodiscard]] constexpr auto string_to_floating_point(std::string_view __str, const _Table& __table) noexcept
+        -> std::enable_if_t<std::is_floating_point_v<std::remove_reference_t<_Tp>>, std::remove_reference_t<_Tp>>
+{
+    std::errc ec = std::errc{};
+    return string_to_floating_point<_Tp, _Period>(__str, __table, ec);
+}
+
+
+/**
+ * @brief "00", "01", ..., "99" laid end to end; two decimal digits per lookup.
+ */
+inline constexpr char decimal_digit_pairs[201] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+[[nodiscard]] constexpr int decimal_digit_count(std::uint64_t __n) noexcept
+{
+    constexpr std::uint64_t powers[] = {
+        0, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL,
+        10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL,
+        1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL,
+        10000000000000000000ULL
+    };
+
+    // floor(bit_width * log10(2)) is either the count or one less.
+    const int count = (64 - count_leading_zeros(__n | 1)) * 1233 >> 12;
+
+    return count + 1 - static_cast<int>(__n < powers[count]);
+}
+
+_KWARGS_Test_(decimal_digit_count(0), 1); _KWARGS_Test_(decimal_digit_count(9), 1); _KWARGS_Test_(decimal_digit_count(10), 2);
+_KWARGS_Test_(decimal_digit_count(999), 3); _KWARGS_Test_(decimal_digit_count(1000), 4);
+_KWARGS_Test_(decimal_digit_count(9999999999999999999ULL), 19); _KWARGS_Test_(decimal_digit_count(~0ULL), 20);
+
+
+/**
+ * @brief Writes the decimal digits of @c __n to @c __first.
+ * 
+ * @return Pointer past the last written character.
+ */
+constexpr char* unsigned_to_decimal_chars(char* __first, std::uint64_t __n) noexcept
+{
+    char* const last = __first + decimal_digit_count(__n);
+    char* it = last;
+
+    for (; __n >= 100; __n /= 100)
+    {
+        const std::size_t i = static_cast<std::size_t>(__n % 100) * 2;
+
+        *--it = decimal_digit_pairs[i + 1];
+        *--it = decimal_digit_pairs[i];
+    }
+
+    if (__n >= 10)
+    {
+        *--it = decimal_digit_pairs[__n * 2 + 1];
+        *--it = decimal_digit_pairs[__n * 2];
+    }
+    else
+    {
+        *--it = static_cast<char>('0' + __n);
+    }
+
+    return last;
+}
+
+/**
+ * @brief Writes @c __n in radix 2^__bits to @c __first, taking digits by shift and mask.
+ * 
+ * @return Pointer past the last written character.
+ */
+template<typename _Tp>
+constexpr char* unsigned_to_power_of_two_radix_chars(char* __first, _Tp __n, int __bits) noexcept
+{
+    static_assert(std::is_unsigned_v<_Tp>);
+
+    int count = 1;
+
+    for (_Tp rest = static_cast<_Tp>(__n >> __bits); rest; rest = static_cast<_Tp>(rest >> __bits))
+    {
+        ++count;
+    }
+
+    const _Tp mask = static_cast<_Tp>((1U << __bits) - 1);
+
+    char* const last = __first + count;
+
+    for (char* it = last; it != __first; __n = static_cast<_Tp>(__n >> __bits))
+    {
+        *--it = "0123456789ABCDEFGHIJKLMNOPQRSTUV"[static_cast<std::size_t>(__n & mask)];
+    }
+
+    return last;
+}
+
+_KWARGS_Test_([]() constexpr noexcept -> bool { char s[8] = {}; unsigned_to_decimal_chars(s, 4096); return std::string_view(s) == "4096"; }());
+_KWARGS_Test_([]() constexpr noexcept -> bool { char s[8] = {}; unsigned_to_power_of_two_radix_chars(s, 0xBEEFU, 4); return std::string_view(s) == "BEEF"; }());
+_KWARGS_Test_([]() constexpr noexcept -> bool { char s[8] = {}; unsigned_to_power_of_two_radix_chars(s, 0U, 1); return std::string_view(s) == "0"; }());
+
+
+// Promoted as by the arithmetic operators, which also covers bool and enumerations.
+template<typename _Tp>
+using integer_conversion_type_t = std::common_type_t<
+    typename std::conditional_t<std::is_enum_v<_Tp>, std::underlying_type<_Tp>, std::common_type<_Tp>>::type, int>;
+
+/**
+ * @brief The most characters integer_to_chars writes for a @c _Tp: a sign and every binary digit.
+ */
+template<typename _Tp>
+static constexpr inline std::size_t integer_chars_max_v = sizeof(integer_conversion_type_t<_Tp>) * 8 + 1;
+
+template<typename _Tp>
+constexpr char* integer_to_chars(char* __first, _Tp __n, int __radix = 10) noexcept
+{
+    clamp<int>(__radix, 2, 36);
+
+    using integer_type = integer_conversion_type_t<_Tp>;
+
+    if (static_cast<integer_type>(__n) < 0)
+    {
+        *__first++ = '-';
+    }
+
+    const auto magnitude = abs(static_cast<integer_type>(__n));
+
+    if (__radix == 10 && sizeof(magnitude) <= sizeof(std::uint64_t))
+    {
+        return unsigned_to_decimal_chars(__first, static_cast<std::uint64_t>(magnitude));
+    }
+    else if ((__radix & (__radix - 1)) == 0)
+    {
+        return unsigned_to_power_of_two_radix_chars(__first, magnitude, 63 - count_leading_zeros(static_cast<std::uint64_t>(__radix)));
     }
 
-    template<typename _Tp, typename... _Args>
-    [[nodiscard]] constexpr auto value(_Args&&... __args) const noexcept
-        -> std::enable_if_t<detail::is_std_string_view_v<_Tp>, std::remove_reference_t<_Tp>>
-    {
-        using result_type = std::remove_reference_t<_Tp>;
+    const auto radix = static_cast<std::remove_const_t<decltype(magnitude)>>(__radix);
+
+    // Counts the digits first, so that they can be written in place from the back.
+    char* last = __first + 1;
+
+    for (auto rest = magnitude / radix; rest; rest /= radix)
+    {
+        ++last;
+    }
+
+    char* it = last;
+
+    for (auto rest = magnitude; it != __first; rest /= radix)
+    {
+        *--it = integer_to_radix_character(static_cast<int>(rest % radix));
+    }
+
+    return last;
+}
+
+template<typename _Res, typename _Tp>
+[[nodiscard]] constexpr auto integer_to_string(_Tp __n, int __radix = 10) noexcept
+        -> std::enable_if_t<is_std_string_v<_Res> && is_integral_or_enum_v<_Tp>, std::remove_reference_t<_Res>>
+{
+    char _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(buffer[integer_chars_max_v<_Tp>]);
+
+    const char* const last = integer_to_chars(buffer, __n, __radix);
+
+    return std::remove_reference_t<_Res>(static_cast<std::decay_t<decltype(buffer)>>(buffer), static_cast<std::size_t>(last - buffer));
+}
+
+/**
+ * @brief 126-bit approximations of 10^-k for k from -324 to 292, used by to_shortest_decimal.
+ * 
+ * Each entry is g = floor(10^-k * 2^-r) + 1 with 2^125 <= g < 2^126,
+ * stored as {g >> 63, g & (2^63 - 1)}.
+ */
+inline constexpr std::uint64_t power_of_ten_126[] = {
+    0x4F0CEDC95A718DD4ULL, 0x5B01E8B09AA0D1B5ULL, 0x7E7B160EF71C1621ULL, 0x119CA780F767B5EEULL,
+    0x652F44D8C5B011B4ULL, 0x0E16EC672C52F7F2ULL, 0x50F29D7A37C00E29ULL, 0x581256B8F0425FF5ULL,
+    0x40C21794F96671BAULL, 0x79A84560C0351991ULL, 0x679CF287F570B5F7ULL, 0x75DA089ACD21C281ULL,
+    0x52E3F5399126F7F9ULL, 0x44AE6D48A41B0201ULL, 0x424FF76140EBF994ULL, 0x36F1F106E9AF34CDULL,
+    0x6A198BCECE465C20ULL, 0x57E981A4A918547BULL, 0x54E13CA571D1E34DULL, 0x2CBACE1D541376C9ULL,
+    0x43E763B78E4182A4ULL, 0x23C8A4E44342C56EULL, 0x6CA56C58E39C043AULL, 0x060DD4A06B9E08B0ULL,
+    0x56EABD13E9499CFBULL, 0x1E7176E6BC7E6D59ULL, 0x458897432107B0C8ULL, 0x7EC12BEBC9FEBDE1ULL,
+    0x6F40F20501A5E7A7ULL, 0x7E01DFDFA9979635ULL, 0x5900C19D9AEB1FB9ULL, 0x4B34B319547944F7ULL,
+    0x4733CE17AF227FC7ULL, 0x55C3C27AA9FA9D93ULL, 0x71EC7CF2B1D0CC72ULL, 0x560603F7765DC8EAULL,
+    0x5B2397288E40A38EULL, 0x7804CFF92B7E3A55ULL, 0x48E945BA0B66E93FULL, 0x13370CC755FE9511ULL,
+    0x74A86F90123E41FEULL, 0x51F1AE0BBCCA881BULL, 0x5D538C7341CB67FEULL, 0x74C1580963D539AFULL,
+    0x4AA93D29016F8665ULL, 0x43CDE0078310FAF3ULL, 0x77752EA8024C0A3CULL, 0x0616333F381B2B1EULL,
+    0x5F90F22001D66E96ULL, 0x3811C298F9AF55B1ULL, 0x4C73F4E667DEBEDEULL, 0x600E35472E25DE28ULL,
+    0x7A532170A6313164ULL, 0x3349EED849D6303FULL, 0x61DC1AC084F42783ULL, 0x42A18BE03B11C033ULL,
+    0x4E49AF006A5CEC69ULL, 0x1BB46FE695A7CCF5ULL, 0x7D42B19A43C7E0A8ULL, 0x2C53E63DBC3FAE55ULL,
+    0x64355AE1CFD31A20ULL, 0x237651CAFCFFBEAAULL, 0x502AAF1B0CA8E1B3ULL, 0x35F8416F30CC9888ULL,
+    0x402225AF3D53E7C2ULL, 0x5E603458F3D6E06DULL, 0x669D0918621FD937ULL, 0x4A3386F4B957CD7BULL,
+    0x52173A79E8197A92ULL, 0x6E8F9F2A2DDFD796ULL, 0x41AC2EC7ECE12EDBULL, 0x720C7F54F17FDFABULL,
+    0x69137E0CAE3517C6ULL, 0x1CE0CBBB1BFFCC45ULL, 0x540F980A24F74638ULL, 0x171A3C95AFFFD69EULL,
+    0x433FACD4EA5F6B60ULL, 0x127B63AAF3331218ULL, 0x6B991487DD657899ULL, 0x6A5F05DE51EB5026ULL,
+    0x5614106CB11DFA14ULL, 0x5518D17EA7EF7352ULL, 0x44DCD9F08DB194DDULL, 0x2A7A41321FF2C2A8ULL,
+    0x6E2E2980E2B5BAFBULL, 0x5D906850331E043FULL, 0x5824EE00B55E2F2FULL, 0x647386A68F4B3699ULL,
+    0x4683F19A2AB1BF59ULL, 0x36C2D21ED908F87BULL, 0x70D31C29DDE93228ULL, 0x579E1CFE280E5A5DULL,
+    0x5A427CEE4B20F4EDULL, 0x2C7E7D98200B7B7EULL, 0x483530BEA280C3F1ULL, 0x09FECAE019A2C932ULL,
+    0x73884DFDD0CE064EULL, 0x43314499C29E0EB6ULL, 0x5C6D0B3173D8050BULL, 0x4F5A9D47CEE4D891ULL,
+    0x49F0D5C129799DA2ULL, 0x72AEE4397250AD41ULL, 0x764E22CEA8C295D1ULL, 0x377E39F583B44868ULL,
+    0x5EA4E8A553CEDE41ULL, 0x12CB61913629D387ULL, 0x4BB72084430BE500ULL, 0x756F8140F8217605ULL,
+    0x792500D39E796E67ULL, 0x6F18CECE59CF233CULL, 0x60EA670FB1FABEB9ULL, 0x3F470BD847D8E8FDULL,
+    0x4D885272F4C89894ULL, 0x329F3CAD064720CAULL, 0x7C0D50B7EE0DC0EDULL, 0x37652DE1A3A50143ULL,
+    0x633DDA2CBE716724ULL, 0x2C50F1814FB73436ULL, 0x4F64AE8A31F45283ULL, 0x3D0D8E010C92902BULL,
+    0x7F077DA9E986EA6BULL, 0x7B48E334E0EA8045ULL, 0x659F97BB2138BB89ULL, 0x49071C2A4D88669DULL,
+    0x514C796280FA2FA1ULL, 0x20D27CEEA46D1EE4ULL, 0x4109FAB533FB594DULL, 0x670ECA58838A7F1DULL,
+    0x680FF788532BC216ULL, 0x0B4ADD5A6C10CB62ULL, 0x533FF939DC2301ABULL, 0x22A24AAEBCDA3C4EULL,
+    0x4299942E49B59AEFULL, 0x354EA22563E1C9D8ULL, 0x6A8F537D42BC2B18ULL, 0x554A9D089FCFA95AULL,
+    0x553F75FDCEFCEF46ULL, 0x776EE406E63FBAAEULL, 0x4432C4CB0BFD8C38ULL, 0x5F8BE99F1E996225ULL,
+    0x6D1E07AB466279F4ULL, 0x327975CB64289D08ULL, 0x574B3955D1E86190ULL, 0x28612B091CED4A6DULL,
+    0x45D5C777DB204E0DULL, 0x06B4226DB0BDD524ULL, 0x6FBC72595E9A167BULL, 0x24536A491AC95506ULL,
+    0x59638EADE54811FCULL, 0x1D0F883A7BD44405ULL, 0x4782D88B1DD34196ULL, 0x4A72D361FCA9D004ULL,
+    0x726AF411C952028AULL, 0x43EAEBCFFAA94CD3ULL, 0x5B88C3416DDB353BULL, 0x4FEF230CC88770A9ULL,
+    0x493A35CDF17C2A96ULL, 0x0CBF4F3D6D3926EEULL, 0x7529EFAFE8C6AA89ULL, 0x61321862485B717CULL,
+    0x5DBB262653D22207ULL, 0x675B46B506AF8DFDULL, 0x4AFC1E850FDB4E6CULL, 0x52AF6BC405593E64ULL,
+    0x77F9CA6E7FC54A47ULL, 0x377F12D33BC1FD6DULL, 0x5FFB085866376E9FULL, 0x45FF42429634CABDULL,
+    0x4CC8D379EB5F8BB2ULL, 0x6B329B68782A3BCBULL, 0x7ADAEBF64565AC51ULL, 0x2B842BDA59DD2C77ULL,
+    0x6248BCC5045156A7ULL, 0x3C69BCAEAE4A89F9ULL, 0x4EA0970403744552ULL, 0x6387CA25583BA194ULL,
+    0x7DCDBE6CD253A21EULL, 0x05A6103BC05F68EDULL, 0x64A498570EA94E7EULL, 0x37B80CFC99E5ED8AULL,
+    0x5083AD1272210B98ULL, 0x2C933D96E184BE08ULL, 0x40695741F4E73C79ULL, 0x7075CADF1AD09807ULL,
+    0x670EF2032171FA5CULL, 0x4D8944982AE759A4ULL, 0x52725B35B45B2EB0ULL, 0x3E076A135585E150ULL,
+    0x41F515C49048F226ULL, 0x64D2BB42AAD1810DULL, 0x698822D41A0E503EULL, 0x07B7920444826815ULL,
+    0x546CE8A9AE71D9CBULL, 0x1FC60E69D0685344ULL, 0x438A53BAF1F4AE3CULL, 0x196B3EBB0D20429DULL,
+    0x6C1085F7E9877D2DULL, 0x0F11FDF815006A94ULL, 0x56739E5FEE05FDBDULL, 0x58DB319344005543ULL,
+    0x45294B7FF19E6497ULL, 0x60AF5ADC3666AA9CULL, 0x6EA878CCB5CA3A8CULL, 0x344BC4938A3DDDC7ULL,
+    0x5886C70A2B082ED6ULL, 0x5D096A0FA1CB17D2ULL, 0x46D238D4EF39BF12ULL, 0x173ABB3FB4A27975ULL,
+    0x71505AEE4B8F981DULL, 0x0B912B992103F588ULL, 0x5AA6AF25093FACE4ULL, 0x0940EFADB4032AD3ULL,
+    0x488558EA6DCC8A50ULL, 0x07672624900288A9ULL, 0x74088E43E2E0DD4CULL, 0x723EA36DB337410EULL,
+    0x5CD3A5031BE71770ULL, 0x5B654F8AF5C5CDA5ULL, 0x4A42EA68E31F45F3ULL, 0x62B772D5916B0AEBULL,
+    0x76D1770E38320986ULL, 0x0458B7BC1BDE77DDULL, 0x5F0DF8D82CF4D46BULL, 0x1D13C630164B9318ULL,
+    0x4C0B2D79BD90A9EFULL, 0x30DC9E8CDEA2DC13ULL, 0x79AB7BF5FC1AA97FULL, 0x0160FDAE31049351ULL,
+    0x6155FCC4C9AEEDFFULL, 0x1AB3FE24F403A90EULL, 0x4DDE63D0A158BE65ULL, 0x6229981D9002EDA5ULL,
+    0x7C97061A9BC130A2ULL, 0x69DC2695B337E2A1ULL, 0x63AC04E2163426E8ULL, 0x54B01EDE28F9821BULL,
+    0x4FBCD0B4DE901F20ULL, 0x43C018B1BA6134E2ULL, 0x7F9481216419CB67ULL, 0x1F99C11C5D68549DULL,
+    0x6610674DE9AE3C52ULL, 0x4C7B00E37DED107EULL, 0x51A6B90B21583042ULL, 0x09FC00B5FE574065ULL,
+    0x41522DA2811359CEULL, 0x3B3000919845CD1DULL, 0x68837C3734EBC2E3ULL, 0x784CCDB5C06FAE95ULL,
+    0x539C635F5D8968B6ULL, 0x2D0A3E2B00595877ULL, 0x42E382B2B13ABA2BULL, 0x3DA1CB5599E11393ULL,
+    0x6B059DEAB52AC378ULL, 0x629C7888F634EC1EULL, 0x559E17EEF755692DULL, 0x3549FA072B5D89B1ULL,
+    0x447E798BF91120F1ULL, 0x1107FB38EF7E07C1ULL, 0x6D9728DFF4E834B5ULL, 0x01A65EC17F300C68ULL,
+    0x57AC20B32A535D5DULL, 0x4E1EB23465C009EDULL, 0x46234D5C21DC4AB1ULL, 0x24E55B5D1E333B24ULL,
+    0x70387BC69C93AAB5ULL, 0x216EF894FD1EC506ULL, 0x59C6C96BB076222AULL, 0x4DF2607730E56A6CULL,
+    0x47D23ABC8D2B4E88ULL, 0x3E5B805F5A5121F0ULL, 0x72E9F79415121740ULL, 0x63C59A322A1B697FULL,
+    0x5BEE5FA9AA74DF67ULL, 0x03047B5B54E2BACCULL, 0x498B7FBAEEC3E5ECULL, 0x0269FC4910B5623DULL,
+    0x75ABFF917E063CACULL, 0x6A432D41B45569FBULL, 0x5E2332DACB38308AULL, 0x21CF5767C37787FCULL,
+    0x4B4F5BE23C2CF3A1ULL, 0x67D912B9692C6CCAULL, 0x787EF969F9E185CFULL, 0x595B5128A8471476ULL,
+    0x60659454C7E79E3FULL, 0x6115DA86ED05A9F8ULL, 0x4D1E1043D31FB1CCULL, 0x4DAB1538BD9E2193ULL,
+    0x7B634D3951CC4FADULL, 0x62AB552795C9CF52ULL, 0x62B5D7610E3D0C8BULL, 0x0222AA86116E3F75ULL,
+    0x4EF7DF80D830D6D5ULL, 0x4E822204DABE992AULL, 0x7E59659AF38157BCULL, 0x17369CD49130F510ULL,
+    0x65145148C2CDDFC9ULL, 0x5F5EE3DD40F3F740ULL, 0x50DD0DD3CF0B196EULL, 0x1918B64A9A5CC5CDULL,
+    0x40B0D7DCA5A27ABEULL, 0x4746F83BAEB09E3EULL, 0x678159610903F797ULL, 0x253E59F91780FD2FULL,
+    0x52CDE11A6D9CC612ULL, 0x50FEAE60DF9A6426ULL, 0x423E4DAEBE1704DBULL, 0x5A65584D7FAEB685ULL,
+    0x69FD4917968B3AF9ULL, 0x10A226E265E4573BULL, 0x54CAA0DFABA29594ULL, 0x0D4E8581EB1D1295ULL,
+    0x43D54D7FBC821143ULL, 0x243ED134BC174211ULL, 0x6C887BFF94034ED2ULL, 0x06CAE85460253682ULL,
+    0x56D396661002A574ULL, 0x6BD586A9E6842B9BULL, 0x457611EB40021DF7ULL, 0x09779EEE52035616ULL,
+    0x6F234FDECCD02FF1ULL, 0x5BF297E3B66BBCEFULL, 0x58E90CB23D73598EULL, 0x165BACB62B8963F3ULL,
+    0x4720D6F4FDF5E13EULL, 0x451623C4EFA11CC2ULL, 0x71CE24BB2FEFCECAULL, 0x3B569FA17F682E03ULL,
+    0x5B0B5095BFF30BD5ULL, 0x15DEE61ACC535803ULL, 0x48D5DA11665C0977ULL, 0x2B18B8157042ACCFULL,
+    0x74895CE8A3C6758BULL, 0x5E8DF355806AAE18ULL, 0x5D3AB0BA1C9EC46FULL, 0x653E5C4466BBBE7AULL,
+    0x4A955A2E7D4BD059ULL, 0x3765169D1EFC9861ULL, 0x77555D172EDFB3C2ULL, 0x256E8A94FE60F3CFULL,
+    0x5F777DAC257FC301ULL, 0x6ABED543FEB3F63FULL, 0x4C5F97BCEACC9C01ULL, 0x3BCBDDCFFEF65E99ULL,
+    0x7A328C6177ADC668ULL, 0x5FAC961997F0975BULL, 0x61C209E792F16B86ULL, 0x7FBD44E1465A12AFULL,
+    0x4E34D4B9425ABC6BULL, 0x7FCA9D810514DBBFULL, 0x7D21545B9D5DFA46ULL, 0x32DDC8CE6E87C5FFULL,
+    0x641AA9E2E44B2E9EULL, 0x5BE4A0A525396B32ULL, 0x501554B5836F587EULL, 0x7CB6E6EA842DEF5CULL,
+    0x4011109135F2AD32ULL, 0x30925255368B25E3ULL, 0x6681B41B89844850ULL, 0x4DB6EA21F0DEA304ULL,
+    0x52015CE2D469D373ULL, 0x57C5881B2718826AULL, 0x419AB0B576BB0F8FULL, 0x5FD139AF527A01EFULL,
+    0x68F781225791B27FULL, 0x4C81F5E550C3364AULL, 0x53F9341B79415B99ULL, 0x239B2B1DDA35C508ULL,
+    0x432DC3492DCDE2E1ULL, 0x02E288E4AE916A6DULL, 0x6B7C6BA849496B01ULL, 0x516A74A1174F10AEULL,
+    0x55FD22ED076DEF34ULL, 0x4121F6E745D8DA25ULL, 0x44CA82573924BF5DULL, 0x1A8192529E4714EBULL,
+    0x6E10D08B8EA1322EULL, 0x5D9C1D50FD3E87DDULL, 0x580D73A2D880F4F2ULL, 0x17B01773FDCB9FE4ULL,
+    0x4671294F139A5D8EULL, 0x4626792997D61984ULL, 0x70B50EE4EC2A2F4AULL, 0x3D0A5B75BFBCF59FULL,
+    0x5A2A7250BCEE8C3BULL, 0x4A6EAF916630C47FULL, 0x4821F50D63F209C9ULL, 0x21F2260DEB5A36CCULL,
+    0x736988156CB6760EULL, 0x69837016455D247AULL, 0x5C546CDDF091F80BULL, 0x6E02C011D1175062ULL,
+    0x49DD23E4C074C66FULL, 0x719BCCDB0DAC404EULL, 0x762E9FD467213D7FULL, 0x68F947C4E2AD33B0ULL,
+    0x5E8BB3105280FDFFULL, 0x6D94396A4EF0F627ULL, 0x4BA2F5A6A8673199ULL, 0x3E102DEEA58D91B9ULL,
+    0x7904BC3DDA3EB5C2ULL, 0x3019E3176F48E927ULL, 0x60D09697E1CBC49BULL, 0x4014B5AC590720ECULL,
+    0x4D73ABACB4A303AFULL, 0x4CDD5E237A6C1A57ULL, 0x7BEC45E12104D2B2ULL, 0x47C8969F2A46908AULL,
+    0x63236B1A80D0A88EULL, 0x6CA0787F5505406FULL, 0x4F4F88E200A6ED3FULL, 0x0A19F9FF773766BFULL,
+    0x7EE5A7D0010B1531ULL, 0x5CF65CCBF1F23DFEULL, 0x6584864000D5AA8EULL, 0x172B7D6FF4C1CB32ULL,
+    0x5136D1CCCD77BBA4ULL, 0x78EF978CC3CE3C28ULL, 0x40F8A7D70AC62FB7ULL, 0x13F2DFA3CFD83020ULL,
+    0x67F43FBE77A37F8BULL, 0x398499061959E699ULL, 0x5329CC985FB5FFA2ULL, 0x6136E0D1ADE18548ULL,
+    0x4287D6E04C91994FULL, 0x00F8B3DAF181376DULL, 0x6A72F166E0E8F54BULL, 0x1B27862B1C01F247ULL,
+    0x5528C11F1A53F76FULL, 0x2F52D1BC1667F506ULL, 0x44209A7F48432C59ULL, 0x0C424163451FF738ULL,
+    0x6D00F7320D3846F4ULL, 0x7A039BD208332526ULL, 0x5733F8F4D76038C3ULL, 0x7B361641A028EA85ULL,
+    0x45C32D90AC4CFA36ULL, 0x2F5E78348020BB9EULL, 0x6F9EAF4DE07B29F0ULL, 0x4BCA59ED99CDF8FCULL,
+    0x594BBF71806287F3ULL, 0x563B7B247B0B2D96ULL, 0x476FCC5ACD1B9FF6ULL, 0x11C92F50626F57ACULL,
+    0x724C7A2AE1C5CCBDULL, 0x02DB7EE703E55912ULL, 0x5B7061BBE7D17097ULL, 0x1BE2CBEC031DE0DCULL,
+    0x4926B496530DF3ACULL, 0x164F09899C17E716ULL, 0x750ABA8A1E7CB913ULL, 0x3D4B4275C68CA4F0ULL,
+    0x5DA22ED4E530940FULL, 0x4AA29B916BA3B726ULL, 0x4AE825771DC07672ULL, 0x6EE87C74561C9285ULL,
+    0x77D9D58B62CD8A51ULL, 0x3173FA53BCFA8408ULL, 0x5FE177A2B5713B74ULL, 0x278FFB7630C869A0ULL,
+    0x4CB45FB55DF42F90ULL, 0x1FA662C4F3D387B3ULL, 0x7ABA32BBC986B280ULL, 0x32A3D13B1FB8D91FULL,
+    0x622E8EFCA1388ECDULL, 0x0EE9742F4C93E0E6ULL, 0x4E8BA596E760723DULL, 0x58BAC3590A0FE71EULL,
+    0x7DAC3C24A5671D2FULL, 0x412AD228101971C9ULL, 0x6489C9B6EAB8E426ULL, 0x00EF0E8673478E3BULL,
+    0x506E3AF8BBC71CEBULL, 0x1A58D86B8F6C71C9ULL, 0x40582F2D6305B0BCULL, 0x1513E0560C56C16EULL,
+    0x66F37EAF04D5E793ULL, 0x3B530089AD579BE2ULL, 0x525C6558D0AB1FA9ULL, 0x15DC006E2446164FULL,
+    0x41E384470D55B2EDULL, 0x5E4999F1B69E783FULL, 0x696C06D81555EB15ULL, 0x7D428FE92430C065ULL,
+    0x54566BE0111188DEULL, 0x31020CBA835A3384ULL, 0x4378564CDA746D7EULL, 0x5A680A2ECF7B5C69ULL,
+    0x6BF3BD47C3ED7BFDULL, 0x770CDD17B25EFA42ULL, 0x565C976C9CBDFCCBULL, 0x1270B0DFC1E59502ULL,
+    0x4516DF8A16FE63D5ULL, 0x5B8D5A4C9B1E10CEULL, 0x6E8AFF4357FD6C89ULL, 0x127BC3ADC4FCE7B0ULL,
+    0x586F329C466456D4ULL, 0x0EC96957D0CA52F3ULL, 0x46BF5BB038504576ULL, 0x3F07877973D50F29ULL,
+    0x71322C4D26E6D58AULL, 0x31A5A58F1FBB4B75ULL, 0x5A8E89D75252446EULL, 0x5AEAEAD8E62F6F91ULL,
+    0x487207DF750E9D25ULL, 0x2F22557A51BF8C74ULL, 0x73E9A63254E42EA2ULL, 0x1836EF2A1C65AD86ULL,
+    0x5CBAEB5B771CF21BULL, 0x2CF8BF54E3848AD2ULL, 0x4A2F22AF927D8E7CULL, 0x23FA32AA4F9D3BDBULL,
+    0x76B1D118EA627D93ULL, 0x5329EAAA18FB92F8ULL, 0x5EF4A74721E86476ULL, 0x0F54BBBB472FA8C6ULL,
+    0x4BF6EC38E7ED1D2BULL, 0x25DD62FC38F2ED6CULL, 0x798B138E3FE1C845ULL, 0x22FBD1938E517BDFULL,
+    0x613C0FA4FFE7D36AULL, 0x4F2FDADC71DAC97FULL, 0x4DC9A61D998642BBULL, 0x58F3157D27E23ACCULL,
+    0x7C75D695C2706AC5ULL, 0x74B82261D969F7ADULL, 0x63917877CEC0556BULL, 0x10934EB4ADEE5FBEULL,
+    0x4FA793930BCD1122ULL, 0x4075D8908B251965ULL, 0x7F7285B812E1B504ULL, 0x00BC8DB411D4F56EULL,
+    0x65F537C675815D9CULL, 0x66FD3E29A7DD9125ULL, 0x5190F96B91344AE3ULL, 0x6BFDCB54864ADA84ULL,
+    0x4140C78940F6A24FULL, 0x6FFE3C439EA2486AULL, 0x6867A5A867F103B2ULL, 0x7FFD2D38FDD073DCULL,
+    0x53861E2053273628ULL, 0x6664242D97D9F64AULL, 0x42D1B1B375B8F820ULL, 0x51E9B68ADFE191D5ULL,
+    0x6AE91C5255F4C034ULL, 0x1CA924116635B621ULL, 0x558749DB77F70029ULL, 0x63BA83411E915E81ULL,
+    0x446C3B15F9926687ULL, 0x6962029A7EDAB201ULL, 0x6D79F82328EA3DA6ULL, 0x0F03375D97C45001ULL,
+    0x5794C6828721CAEBULL, 0x259C2C4ADFD04001ULL, 0x46109ECED2816F22ULL, 0x5149BD08B30D0001ULL,
+    0x701A97B150CF1837ULL, 0x3542C80DEB480001ULL, 0x59AEDFC10D7279C5ULL, 0x7768A00B22A00001ULL,
+    0x47BF19673DF52E37ULL, 0x79208008E8800001ULL, 0x72CB5BD86321E38CULL, 0x5B67334174000001ULL,
+    0x5BD5E313828182D6ULL, 0x7C528F6790000001ULL, 0x4977E8DC68679BDFULL, 0x16A872B940000001ULL,
+    0x758CA7C70D7292FEULL, 0x5773EAC200000001ULL, 0x5E0A1FD271287598ULL, 0x45F6556800000001ULL,
+    0x4B3B4CA85A86C47AULL, 0x04C5112000000001ULL, 0x785EE10D5DA46D90ULL, 0x07A1B50000000001ULL,
+    0x604BE73DE4838AD9ULL, 0x52E7C40000000001ULL, 0x4D0985CB1D3608AEULL, 0x0F1FD00000000001ULL,
+    0x7B426FAB61F00DE3ULL, 0x31CC800000000001ULL, 0x629B8C891B267182ULL, 0x5B0A000000000001ULL,
+    0x4EE2D6D415B85ACEULL, 0x7C08000000000001ULL, 0x7E37BE2022C0914BULL, 0x1340000000000001ULL,
+    0x64F964E68233A76FULL, 0x2900000000000001ULL, 0x50C783EB9B5C85F2ULL, 0x5400000000000001ULL,
+    0x409F9CBC7C4A04C2ULL, 0x1000000000000001ULL, 0x6765C793FA10079DULL, 0x0000000000000001ULL,
+    0x52B7D2DCC80CD2E4ULL, 0x0000000000000001ULL, 0x422CA8B0A00A4250ULL, 0x0000000000000001ULL,
+    0x69E10DE76676D080ULL, 0x0000000000000001ULL, 0x54B40B1F852BDA00ULL, 0x0000000000000001ULL,
+    0x43C33C1937564800ULL, 0x0000000000000001ULL, 0x6C6B935B8BBD4000ULL, 0x0000000000000001ULL,
+    0x56BC75E2D6310000ULL, 0x0000000000000001ULL, 0x4563918244F40000ULL, 0x0000000000000001ULL,
+    0x6F05B59D3B200000ULL, 0x0000000000000001ULL, 0x58D15E1762800000ULL, 0x0000000000000001ULL,
+    0x470DE4DF82000000ULL, 0x0000000000000001ULL, 0x71AFD498D0000000ULL, 0x0000000000000001ULL,
+    0x5AF3107A40000000ULL, 0x0000000000000001ULL, 0x48C2739500000000ULL, 0x0000000000000001ULL,
+    0x746A528800000000ULL, 0x0000000000000001ULL, 0x5D21DBA000000000ULL, 0x0000000000000001ULL,
+    0x4A817C8000000000ULL, 0x0000000000000001ULL, 0x7735940000000000ULL, 0x0000000000000001ULL,
+    0x5F5E100000000000ULL, 0x0000000000000001ULL, 0x4C4B400000000000ULL, 0x0000000000000001ULL,
+    0x7A12000000000000ULL, 0x0000000000000001ULL, 0x61A8000000000000ULL, 0x0000000000000001ULL,
+    0x4E20000000000000ULL, 0x0000000000000001ULL, 0x7D00000000000000ULL, 0x0000000000000001ULL,
+    0x6400000000000000ULL, 0x0000000000000001ULL, 0x5000000000000000ULL, 0x0000000000000001ULL,
+    0x4000000000000000ULL, 0x0000000000000001ULL, 0x6666666666666666ULL, 0x3333333333333334ULL,
+    0x51EB851EB851EB85ULL, 0x0F5C28F5C28F5C29ULL, 0x4189374BC6A7EF9DULL, 0x5916872B020C49BBULL,
+    0x68DB8BAC710CB295ULL, 0x74F0D844D013A92BULL, 0x53E2D6238DA3C211ULL, 0x43F3E0370CDC8755ULL,
+    0x431BDE82D7B634DAULL, 0x698FE69270B06C44ULL, 0x6B5FCA6AF2BD215EULL, 0x0F4CA41D811A46D4ULL,
+    0x55E63B88C230E77EULL, 0x3F70834ACDAE9F10ULL, 0x44B82FA09B5A52CBULL, 0x4C5A02A23E254C0DULL,
+    0x6DF37F675EF6EADFULL, 0x2D5CD10396A21347ULL, 0x57F5FF85E592557FULL, 0x3DE3DA69454E75D3ULL,
+    0x465E6604B7A84465ULL, 0x7E4FE1EDD10B9175ULL, 0x709709A125DA0709ULL, 0x4A19697C81AC1BEFULL,
+    0x5A126E1A84AE6C07ULL, 0x54E1213067BCE326ULL, 0x480EBE7B9D58566CULL, 0x43E74DC052FD8285ULL,
+    0x734ACA5F6226F0ADULL, 0x530BAF9A1E626A6DULL, 0x5C3BD5191B525A24ULL, 0x426FBFAE7EB521F1ULL,
+    0x49C97747490EAE83ULL, 0x4EBFCC8B9890E7F4ULL, 0x760F253EDB4AB0D2ULL, 0x4ACC7A78F41B0CBAULL,
+    0x5E72843249088D75ULL, 0x223D2EC729AF3D62ULL, 0x4B8ED0283A6D3DF7ULL, 0x34FDBF05BAF29781ULL,
+    0x78E480405D7B9658ULL, 0x54C931A2C4B758CFULL, 0x60B6CD004AC94513ULL, 0x5D6DC14F03C5E0A5ULL,
+    0x4D5F0A66A23A9DA9ULL, 0x31249AA59C9E4D51ULL, 0x7BCB43D769F762A8ULL, 0x4EA0F76F60FD4882ULL,
+    0x63090312BB2C4EEDULL, 0x254D92BF80CAA068ULL, 0x4F3A68DBC8F03F24ULL, 0x1DD7A89933D54D20ULL,
+    0x7EC3DAF941806506ULL, 0x62F2A75B86221500ULL, 0x65697BFA9ACD1D9FULL, 0x025BB91604E810CDULL,
+    0x51212FFBAF0A7E18ULL, 0x684960DE6A5340A4ULL, 0x40E7599625A1FE7AULL, 0x203AB3E521DC33B6ULL,
+    0x67D88F56A29CCA5DULL, 0x19F7863B696052BDULL, 0x5313A5DEE87D6EB0ULL, 0x7B2C6B62BAB37564ULL,
+    0x42761E4BED31255AULL, 0x2F56BC4EFBC2C450ULL, 0x6A5696DFE1E83BC3ULL, 0x655793B192D13A1AULL,
+    0x5512124CB4B9C969ULL, 0x377942F475742E7BULL, 0x440E750A2A2E3ABAULL, 0x5F9435905DF68B96ULL,
+    0x6CE3EE76A9E3912AULL, 0x65B9EF4D63241289ULL, 0x571CBEC554B60DBBULL, 0x6AFB25D782834207ULL,
+    0x45B0989DDD5E7163ULL, 0x08C8EB12CECF6806ULL, 0x6F80F42FC8971BD1ULL, 0x5ADB11B7B14BD9A3ULL,
+    0x5933F68CA078E30EULL, 0x157C0E2C8DD647B5ULL, 0x475CC53D4D2D8271ULL, 0x5DFCD823A4AB6C91ULL,
+    0x722E086215159D82ULL, 0x632E269F6DDF141BULL, 0x5B5806B4DDAAE468ULL, 0x4F581EE5F17F4349ULL,
+    0x49133890B1558386ULL, 0x72ACE584C1329C3BULL, 0x74EB8DB44EEF38D7ULL, 0x6AAE3C079B842D2AULL,
+    0x5D893E29D8BF60ACULL, 0x5558300616035755ULL, 0x4AD431BB13CC4D56ULL, 0x7779C004DE6912ABULL,
+    0x77B9E92B52E07BBEULL, 0x258F99A163DB5111ULL, 0x5FC7EDBC424D2FCBULL, 0x37A614811CAF740DULL,
+    0x4C9FF163683DBFD5ULL, 0x7951AA00E3BF900BULL, 0x7A998238A6C932EFULL, 0x754F7667D2CC19ABULL,
+    0x6214682D523A8F26ULL, 0x2AA5F8530F09AE22ULL, 0x4E76B9BDDB620C1EULL, 0x55519375A5A1581BULL,
+    0x7D8AC2C95F034697ULL, 0x3BB5B8BC3C3559C5ULL, 0x646F023AB2690545ULL, 0x7C9160969691149EULL,
+    0x5058CE955B87376BULL, 0x16DAB3ABABA743B2ULL, 0x40470BAAAF9F5F88ULL, 0x78AEF622EFB902F5ULL,
+    0x66D812AAB29898DBULL, 0x0DE4BD04B2C19E54ULL, 0x524675555BAD4715ULL, 0x57EA30D08F014B76ULL,
+    0x41D1F7777C8A9F44ULL, 0x4654F3DA0C01092CULL, 0x694FF258C7443207ULL, 0x23BB1FC346680EACULL,
+    0x543FF513D29CF4D2ULL, 0x4FC8E635D1ECD88AULL, 0x43665DA9754A5D75ULL, 0x263A51C4A7F0AD3BULL,
+    0x6BD6FC425543C8BBULL, 0x56C3B607731AAEC4ULL, 0x5645969B77696D62ULL, 0x789C919F8F488BD0ULL,
+    0x4504787C5F878AB5ULL, 0x46E3A7B2D906D640ULL, 0x6E6D8D93CC0C1122ULL, 0x3E390C515B3E239AULL,
+    0x5857A4763CD6741BULL, 0x4B60D6A77C31B615ULL, 0x46AC8391CA4529AFULL, 0x55E7121F968E2B44ULL,
+    0x711405B6106EA919ULL, 0x0971B698F0E3786DULL, 0x5A766AF80D255414ULL, 0x078E2BAD8D82C6BDULL,
+    0x485EBBF9A41DDCDCULL, 0x6C71BC8AD79BD231ULL, 0x73CAC65C39C96161ULL, 0x2D82C7448C2C8382ULL,
+    0x5CA23849C7D44DE7ULL, 0x3E023903A356CF9BULL, 0x4A1B603B06437185ULL, 0x7E682D9C82ABD949ULL,
+    0x76923391A39F1C09ULL, 0x4A4048FA6AAC8EDBULL, 0x5EDB5C7482E5B007ULL, 0x55003A61EEF07249ULL,
+    0x4BE2B05D35848CD2ULL, 0x773361E7F259F507ULL, 0x796AB3C855A0E151ULL, 0x3EB89CA6508FEE71ULL,
+    0x6122296D114D810DULL, 0x7EFA16EB73A6585BULL, 0x4DB4EDF0DAA4673EULL, 0x3261ABEF8FB846AFULL,
+    0x7C54AFE7C43A3ECAULL, 0x1D691318E5F3A44BULL, 0x6376F31FD02E98A1ULL, 0x64540F471E5C836FULL,
+    0x4F925C1973587A1BULL, 0x0376729F4B7D35F3ULL, 0x7F50935BEBC0C35EULL, 0x38BD84321261EFEBULL,
+    0x65DA0F7CBC9A35E5ULL, 0x13CAD0280EB4BFEFULL, 0x517B3F96FD482B1DULL, 0x5CA240200BC3CCBFULL,
+    0x412F66126439BC17ULL, 0x63B50019A3030A33ULL, 0x684BD683D38F9359ULL, 0x1F88002904D1A9EAULL,
+    0x536FDECFDC72DC47ULL, 0x32D3335403DAEE55ULL, 0x42BFE57316C249D2ULL, 0x5BDC291003158B77ULL,
+    0x6ACCA251BE03A951ULL, 0x12F9DB4CD1BC1258ULL, 0x557081DAFE695440ULL, 0x7594AF70A7C9A847ULL,
+    0x445A017BFEBAA9CDULL, 0x4476F2C0863AED06ULL, 0x6D5CCF2CCAC442E2ULL, 0x3A57EACDA3917B3CULL,
+    0x577D728A3BD03581ULL, 0x7B7988A482DAC8FDULL, 0x45FDF53B630CF79BULL, 0x15FAD3B6CF156D97ULL,
+    0x6FFCBB923814BF5EULL, 0x565E1F8AE4EF15BEULL, 0x5996FC74F9AA32B2ULL, 0x11E4E608B725AAFFULL,
+    0x47ABFD2A6154F55BULL, 0x27EA51A0928488CCULL, 0x72ACC843CEEE555EULL, 0x7310829A84074146ULL,
+    0x5BBD6D030BF1DDE5ULL, 0x42739BAED005CDD2ULL, 0x49645735A327E4B7ULL, 0x4EC2E2F24004A4A8ULL,
+    0x756D5855D1D96DF2ULL, 0x4AD16B1D333AA10CULL, 0x5DF11377DB1457F5ULL, 0x2241227DC2954DA3ULL,
+    0x4B2742C648DD132AULL, 0x4E9A81FE35443E1CULL, 0x783ED13D4161B844ULL, 0x175D9CC9EED39694ULL,
+    0x603240FDCDE7C69CULL, 0x7917B0A18BDC7876ULL, 0x4CF500CB0B1FD217ULL, 0x1412F3B46FE39392ULL,
+    0x7B219ADE7832E9BEULL, 0x535185ED7FD285B6ULL, 0x628148B1F9C25498ULL, 0x42A79E57997537C5ULL,
+    0x4ECDD3C1949B76E0ULL, 0x3552E512E12A9304ULL, 0x7E161F9C20F8BE33ULL, 0x6EEB081E3510EB39ULL,
+    0x64DE7FB01A609829ULL, 0x3F226CE4F740BC2EULL, 0x50B1FFC0151A1354ULL, 0x3281F0B72C33C9BEULL,
+    0x408E66334414DC43ULL, 0x42018D5F568FD498ULL, 0x674A3D1ED354939FULL, 0x1CCF48988A7FBA8DULL,
+    0x52A1CA7F0F76DC7FULL, 0x30A5D3AD3B99620BULL, 0x421B0865A5F8B065ULL, 0x73B7DC8A96144E6FULL,
+    0x69C4DA3C3CC11A3CULL, 0x52BFC7442353B0B1ULL, 0x549D7B6363CDAE96ULL, 0x756639034F7626F4ULL,
+    0x43B12F82B63E2545ULL, 0x4451C735D92B525DULL, 0x6C4EB26ABD303BA2ULL, 0x3A1C71EFC1DEEA2EULL,
+    0x56A55B889759C94EULL, 0x61B05B2634B254F2ULL, 0x45511606DF7B0772ULL, 0x1AF37C1E908EAA5BULL,
+    0x6EE8233E325E7250ULL, 0x2B1F2CFDB41776F8ULL, 0x58B9B5CB5B7EC1D9ULL, 0x6F4C23FE29AC5F2DULL,
+    0x46FAF7D5E2CBCE47ULL, 0x72A34FFE87BD18F1ULL, 0x71918C896ADFB073ULL, 0x04387FFDA5FB5B1BULL,
+    0x5ADAD6D4557FC05CULL, 0x0360666484C915AFULL, 0x48AF1243779966B0ULL, 0x02B3851D3707448CULL,
+    0x744B506BF28F0AB3ULL, 0x1DEC082EBE720746ULL, 0x5D090D2328726EF5ULL, 0x64BCD358985B3905ULL,
+    0x4A6DA41C205B8BF7ULL, 0x6A30A913AD15C738ULL, 0x7715D36033C5ACBFULL, 0x5D1AA81F7B560B8CULL,
+    0x5F44A919C3048A32ULL, 0x7DAEECE5FC44D609ULL, 0x4C36EDAE359D3B5BULL, 0x7E258A51969D7808ULL,
+    0x79F17C49EF61F893ULL, 0x16A276E8F0FBF33FULL, 0x618DFD07F2B4C6DCULL, 0x121B9253F3FCC299ULL,
+    0x4E0B30D328909F16ULL, 0x41AFA84329970214ULL, 0x7CDEB4850DB431BDULL, 0x4F7F739EA8F19CEDULL,
+    0x63E55D373E29C164ULL, 0x3F99294BBA5AE3F1ULL, 0x4FEAB0F8FE87CDE9ULL, 0x7FADBAA2FB7BE98DULL,
+    0x7FDDE7F4CA72E30FULL, 0x7F7C5DD1925FDC15ULL, 0x664B1FF7085BE8D9ULL, 0x4C637E4141E649ABULL,
+    0x51D5B32C06AFED7AULL, 0x704F983434B83AEFULL, 0x4177C2899EF32462ULL, 0x26A6135CF6F9C8BFULL,
+    0x68BF9DA8FE51D3D0ULL, 0x3DD685618B294132ULL, 0x53CC7E20CB74A973ULL, 0x4B12044E08EDCDC2ULL,
+    0x4309FE80A2C3BAC2ULL, 0x6F419D0B3A57D7CEULL, 0x6B4330CDD1392AD1ULL, 0x320294DEC3BFBFB0ULL,
+    0x55CF5A3E40FA88A7ULL, 0x419BAA4BCFCC995AULL, 0x44A5E1CB672ED3B9ULL, 0x1AE2EEA30CA3ADE1ULL,
+    0x6DD636123EB152C1ULL, 0x77D17DD1ADD2AFCFULL, 0x57DE91A832277567ULL, 0x797464A7BE42263FULL,
+    0x464BA7B9C1B92AB9ULL, 0x4790508631CE84FFULL, 0x70790C5C6928445CULL, 0x0C1A1A704FB0D4CCULL,
+    0x59FA7049EDB9D049ULL, 0x567B4859D95A43D6ULL, 0x47FB8D07F161736EULL, 0x11FC39E17AAE9CABULL,
+    0x732C14D98235857DULL, 0x032D2968C44A9445ULL, 0x5C2343E134F79DFDULL, 0x4F575453D03BA9D1ULL,
+    0x49B5CFE75D92E4CAULL, 0x72AC4376402FBB0EULL, 0x75EFB30BC8EB07ABULL, 0x0446D256CD192B49ULL,
+    0x5E595C096D88D2EFULL, 0x1D0575123DADBC3AULL, 0x4B7AB0078AD3DBF2ULL, 0x4A6AC40E97BE302FULL,
+    0x78C44CD8DE1FC650ULL, 0x771139B0F2C9E6B1ULL, 0x609D0A4718196B73ULL, 0x78DA948D8F07EBC1ULL,
+    0x4D4A6E9F467ABC5CULL, 0x60AEDD3E0C065634ULL, 0x7BAA4A9870C46094ULL, 0x344AFB9679A3BD20ULL,
+    0x62EEA2138D69E6DDULL, 0x103BFC78614FCA80ULL, 0x4F254E760ABB1F17ULL, 0x26966393810CA200ULL,
+    0x7EA21723445E9825ULL, 0x2423D2859B476999ULL, 0x654E78E9037EE01DULL, 0x69B642047C392148ULL,
+    0x510B93ED9C658017ULL, 0x6E2B680396941AA0ULL, 0x40D60FF149EACCDFULL, 0x71BC53361210154DULL,
+    0x67BCE64EDCAAE166ULL, 0x1C6085235019BBAEULL, 0x52FD850BE3BBE784ULL, 0x7D1A041C40149625ULL,
+    0x42646A6FE9631F9DULL, 0x4A7B367D0010781DULL, 0x6A3A43E642383295ULL, 0x5D91F0C8001A59C8ULL,
+    0x54FB698501C68EDEULL, 0x17A7F3D3334847D4ULL, 0x43FC546A67D20BE4ULL, 0x79532975C2A03976ULL,
+    0x6CC6ED770C83463BULL, 0x0EEB75893766C256ULL, 0x57058AC5A39C382FULL, 0x25892AD42C523512ULL,
+    0x459E089E1C7CF9BFULL, 0x37A0EF102374F742ULL, 0x6F6340FCFA618F98ULL, 0x59017E8038BB2536ULL,
+    0x591C33FD951AD946ULL, 0x7A67986693C8EA91ULL, 0x4749C33144157A9FULL, 0x151FAD1EDCA0BBA8ULL,
+    0x720F9EB539BBF765ULL, 0x0832AE97C76792A5ULL, 0x5B3FB22A94965F84ULL, 0x068EF21305EC7551ULL,
+    0x48FFC1BBAA11E603ULL, 0x1ED8C1A8D189F774ULL, 0x74CC692C434FD66BULL, 0x4AF4690E1C0FF253ULL,
+    0x5D705423690CAB89ULL, 0x225D20D816732843ULL, 0x4AC0434F873D5607ULL, 0x35174D79AB8F5369ULL,
+    0x779A054C0B955672ULL, 0x21BEE25C45B21F0EULL, 0x5FAE6AA33C77785BULL, 0x3498B5169E2818D8ULL,
+    0x4C8B888296C5F9E2ULL, 0x5D46F7454B534713ULL, 0x7A78DA6A8AD65C9DULL, 0x7BA4BED545520B52ULL,
+    0x61FA48553BDEB07EULL, 0x2FB6FF110441A2A8ULL, 0x4E61D37763188D31ULL, 0x72F8CC0D9D014EEDULL,
+    0x7D6952589E8DAEB6ULL, 0x1E5AE015C80217E1ULL, 0x645441E07ED7BEF8ULL, 0x1848B344A001ACB4ULL,
+    0x504367E6CBDFCBF9ULL, 0x603A2903B3348A2AULL, 0x4035ECB8A3196FFBULL, 0x002E873628F6D4EEULL,
+    0x66BCADF43828B32BULL, 0x19E40B89DB2487E3ULL, 0x52308B29C686F5BCULL, 0x14B66FA17C1D3983ULL,
+    0x41C06F549ED25E30ULL, 0x1091F2E7967DC79CULL, 0x6933E554315096B3ULL, 0x341CB7D8F0C93F5FULL,
+    0x542984435AA6DEF5ULL, 0x767D5FE0C0A0FF80ULL, 0x435469CF7BB8B25EULL, 0x2B977FE70080CC66ULL,
+    0x6BBA42E592C11D63ULL, 0x5F58CCA4CD9AE0A3ULL, 0x562E9BEADBCDB11CULL, 0x4C470A1D7148B3B6ULL,
+    0x44F216557CA48DB0ULL, 0x3D05A1B1276D5C92ULL, 0x6E5023BBFAA0E2B3ULL, 0x7B3C35E83F1560E9ULL,
+    0x58401C96621A4EF6ULL, 0x2F635E5365AAB3EDULL, 0x4699B0784E7B725EULL, 0x591C4B75EAEEF658ULL,
+    0x70F5E726E3F8B6FDULL, 0x74FA125644B18A26ULL, 0x5A5E5285832D5F31ULL, 0x43FB41DE9D5AD4EBULL,
+    0x484B75379C244C27ULL, 0x4FFC34B2177BDD89ULL, 0x73ABEEBF603A1372ULL, 0x4CC6BAB68BF96274ULL,
+    0x5C898BCC4CFB42C2ULL, 0x0A38955ED6611B90ULL, 0x4A07A309D72F689BULL, 0x21C6DDE5784DAFA7ULL,
+    0x76729E762518A75EULL, 0x693E2FD58D49190BULL, 0x5EC2185E8413B918ULL, 0x5431BFDE0AA0E0D5ULL,
+    0x4BCE79E536762DADULL, 0x29C1664B3BB3E711ULL, 0x794A5CA1F0BD15E2ULL, 0x0F9BD6DEC5ECA4E8ULL,
+    0x61084A1B26FDAB1BULL, 0x2616457F04BD50BAULL, 0x4DA03B48EBFE227CULL, 0x1E783798D09773C8ULL,
+    0x7C33920E46636A60ULL, 0x30C058F480F252D9ULL, 0x635C74D8384F884DULL, 0x0D66AD9067284247ULL,
+    0x4F7D2A469372D370ULL, 0x711EF14052869B6CULL, 0x7F2EAA0A85848581ULL, 0x34FE4ECD50D75F14ULL,
+    0x65BEEE6ED136D134ULL, 0x2A650BD773DF7F43ULL, 0x51658B8BDA9240F6ULL, 0x551DA312C319329CULL,
+    0x411E093CAEDB672BULL, 0x5DB14F4235ADC217ULL, 0x68300EC77E2BD845ULL, 0x7C4EE536BC49368AULL,
+    0x5359A56C64EFE037ULL, 0x7D0BEA92303A9208ULL, 0x42AE1DF050BFE693ULL, 0x173CBBA8269541A0ULL,
+    0x6AB02FE6E79970EBULL, 0x3EC792A6A422029AULL, 0x5559BFEBEC7AC0BCULL, 0x3239421EE9B4CEE1ULL,
+    0x4447CCBCBD2F0096ULL, 0x5B6101B25490A581ULL, 0x6D3FADFAC84B3424ULL, 0x2BCE691D541AA268ULL,
+    0x576624C8A03C29B6ULL, 0x563EBA7DDCE21B87ULL, 0x45EB50A08030215EULL, 0x78322ECB171B4939ULL,
+    0x6FDEE76733803564ULL, 0x59E9E47824F87527ULL, 0x597F1F85C2CCF783ULL, 0x6187E9F9B72D2A86ULL,
+    0x4798E6049BD72C69ULL, 0x346CBB2E2C242205ULL, 0x728E3CD42C8B7A42ULL, 0x20ADF849E039D007ULL,
+    0x5BA4FD768A092E9BULL, 0x33BE603B19C7D99FULL, 0x4950CAC53B3A8BAFULL, 0x42FEB3627B0647B3ULL,
+    0x754E113B91F745E5ULL, 0x5197856A5E7072B8ULL, 0x5DD80DC941929E51ULL, 0x27AC6ABB7EC05BC6ULL,
+    0x4B133E3A9ADBB1DAULL, 0x52F05562CBCD1638ULL, 0x781EC9F75E2C4FC4ULL, 0x1E4D556ADFAE89F3ULL,
+    0x6018A192B1BD0C9CULL, 0x7EA444557FBED4C3ULL, 0x4CE0814227CA707DULL, 0x4BB69D1132FF109CULL,
+    0x7B00CED03FAA4D95ULL, 0x5F8A94E851981A93ULL, 0x62670BD9CC883E11ULL, 0x32D543ED0E134875ULL,
+    0x4EB8D647D6D364DAULL, 0x5BDDCFF0D80F6D2BULL, 0x7DF48A0C8AEBD491ULL, 0x12FC7FE7C018AEABULL,
+    0x64C3A1A3A25643A7ULL, 0x28C9FFEC99AD5889ULL, 0x509C814FB511CFB9ULL, 0x0707FFF07AF113A1ULL,
+    0x407D343FC40E3FC7ULL, 0x1F39998D2F2742E7ULL, 0x672EB9FFA016CC71ULL, 0x7EC28F484B7204A4ULL,
+    0x528BC7FFB345705BULL, 0x189BA5D36F8E6A1DULL, 0x42096CCC8F6AC048ULL, 0x7A161E42BFA521B1ULL,
+    0x69A8AE1418AACD41ULL, 0x435696D132A1CF81ULL, 0x5486F1A9AD557101ULL, 0x1C454574288172CEULL,
+    0x439F27BAF1112734ULL, 0x169DD129BA0128A5ULL, 0x6C31D92B1B4EA520ULL, 0x242FB50F9001DAA1ULL,
+    0x568E4755AF721DB3ULL, 0x368C90D940017BB4ULL, 0x453E9F77BF8E7E29ULL, 0x120A0D7A999AC95DULL,
+    0x6ECA98BF98E3FD0EULL, 0x50101590F5C47561ULL, 0x58A213CC7A4FFDA5ULL, 0x26734473F7D05DE8ULL,
+    0x46E80FD6C83FFE1DULL, 0x6B8F69F65FD9E4B9ULL, 0x71734C8AD9FFFCFCULL, 0x45B24323CC8FD45CULL,
+    0x5AC2A3A247FFFD96ULL, 0x6AF502830A0CA9E3ULL, 0x489BB61B6CCCCADFULL, 0x08C402026E7087E9ULL,
+    0x742C569247AE1164ULL, 0x746CD003E3E73FDBULL, 0x5CF04541D2F1A783ULL, 0x76BD73364FEC3315ULL,
+    0x4A59D101758E1F9CULL, 0x5EFDF5C50CBCF5ABULL, 0x76F61B3588E365C7ULL, 0x4B2FEFA1ADFB22ABULL,
+    0x5F2B48F7A0B5EB06ULL, 0x08F3261AF195B555ULL, 0x4C22A0C61A2B226BULL, 0x20C284E25ADE2AABULL,
+    0x79D1013CF6AB6A45ULL, 0x1AD0D49D5E304444ULL, 0x617400FD9222BB6AULL, 0x48A7107DE4F369D0ULL,
+    0x4DF6673141B562BBULL, 0x53B8D9FE50C2BB0DULL, 0x7CBD71E869223792ULL, 0x52C15CCA1AD12B48ULL,
+    0x63CAC186BA81C60EULL, 0x75677D6E7BDA8906ULL, 0x4FD5679EFB9B04D8ULL, 0x5DEC645863153A6CULL,
+    0x7FBBD8FE5F5E6E27ULL, 0x497A3A2704EEC3DFULL
+};
+
+
+/**
+ * @brief A decimal floating-point value: significand * 10^exponent.
+ */
+struct decimal_floating_point
+{
+    std::uint64_t significand;
+    int exponent;
+};
+
+
+// floor(__q * log10(2))
+[[nodiscard]] constexpr int floor_log10_pow2(int __q) noexcept
+{ return static_cast<int>((__q * 661'971'961'083LL) >> 41); }
+
+// floor(log10(3/4 * 2^__q))
+[[nodiscard]] constexpr int floor_log10_three_quarters_pow2(int __q) noexcept
+{ return static_cast<int>((__q * 661'971'961'083LL - 274'743'187'321LL) >> 41); }
+
+// floor(__e * log2(10))
+[[nodiscard]] constexpr int floor_log2_pow10(int __e) noexcept
+{ return static_cast<int>((__e * 913'124'641'741LL) >> 38); }
+
+_KWARGS_Test_(floor_log10_pow2(10), 3); _KWARGS_Test_(floor_log10_pow2(-1), -1); _KWARGS_Test_(floor_log2_pow10(3), 9);
+
+
+template<typename _Tp>
+[[nodiscard]] constexpr auto floating_point_to_bits(_Tp __n) noexcept -> typename binary_format<_Tp>::bits_type
+{
+    typename binary_format<_Tp>::bits_type bits = 0;
+
+#if defined(__has_builtin)
+#   if __has_builtin(__builtin_bit_cast)
+    if (is_constant_evaluated())
+    {
+        return __builtin_bit_cast(decltype(bits), __n);
+    }
+#   endif
+#endif
+
+    std::memcpy(&bits, &__n, sizeof(bits));
+    return bits;
+}
+
+
+/**
+ * @brief Finds the shortest decimal that rounds back to @c __c * 2^__q (Schubfach).
+ * 
+ * Among the shortest candidates, the one closest to the exact value is chosen.
+ * @c __dk is -1 when @c __c has been multiplied by 10 to gain precision for tiny subnormals.
+ */
+template<typename _Tp>
+[[nodiscard]] constexpr decimal_floating_point to_shortest_decimal(int __q, std::uint64_t __c, int __dk) noexcept
+{
+    using binary = binary_format<_Tp>;
+
+    constexpr std::uint64_t c_min = 1ULL << binary::mantissa_explicit_bits;
+    constexpr int q_min = binary::minimum_exponent + 1 - binary::mantissa_explicit_bits;
+
+    const int out = static_cast<int>(__c & 1);
+
+    const std::uint64_t cb  = __c << 2;
+    const std::uint64_t cbr = cb + 2;
+
+    std::uint64_t cbl = 0;
+    int k = 0;
+
+    if (__c != c_min || __q == q_min)
+    {
+        cbl = cb - 2;
+        k = floor_log10_pow2(__q);
+    }
+    else
+    {
+        // The predecessor of a power of two is closer.
+        cbl = cb - 1;
+        k = floor_log10_three_quarters_pow2(__q);
+    }
+
+    const std::size_t index = 2 * static_cast<std::size_t>(k + 324);
+
+    std::uint64_t vb = 0, vbl = 0, vbr = 0;
+
+    if constexpr (std::is_same_v<_Tp, float>)
+    {
+        const int h = __q + floor_log2_pow10(-k) + 33;
+
+        const std::uint64_t g = power_of_ten_126[index] + 1;
+
+        // floor(g * cp / 2^95), rounded to odd.
+        auto round_to_odd = [g](std::uint64_t __cp) constexpr noexcept -> std::uint64_t
+        {
+            const std::uint64_t x1 = full_multiplication(g, __cp).high;
+
+            return (x1 >> 31) | static_cast<std::uint64_t>((x1 & 0x7FFF'FFFFULL) != 0);
+        };
+
+        vb  = round_to_odd(cb  << h);
+        vbl = round_to_odd(cbl << h);
+        vbr = round_to_odd(cbr << h);
+    }
+    else
+    {
+        const int h = __q + floor_log2_pow10(-k) + 2;
+
+        const std::uint64_t g1 = power_of_ten_126[index];
+        const std::uint64_t g0 = power_of_ten_126[index + 1];
+
+        // floor((g1 * 2^63 + g0) * cp / 2^127), rounded to odd.
+        auto round_to_odd = [g1, g0](std::uint64_t __cp) constexpr noexcept -> std::uint64_t
+        {
+            constexpr std::uint64_t mask = (1ULL << 63) - 1;
+
+            const std::uint64_t x1 = full_multiplication(g0, __cp).high;
+            const uint128_parts y  = full_multiplication(g1, __cp);
+
+            const std::uint64_t z = (y.low >> 1) + x1;
+
+            return (y.high + (z >> 63)) | static_cast<std::uint64_t>((z & mask) != 0);
+        };
+
+        vb  = round_to_odd(cb  << h);
+        vbl = round_to_odd(cbl << h);
+        vbr = round_to_odd(cbr << h);
+    }
+
+    const std::uint64_t s = vb >> 2;
+
+    if (s >= 10)
+    {
+        // One digit shorter: s' = floor(s / 10).
+        const std::uint64_t sp10 = 10 * (s / 10);
+        const std::uint64_t tp10 = sp10 + 10;
+
+        const bool upin = vbl + out <= (sp10 << 2);
+        const bool wpin = (tp10 << 2) + out <= vbr;
+
+        if (upin != wpin)
+        {
+            return { upin ? sp10 : tp10, k };
+        }
+    }
+
+    const std::uint64_t t = s + 1;
+
+    const bool uin = vbl + out <= (s << 2);
+    const bool win = (t << 2) + out <= vbr;
+
+    if (uin != win)
+    {
+        return { uin ? s : t, k + __dk };
+    }
+
+    // Both are in the rounding interval: take the closer one, or the even one on a tie.
+    const auto cmp = static_cast<std::int64_t>(vb - ((s + t) << 1));
+
+    return { (cmp < 0 || (cmp == 0 && (s & 1) == 0)) ? s : t, k + __dk };
+}
+
+template<typename _Tp>
+[[nodiscard]] constexpr decimal_floating_point to_shortest_decimal_unnormalized(_Tp __n) noexcept
+{
+    using binary = binary_format<_Tp>;
+
+    constexpr int precision = binary::mantissa_explicit_bits + 1;
+    constexpr int q_min = binary::minimum_exponent + 1 - binary::mantissa_explicit_bits;
+
+    const std::uint64_t bits = floating_point_to_bits(__n);
+
+    const std::uint64_t t = bits & ((1ULL << binary::mantissa_explicit_bits) - 1);
+    const int bq = static_cast<int>(bits >> binary::mantissa_explicit_bits) & binary::infinite_power;
+
+    if (bq != 0)
+    {
+        const int mq = -q_min + 1 - bq;
+        const std::uint64_t c = (1ULL << binary::mantissa_explicit_bits) | t;
+
+        // Integers below 2^precision are their own shortest representation.
+        if (0 < mq && mq < precision && ((c >> mq) << mq) == c)
+        {
+            return { c >> mq, 0 };
+        }
+
+        return to_shortest_decimal<_Tp>(-mq, c, 0);
+    }
+
+    return to_shortest_decimal<_Tp>(q_min, t, 0);
+}
+
+/**
+ * @brief Finds the shortest decimal that rounds back to the finite, nonzero @c __n, ignoring its sign.
+ * 
+ * The significand has no trailing zeros.
+ */
+template<typename _Tp>
+[[nodiscard]] constexpr decimal_floating_point to_shortest_decimal(_Tp __n) noexcept
+{
+    decimal_floating_point result = to_shortest_decimal_unnormalized(__n);
+
+    for (; result.significand % 10 == 0; result.significand /= 10, ++result.exponent);
+
+    return result;
+}
+
+
+#if defined(__has_builtin)
+#   if __has_builtin(__builtin_bit_cast)
+_KWARGS_Test_(to_shortest_decimal(0.1).significand, 1ULL);        _KWARGS_Test_(to_shortest_decimal(0.1).exponent, -1);
+_KWARGS_Test_(to_shortest_decimal(0.3f).significand, 3ULL);       _KWARGS_Test_(to_shortest_decimal(0.3f).exponent, -1);
+_KWARGS_Test_(to_shortest_decimal(5e-324).significand, 5ULL);     _KWARGS_Test_(to_shortest_decimal(5e-324).exponent, -324);
+_KWARGS_Test_(to_shortest_decimal(1.7976931348623157e308).significand, 17976931348623157ULL);
+#   endif
+#endif
+
+
+/**
+ * @brief Writes @c __n in fixed notation with the fewest digits that read back as @c __n.
+ * 
+ * Digits that the shortest representation leaves as trailing zeros of an integer are written exactly,
+ * as std::to_chars does, e.g. 1e30 gives "1000000000000000019884624838656".
+ * 
+ * @return Pointer past the last written character.
+ */
+template<typename _Tp>
+constexpr char* shortest_floating_point_to_chars(char* __first, _Tp __n) noexcept
+{
+    using binary = binary_format<_Tp>;
+
+    const std::uint64_t bits = floating_point_to_bits(__n);
+
+    const std::uint64_t t = bits & ((1ULL << binary::mantissa_explicit_bits) - 1);
+    const int bq = static_cast<int>(bits >> binary::mantissa_explicit_bits) & binary::infinite_power;
+
+    auto append = [&__first](std::string_view __str) constexpr noexcept -> char*
+    {
+        for (char c : __str)
+        {
+            *__first++ = c;
+        }
+
+        return __first;
+    };
+
+    if (bq == binary::infinite_power && t != 0)
+    {
+        return append("NaN");
+    }
+
+    if (bits >> (sizeof(typename binary::bits_type) * 8 - 1))
+    {
+        *__first++ = '-';
+    }
+
+    if (bq == binary::infinite_power)
+    {
+        return append("inf");
+    }
+    else if (bq == 0 && t == 0)
+    {
+        return append("0");
+    }
+
+    const auto [significand, exponent] = to_shortest_decimal(__n);
+
+    if (exponent > 0)
+    {
+        // The value is an integer; write all of its digits.
+        const std::uint64_t c = (bq == 0 ? t : t | (1ULL << binary::mantissa_explicit_bits));
+        const int q = (bq == 0 ? 1 : bq) + binary::minimum_exponent - binary::mantissa_explicit_bits;
+
+        if (q < 0)
+        {
+            return unsigned_to_decimal_chars(__first, c >> -q);
+        }
+        else if (q < 64 - binary::mantissa_explicit_bits)
+        {
+            return unsigned_to_decimal_chars(__first, c << q);
+        }
+
+        return binary_to_decimal_chars<binary::mantissa_explicit_bits + 1 - binary::minimum_exponent>(__first, c, q);
+    }
+
+    char digits[20] = {};
+
+    const int count = static_cast<int>(unsigned_to_decimal_chars(digits, significand) - digits);
+    const int point = count + exponent;
+
+    if (point <= 0)
+    {
+        *__first++ = '0';
+        *__first++ = '.';
+
+        for (int i = point; i < 0; ++i)
+        {
+            *__first++ = '0';
+        }
+
+        return copy(digits, digits + count, __first);
+    }
+
+    __first = copy(digits, digits + point, __first);
+
+    if (point < count)
+    {
+        *__first++ = '.';
+        __first = copy(digits + point, digits + count, __first);
+    }
+
+    return __first;
+}
+
+
+template<typename _Tp>
+static constexpr inline std::size_t legacy_floating_point_chars_max_v =
+    conditional_value_v<sizeof(_Tp) == sizeof(float), 50, conditional_value_v<sizeof(_Tp) == sizeof(double), 400, 5000>>;
+
+// Digit by digit; used for extended long double and by the precision macros.
+// Writes at most legacy_floating_point_chars_max_v<_Tp> characters.
+template<typename _Tp>
+constexpr char* legacy_floating_point_to_chars(char* __buffer, _Tp __n) noexcept
+{
+    auto append = [__buffer](std::string_view __str) constexpr noexcept -> char* {
+        return copy(__str.begin(), __str.end(), __buffer);
+    };
+
+    floating_point_layout<_Tp> value;
+    value.f = __n;
+
+    if (value.is_nan())
+    {
+        return append("NaN");
+    }
+    else if (value.is_inf())
+    {
+        if (value.is_negative())
+        {
+            return append("-inf");
+        }
+        else
+        {
+            return append("inf");
+        }
+    }
+
+    constexpr std::size_t buffer_size = legacy_floating_point_chars_max_v<_Tp>;
+
+    char* const buffer = __buffer;
+
+    std::size_t cpos = 0;
+
+    if (value.is_negative())
+    {
+        buffer[cpos++] = '-';
+        value.s.sign = false;
+    }
+
+    int exponent = value.exponent();
+
+    std::uint64_t significand = value.significand();
+
+    if (exponent < 0)
+    {
+        buffer[cpos++] = '0';
+    }
+    else
+    {
+        const int shift = value.significand_bit() - exponent;
+
+        value.s.exponent = static_cast<decltype(value.s.exponent)>(value.bias());
+
+        if (shift > 0)
+        {
+            value.s.significand &= (1ULL << shift) - 1;
+            value.s.significand <<= exponent;
+        }
+        else if (shift < 0)
+        {
+            value.s.significand = 0;
+        }
+
+        cpos = static_cast<std::size_t>(binary_to_decimal_chars<value.bias() + 1>(buffer + cpos, significand, -shift) - buffer);
+
+        --value.f;
+    }
+
+    if (value.f)
+    {
+        buffer[cpos++] = '.';
+    }
+
+    auto check = [&]() constexpr noexcept -> bool {
+#if defined(KWARGS_CONVERT_REALS_TO_STRINGS_WITH_HEURISTIC_PRECISION)
+        if (exponent < 0)
+        {
+            return static_cast<bool>(value.f);
+        }
+#endif
+
+#if defined(KWARGS_CONVERT_REALS_TO_STRINGS_WITH_FIXED_FLOAT_PRECISION)
+        if constexpr (std::is_same_v<_Tp, float>)
+        {
+            return value.f > static_cast<float>(KWARGS_CONVERT_REALS_TO_STRINGS_WITH_FIXED_FLOAT_PRECISION);
+        }
+#endif
+
+#if defined(KWARGS_CONVERT_REALS_TO_STRINGS_WITH_FIXED_DOUBLE_PRECISION)
+        if constexpr (std::is_same_v<_Tp, double>)
+        {
+            return value.f > static_cast<double>(KWARGS_CONVERT_REALS_TO_STRINGS_WITH_FIXED_DOUBLE_PRECISION);
+        }
+#endif
+
+#if defined(KWARGS_CONVERT_REALS_TO_STRINGS_WITH_FIXED_LONG_DOUBLE_PRECISION)
+        if constexpr (std::is_same_v<_Tp, long double>)
+        {
+            return value.f > static_cast<long double>(KWARGS_CONVERT_REALS_TO_STRINGS_WITH_FIXED_LONG_DOUBLE_PRECISION);
+        }
+#endif
+
+#if defined(KWARGS_CONVERT_REALS_TO_STRINGS_WITH_FIXED_PRECISION)
+        return value.f > static_cast<_Tp>(KWARGS_CONVERT_REALS_TO_STRINGS_WITH_FIXED_PRECISION);
+#elif defined(KWARGS_CONVERT_REALS_TO_STRINGS_WITH_HEURISTIC_PRECISION)
+        if constexpr (sizeof(_Tp) == sizeof(float))
+        {
+            return value.f > 1e-6f;
+        }
+        else if constexpr (sizeof(_Tp) == sizeof(double))
+        {
+            return value.f > 1e-12;
+        }
+        else
+        {
+            return value.f > 1e-18L;
+        }
+#else
+        return static_cast<bool>(value.f);
+#endif
+    };
+
+
+    while (check() && cpos < buffer_size)
+    {
+        value.f *= 10;
+        buffer[cpos++] = '0' + static_cast<char>(value.f);
+
+        value.f -= static_cast<decltype(value.f)>(static_cast<int>(value.f));
+    }
+
+    return buffer + cpos;
+}
+
+// The precision macros select the digit-by-digit conversion.
+template<typename _Tp>
+static constexpr inline bool is_shortest_floating_point_conversion_v =
+#if defined(KWARGS_CONVERT_REALS_TO_STRINGS_WITH_HEURISTIC_PRECISION) || defined(KWARGS_CONVERT_REALS_TO_STRINGS_WITH_FIXED_PRECISION)
+    false;
+#else
+#   if defined(KWARGS_CONVERT_REALS_TO_STRINGS_WITH_FIXED_FLOAT_PRECISION)
+    std::is_same_v<_Tp, float> == false &&
+#   endif
+#   if defined(KWARGS_CONVERT_REALS_TO_STRINGS_WITH_FIXED_DOUBLE_PRECISION)
+    std::is_same_v<_Tp, double> == false &&
+#   endif
+    std::numeric_limits<_Tp>::is_iec559
+    && (std::numeric_limits<_Tp>::digits == 24 || std::numeric_limits<_Tp>::digits == 53);
+#endif
+
+/**
+ * @brief The most characters floating_point_to_chars writes for a @c _Tp.
+ * 
+ * "-0." + 323 zeros + 17 digits for the smallest double.
+ */
+template<typename _Tp>
+static constexpr inline std::size_t floating_point_chars_max_v =
+    is_shortest_floating_point_conversion_v<_Tp>
+        ? (std::numeric_limits<_Tp>::digits == 24 ? 64 : 350)
+        : legacy_floating_point_chars_max_v<_Tp>;
+
+template<typename _Tp>
+constexpr char* floating_point_to_chars(char* __first, _Tp __n) noexcept
+{
+    if constexpr (is_shortest_floating_point_conversion_v<_Tp>)
+    {
+        using engine_type = std::conditional_t<std::numeric_limits<_Tp>::digits == 24, float, double>;
+
+        return shortest_floating_point_to_chars(__first, static_cast<engine_type>(__n));
+    }
+    else
+    {
+        return legacy_floating_point_to_chars(__first, __n);
+    }
+}
+
+template<typename _Res, typename _Tp>
+[[nodiscard]] constexpr auto floating_point_to_string(_Tp __n) noexcept
+        -> std::enable_if_t<is_std_string_v<_Res> && std::is_floating_point_v<_Tp>, std::remove_reference_t<_Res>>
+{
+    using buffer_type = std::array<char, floating_point_chars_max_v<_Tp>>;
+
+    return with_scratch<buffer_type>([__n](buffer_type& __buffer) constexpr noexcept -> std::remove_reference_t<_Res> {
+        const char* const last = floating_point_to_chars(__buffer.data(), __n);
+
+        return std::remove_reference_t<_Res>(static_cast<const char*>(__buffer.data()), static_cast<std::size_t>(last - __buffer.data()));
+    });
+}
+
+/**
+ * @brief |n| = significand * 2^exponent for a finite floating-point value.
+ */
+struct binary_floating_point
+{
+    std::uint64_t significand;
+    int exponent;
+    bool negative;
+};
+
+template<typename _Tp>
+[[nodiscard]] constexpr binary_floating_point decompose_floating_point(_Tp __n) noexcept
+{
+    if constexpr (std::numeric_limits<_Tp>::is_iec559
+        && (std::numeric_limits<_Tp>::digits == 24 || std::numeric_limits<_Tp>::digits == 53))
+    {
+        using engine_type = std::conditional_t<std::numeric_limits<_Tp>::digits == 24, float, double>;
+        using binary = binary_format<engine_type>;
+
+        const std::uint64_t bits = floating_point_to_bits(static_cast<engine_type>(__n));
+
+        const std::uint64_t t = bits & ((1ULL << binary::mantissa_explicit_bits) - 1);
+        const int bq = static_cast<int>((bits >> binary::mantissa_explicit_bits) & binary::infinite_power);
+
+        const bool negative = static_cast<bool>(bits >> (sizeof(typename binary::bits_type) * 8 - 1));
+
+        if (bq == 0)
+        {
+            return { t, 1 + binary::minimum_exponent - binary::mantissa_explicit_bits, negative };
+        }
+
+        return { t | (1ULL << binary::mantissa_explicit_bits), bq + binary::minimum_exponent - binary::mantissa_explicit_bits, negative };
+    }
+    else
+    {
+        floating_point_layout<_Tp> value;
+        value.f = __n;
+
+        const int raw_exponent = static_cast<int>(value.s.exponent);
+
+        return {
+            raw_exponent ? value.significand() : static_cast<std::uint64_t>(value.s.significand),
+            (raw_exponent ? raw_exponent : 1) - value.bias() - value.significand_bit(),
+            value.is_negative() };
+    }
+}
+
+/**
+ * @brief Large enough for floor(significand * 2^exponent * 10^precision) of any @c _Tp,
+ *        with precision at most the number of exact fractional digits.
+ */
+template<typename _Tp>
+static constexpr inline std::size_t scaled_floating_point_bits_v =
+    64 + std::max<std::size_t>(
+        static_cast<std::size_t>(std::numeric_limits<_Tp>::max_exponent - std::numeric_limits<_Tp>::digits),
+        static_cast<std::size_t>(std::numeric_limits<_Tp>::digits - std::numeric_limits<_Tp>::min_exponent) * 2322 / 1000 + 1);
+
+/**
+ * @brief Sets @c __result to floor(__significand * 2^__exponent * 10^__precision), in integer arithmetic.
+ * 
+ * @return How the dropped fraction compares with one half: 0 none, 1 below, 2 exactly, 3 above.
+ */
+template<std::size_t _Bits>
+constexpr int scaled_binary_to_decimal(decimal_limbs<_Bits>& __result, std::uint64_t __significand, int __exponent, int __precision) noexcept
+{
+    // 10^p = 5^p * 2^p
+    const int shift = __exponent + __precision;
+
+    auto multiply_by_power_of_five = [__precision](auto& __limbs, auto __multiply) constexpr noexcept -> void {
+        constexpr std::uint32_t power_of_five_13 = 1'220'703'125;
+
+        int p = __precision;
+
+        for (; p >= 13; p -= 13)
+        {
+            __multiply(__limbs, power_of_five_13);
+        }
+
+        std::uint32_t rest = 1;
+
+        for (; p; --p)
+        {
+            rest *= 5;
+        }
+
+        __multiply(__limbs, rest);
+    };
+
+    if (shift >= 0)
+    {
+        __result.assign(__significand);
+
+        multiply_by_power_of_five(__result, [](auto& __limbs, std::uint32_t __n) constexpr noexcept { __limbs.multiply_add(__n, 0); });
+
+        __result.shift_left(shift);
+
+        return 0;
+    }
+
+    return with_scratch<binary_limbs<_Bits>>([&](binary_limbs<_Bits>& __value) constexpr noexcept -> int {
+        __value.assign(__significand);
+
+        multiply_by_power_of_five(__value, [](auto& __limbs, std::uint32_t __n) constexpr noexcept { __limbs.multiply(__n); });
+
+        const auto dropped = static_cast<std::size_t>(-shift);
+
+        const bool half = __value.bit(dropped - 1);
+        const bool sticky = __value.any_bit_below(dropped - 1);
+
+        __value.shift_right(dropped);
+        __value.to_decimal(__result);
+
+        return (half ? 2 : 0) + static_cast<int>(sticky);
+    });
+}
+
+/**
+ * @brief Writes @c __n with exactly @c __precision fractional digits, or, if @c __scientific,
+ *        as d.ddd...e+dd with @c __precision digits after the point, like printf("%.*f") and printf("%.*e").
+ * 
+ * The value is rounded half to even from its exact binary value in integer arithmetic;
+ * the work is bounded by the requested digits, and digits past the exact expansion are zeros.
+ */
+template<typename _Res, typename _Tp>
+[[nodiscard]] _KWARGS_NON_LITERAL_FUNCTION_CONSTEXPR auto formatted_floating_point_to_string(_Tp __n, bool __scientific, int __precision) noexcept
+        -> std::enable_if_t<is_std_string_v<_Res> && std::is_floating_point_v<_Tp>, std::remove_reference_t<_Res>>
+{
+    using string_type = std::remove_cv_t<std::remove_reference_t<_Res>>;
+
+    clamp<int>(__precision, 0, 1 << 20);
+
+    if (__n != __n)
+    {
+        return string_type("NaN");
+    }
+    else if (__n == std::numeric_limits<_Tp>::infinity())
+    {
+        return string_type("inf");
+    }
+    else if (__n == -std::numeric_limits<_Tp>::infinity())
+    {
+        return string_type("-inf");
+    }
+
+    const auto [significand, exponent, negative] = decompose_floating_point(__n);
+
+    // v * 10^p is an integer once p reaches -exponent; further digits are zeros.
+    auto exact_precision = [exponent = exponent](int __p) constexpr noexcept -> int {
+        return std::min(__p, std::max(0, -exponent));
+    };
+
+    auto round_half_to_even = [](auto& __limbs, int __remainder) constexpr noexcept -> void {
+        if (__remainder == 3 || (__remainder == 2 && __limbs.size && (__limbs.limbs[0] & 1)))
+        {
+            __limbs.multiply_add(1, 1);
+        }
+    };
+
+    using limbs_type = decimal_limbs<scaled_floating_point_bits_v<_Tp>>;
+
+    return with_scratch<limbs_type>([&, significand = significand, exponent = exponent, negative = negative](limbs_type& __digits) -> string_type {
+        string_type result;
+
+        if (negative)
+        {
+            result.push_back('-');
+        }
+
+        auto append_digits = [&result](const auto& __limbs, std::size_t __count) -> void {
+            const std::size_t pos = result.size();
+
+            result.resize(pos + __count);
+            __limbs.to_chars(&result[pos]);
+        };
+
+        if (__scientific == false)
+        {
+            const int precision = exact_precision(__precision);
+
+            round_half_to_even(__digits, scaled_binary_to_decimal(__digits, significand, exponent, precision));
+
+            const std::size_t count = __digits.digit_count();
+            const auto fraction = static_cast<std::size_t>(precision);
+
+            if (count > fraction)
+            {
+                append_digits(__digits, count);
+                result.insert(result.end() - static_cast<std::ptrdiff_t>(fraction), '.');
+            }
+            else
+            {
+                result.append("0.");
+                result.append(fraction - count, '0');
+                append_digits(__digits, count);
+            }
+
+            result.append(static_cast<std::size_t>(__precision - precision), '0');
+
+            if (__precision == 0)
+            {
+                result.pop_back();
+            }
+
+            return result;
+        }
+
+        // Decimal exponent, and the first __precision + 1 significant digits.
+        int decimal_exponent = 0;
+        std::size_t padding = 0;
+
+        if (significand == 0)
+        {
+            __digits.assign(0U);
+            padding = static_cast<std::size_t>(__precision);
+        }
+        else
+        {
+            // Either the decimal exponent or one less.
+            decimal_exponent = floor_log10_pow2(63 - count_leading_zeros(significand) + exponent);
+
+            bool rounded = false;
+
+            if (decimal_exponent >= __precision)
+            {
+                // At least as many integer digits as requested: round the integer part.
+                const int remainder = scaled_binary_to_decimal(__digits, significand, exponent, 0);
+
+                const std::size_t count = __digits.digit_count();
+                const std::size_t keep = static_cast<std::size_t>(__precision) + 1;
+
+                decimal_exponent = static_cast<int>(count) - 1;
+
+                if (count >= keep)
+                {
+                    const std::size_t pos = result.size();
+
+                    append_digits(__digits, count);
+
+                    bool round_up = false;
+
+                    if (count == keep)
+                    {
+                        round_up = (remainder == 3 || (remainder == 2 && ((result.back() - '0') & 1)));
+                    }
+                    else
+                    {
+                        bool rest = (remainder != 0);
+
+                        for (std::size_t i = pos + keep + 1; i < result.size() && rest == false; ++i)
+                        {
+                            rest = (result[i] != '0');
+                        }
+
+                        const char first_dropped = result[pos + keep];
+
+                        result.resize(pos + keep);
+
+                        round_up = (first_dropped > '5' || (first_dropped == '5' && (rest || ((result.back() - '0') & 1))));
+                    }
+
+                    if (round_up)
+                    {
+                        std::size_t i = result.size();
+
+                        for (; i > pos && result[i - 1] == '9'; --i)
+                        {
+                            result[i - 1] = '0';
+                        }
+
+                        if (i == pos)
+                        {
+                            result[pos] = '1';
+                            ++decimal_exponent;
+                        }
+                        else
+                        {
+                            ++result[i - 1];
+                        }
+                    }
+
+                    rounded = true;
+                }
+            }
+
+            while (rounded == false)
+            {
+                const int scale = __precision - decimal_exponent;
+                const int precision = exact_precision(scale);
+
+                round_half_to_even(__digits, scaled_binary_to_decimal(__digits, significand, exponent, precision));
+
+                padding = static_cast<std::size_t>(scale - precision);
+
+                const std::size_t count = __digits.digit_count() + padding;
+
+                if (count > static_cast<std::size_t>(__precision) + 1)
+                {
+                    ++decimal_exponent;
+
+                    if (scale == 0)
+                    {
+                        // Rounded up to 10^(__precision + 1).
+                        __digits.assign(1U);
+                        padding = static_cast<std::size_t>(__precision);
+
+                        break;
+                    }
+                }
+                else if (count < static_cast<std::size_t>(__precision) + 1)
+                {
+                    --decimal_exponent;
+                }
+                else
+                {
+                    break;
+                }
+            }
+
+            if (rounded)
+            {
+                __digits.size = 0;
+            }
+        }
+
+        if (__digits.size || significand == 0)
+        {
+            append_digits(__digits, __digits.digit_count());
+            result.append(padding, '0');
+        }
+
+        const std::size_t first_digit = negative ? 1 : 0;
+
+        if (__precision)
+        {
+            result.insert(result.begin() + static_cast<std::ptrdiff_t>(first_digit + 1), '.');
+        }
+
+        result.push_back('e');
+        result.push_back(decimal_exponent < 0 ? '-' : '+');
+
+        char exponent_digits[8] = {};
+        const char* const exponent_last = unsigned_to_decimal_chars(exponent_digits, static_cast<std::uint64_t>(decimal_exponent < 0 ? -decimal_exponent : decimal_exponent));
+
+        if (exponent_last - exponent_digits < 2)
+        {
+            result.push_back('0');
+        }
+
+        result.append(static_cast<const char*>(exponent_digits), exponent_last);
+
+        return result;
+    });
+}
+
+template<typename _Res, typename _Tp>
+[[nodiscard]] constexpr auto pointer_to_string(const _Tp* __n) noexcept
+    -> std::enable_if_t<is_std_string_v<_Res>, std::remove_reference_t<_Res>>
+{ return integer_to_string<_Res>(reinterpret_cast<std::uintptr_t>(__n), 16); }
+
+template<typename _Res, typename _Tp>
+[[nodiscard]] constexpr auto number_to_string(_Tp __n) noexcept
+        -> std::enable_if_t<is_std_string_v<_Res> && std::disjunction_v<is_integral_or_enum<_Tp>, std::is_floating_point<_Tp>, is_pointer<_Tp>>, std::remove_reference_t<_Res>>
+{
+    if constexpr (std::is_integral_v<_Tp>)
+    {
+        return integer_to_string<_Res>(__n);
+    }
+    else if constexpr (std::is_floating_point_v<_Tp>)
+    {
+        return floating_point_to_string<_Res>(__n);
+    }
+    else
+    {
+        return pointer_to_string<_Res>(__n);
+    }
+}
+
+
+using string_hash_type = std::uint64_t;
+
+constexpr string_hash_type string_hash_base = 0X1C1ULL;
+constexpr string_hash_type string_hash_mod  = 0X91F5BCB8BB0243ULL;
+
+static_assert(
+    std::less_equal<string_hash_type>{}(string_hash_mod, std::numeric_limits<string_hash_type>::max() / string_hash_base),
+    "cpp-kwargs: The expression 'string_hash_base * string_hash_mod' overflows.");
+
+static_assert(is_prime(string_hash_base)
+#if !defined(_KWARGS_HAS_UINT128)
+        || string_hash_base > 0x100000000ULL
+#endif  
+        , "cpp-kwargs: 'string_hash_base' must be a prime number.");
+
+static_assert(is_prime(string_hash_mod)
+#if !defined(_KWARGS_HAS_UINT128)
+        || string_hash_mod > 0x100000000ULL
+#endif  
+        , "cpp-kwargs: 'string_hash_mod' must be a prime number.");
+
+static_assert(std::gcd(string_hash_base, string_hash_mod) == 1, "cpp-kwargs: 'string_hash_base' and 'string_hash_mod' must be coprime.");
+
+
+
+constexpr string_hash_type string_hash_character(char __c) noexcept
+{
+    return static_cast<string_hash_type>(__c);
+}
+
+template<char _Char>
+constexpr string_hash_type string_hash_character() noexcept
+{
+    return string_hash_character(_Char);
+}
+
+
+/**
+ * @brief Hash policies for KwargsKey.
+ * 
+ * A policy folds one character into the hash with a constexpr @c append(__previous, __c),
+ * starting from 0. Define KWARGS_KEY_HASH_POLICY as one of them (or a type of your own)
+ * to choose the policy of the whole program; "name"_opt and KwargsKey("name") always agree.
+ */
+
+/// @brief BKDRHash, (__previous * string_hash_base + __c) mod string_hash_mod, with two divisions.
+struct modular_string_hash
+{
+    [[nodiscard]] _KWARGS_ATTRIBUTE_ALWAYS_INLINE static constexpr string_hash_type append(string_hash_type __previous, char __c) noexcept
+    { return ((__previous * string_hash_base) % string_hash_mod + string_hash_character(__c)) % string_hash_mod; }
+};
+
+/**
+ * @brief The same values as modular_string_hash with a single Barrett reduction.
+ * 
+ * Since __previous < string_hash_mod, the sum __previous * string_hash_base + __c cannot overflow
+ * and its quotient is below 2^9, which the small reciprocal estimates to within one.
+ */
+struct barrett_string_hash
+{
+    static constexpr string_hash_type reciprocal = std::numeric_limits<string_hash_type>::max() / string_hash_mod;
+
+    [[nodiscard]] _KWARGS_ATTRIBUTE_ALWAYS_INLINE static constexpr string_hash_type append(string_hash_type __previous, char __c) noexcept
+    {
+        const string_hash_type character = string_hash_character(__c);
+
+        if (character > std::numeric_limits<unsigned char>::max()) _KWARGS_ATTRIBUTE_UNLIKELY
+        {
+            // A negative char is sign-extended, and the sum wraps around in modular_string_hash.
+            return modular_string_hash::append(__previous, __c);
+        }
+
+        const string_hash_type sum = __previous * string_hash_base + character;
+        const string_hash_type quotient = ((sum >> 32) * reciprocal + (((sum & 0xFFFF'FFFFULL) * reciprocal) >> 32)) >> 32;
+
+        const string_hash_type remainder = sum - quotient * string_hash_mod;
+
+        return remainder >= string_hash_mod ? remainder - string_hash_mod : remainder;
+    }
+
+#if defined(_KWARGS_HAS_UINT128)
+    /// @brief string_hash_base^0 .. string_hash_base^8, reduced.
+    static constexpr std::array<string_hash_type, 9> powers = []() constexpr noexcept {
+        std::array<string_hash_type, 9> res{};
+        res[0] = 1;
+
+        for (std::size_t i = 1; i < res.size(); ++i)
+        {
+            res[i] = res[i - 1] * string_hash_base % string_hash_mod;
+        }
+
+        return res;
+    }();
+
+    /// @brief Appends 8 characters as one polynomial step with a single reduction; runtime only.
+    [[nodiscard]] static string_hash_type append_block(string_hash_type __previous, const char (&__block)[8]) noexcept
+    {
+        _KWARGS_UINT128 sum = static_cast<_KWARGS_UINT128>(__previous) * powers[8];
+
+        for (std::size_t i = 0; i < 8; ++i)
+        {
+            if (__block[i] < 0) _KWARGS_ATTRIBUTE_UNLIKELY
+            {
+                // Negative chars wrap around, see append().
+                for (const char c : __block)
+                {
+                    __previous = append(__previous, c);
+                }
+
+                return __previous;
+            }
+
+            sum += static_cast<_KWARGS_UINT128>(static_cast<string_hash_type>(__block[i]) * powers[7 - i]);
+        }
+
+        return static_cast<string_hash_type>(sum % string_hash_mod);
+    }
+#endif  // _KWARGS_HAS_UINT128
+};
+
+/// @brief One multiplication and one shift per character; the values differ from modular_string_hash.
+struct multiply_xorshift_string_hash
+{
+    static constexpr string_hash_type multiplier = 0x9E37'79B9'7F4A'7C15ULL;
+
+    [[nodiscard]] _KWARGS_ATTRIBUTE_ALWAYS_INLINE static constexpr string_hash_type append(string_hash_type __previous, char __c) noexcept
+    {
+        // Never xor with 0, so that a leading '\0' is not lost.
+        const string_hash_type mixed = (__previous ^ (static_cast<string_hash_type>(static_cast<unsigned char>(__c)) + 1)) * multiplier;
+
+        return mixed ^ (mixed >> 29);
+    }
+};
+
+_KWARGS_Test_(barrett_string_hash::append(string_hash_mod - 1, 'z'), modular_string_hash::append(string_hash_mod - 1, 'z'));
+_KWARGS_Test_(barrett_string_hash::append(string_hash_mod - 1, '\x80'), modular_string_hash::append(string_hash_mod - 1, '\x80'));
+_KWARGS_Test_(barrett_string_hash::append(0x1234'5678'9ABCULL, '\0'), modular_string_hash::append(0x1234'5678'9ABCULL, '\0'));
+
+#if defined(KWARGS_KEY_HASH_POLICY)
+using string_hash_policy = KWARGS_KEY_HASH_POLICY;
+#else
+using string_hash_policy = barrett_string_hash;
+#endif
+
+template<typename _Policy = string_hash_policy>
+_KWARGS_ATTRIBUTE_ALWAYS_INLINE constexpr string_hash_type string_hash_append(string_hash_type __previous, char __c) noexcept
+{
+    // Define KWARGS_KEY_CASE_INSENSITIVE to enable case-insensitivity for KwargsKey.
+
+#if defined(KWARGS_KEY_CASE_INSENSITIVE)
+    __c = tolower(__c);
+#endif
+
+    return _Policy::append(__previous, __c);
+}
+
+template<string_hash_type _Previous>
+constexpr string_hash_type string_hash_append_characters() noexcept
+{
+    return _Previous;
+}
+
+template<string_hash_type _Previous, char _Char, char... _Chars>
+constexpr string_hash_type string_hash_append_characters() noexcept
+{
+    return string_hash_append_characters<string_hash_append(_Previous, _Char), _Chars...>();
+}
+
+template<char... _Chars>
+constexpr string_hash_type string_hash_characters() noexcept
+{
+    return string_hash_append_characters<0, _Chars...>();
+}
+
+/// @brief Lowers the ASCII letters among 8 characters packed in __chunk, without a branch per character.
+[[nodiscard]] constexpr std::uint64_t swar_ascii_tolower(std::uint64_t __chunk) noexcept
+{
+    constexpr std::uint64_t ones = 0x0101'0101'0101'0101ULL;
+
+    // Bit 7 of each byte tells whether its low 7 bits are above 'Z' and at least 'A'.
+    const std::uint64_t heptets = __chunk & (ones * 0x7F);
+    const std::uint64_t above_z = heptets + ones * (0x7F - 'Z');
+    const std::uint64_t from_a  = heptets + ones * (0x80 - 'A');
+
+    const std::uint64_t is_upper = ~__chunk & (from_a ^ above_z) & (ones * 0x80);
+
+    return __chunk | (is_upper >> 2);
+}
+
+_KWARGS_Test_(swar_ascii_tolower(0x5A41'405B'7A61'C1DAULL), 0x7A61'405B'7A61'C1DAULL);
+_KWARGS_Test_(swar_ascii_tolower(0x4B'5741'5247'5321ULL), 0x6B'7761'7267'7321ULL);
+
+template<typename _Policy, typename = std::void_t<>>
+struct has_append_block : std::false_type { };
+
+template<typename _Policy>
+struct has_append_block<_Policy, std::void_t<decltype(_Policy::append_block(string_hash_type{}, std::declval<const char (&)[8]>()))>> : std::true_type { };
+
+template<typename _Policy>
+inline string_hash_type string_hash_append_block(string_hash_type __previous, const char (&__block)[8]) noexcept
+{
+    if constexpr (has_append_block<_Policy>::value)
+    {
+        return _Policy::append_block(__previous, __block);
+    }
+    else
+    {
+        for (const char c : __block)
+        {
+            __previous = _Policy::append(__previous, c);
+        }
+
+        return __previous;
+    }
+}
+
+/**
+ * @brief Appends the characters of [__first, __last) to __result in blocks of 8, using the
+ *        policy's append_block if it has one. With KWARGS_KEY_CASE_INSENSITIVE, the ASCII
+ *        letters of 16 (SSSE3) or 8 (SWAR) characters are lowered at once beforehand.
+ * 
+ * @note  Runtime only, fewer than 8 trailing characters are left to the caller.
+ * 
+ * @return The first character that was not consumed.
+ */
+template<typename _Policy>
+inline const char* string_hash_append_blocks(const char* __first, const char* __last, string_hash_type& __result) noexcept
+{
+    string_hash_type result = __result;
+
+#if defined(KWARGS_KEY_CASE_INSENSITIVE) && defined(_KWARGS_HAS_SSSE3)
+    for (; __last - __first >= 16; __first += 16)
+    {
+        const __m128i chunk    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__first));
+        const __m128i is_upper = _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(chunk, _mm_set1_epi8('Z' + 1)));
+
+        alignas(16) char folded[2][8];
+        _mm_store_si128(reinterpret_cast<__m128i*>(folded), _mm_or_si128(chunk, _mm_and_si128(is_upper, _mm_set1_epi8(0x20))));
+
+        result = string_hash_append_block<_Policy>(result, folded[0]);
+        result = string_hash_append_block<_Policy>(result, folded[1]);
+    }
+#endif
+
+    for (; __last - __first >= 8; __first += 8)
+    {
+        char block[8];
+
+#if defined(KWARGS_KEY_CASE_INSENSITIVE)
+        std::uint64_t chunk;
+        std::memcpy(&chunk, __first, sizeof(chunk));
+
+        chunk = swar_ascii_tolower(chunk);
+        std::memcpy(block, &chunk, sizeof(block));
+#else
+        std::memcpy(block, __first, sizeof(block));
+#endif
+
+        result = string_hash_append_block<_Policy>(result, block);
+    }
+
+    __result = result;
+    return __first;
+}
+
+/// @brief Character by character, for string literals: a loop the optimizer can still fold, unlike the blocks.
+template<typename _Policy = string_hash_policy>
+constexpr string_hash_type string_hash_literal(const char* const __str, std::size_t __len) noexcept
+{
+    string_hash_type result = 0;
+
+    for (std::size_t i = 0; i < __len; ++i)
+    {
+        result = string_hash_append<_Policy>(result, __str[i]);
+    }
+
+    return result;
+}
+
+template<typename _Policy = string_hash_policy>
+constexpr string_hash_type string_hash_string(const char* const __str, std::size_t __len) noexcept
+{
+    string_hash_type result = 0;
+
+    std::size_t i = 0;
+
+    if (is_constant_evaluated() == false)
+    {
+        i = static_cast<std::size_t>(string_hash_append_blocks<_Policy>(__str, __str + __len, result) - __str);
+    }
+    
+    for (; i < __len; ++i)
+    {
+        result = string_hash_append<_Policy>(result, __str[i]);
+    }
+
+    return result;
+}
+
+template<typename _Policy = string_hash_policy>
+constexpr string_hash_type string_hash_string(std::string_view __str) noexcept
+{
+    return string_hash_string<_Policy>(__str.data(), __str.size());
+}
+
+
+template<typename _Policy = string_hash_policy, std::size_t... _Indices>
+_KWARGS_ATTRIBUTE_ALWAYS_INLINE constexpr string_hash_type string_hash_unrolled(const char* const __str, std::index_sequence<_Indices...>) noexcept
+{
+    string_hash_type result = 0;
+    ((result = string_hash_append<_Policy>(result, __str[_Indices])), ...);
+    return result;
+}
+
+/**
+ * @brief Hashes the characters of a string literal, without the '\0', and without a loop up to 64 of them.
+ * 
+ * Once inlined into the caller, e.g. the std::pair of a { "name", value } argument, the hash
+ * folds to a constant even where nothing forces constant evaluation.
+ */
+template<std::size_t _Size>
+_KWARGS_ATTRIBUTE_ALWAYS_INLINE constexpr string_hash_type string_hash_array(const char (&__str)[_Size]) noexcept
+{
+    if constexpr (_Size - 1 <= 64)
+    {
+        return string_hash_unrolled(__str, std::make_index_sequence<_Size - 1>{});
+    }
+    else
+    {
+        return string_hash_literal(__str, _Size - 1);
+    }
+}
+
+_KWARGS_Test_(string_hash_array("kwargs"), string_hash_string("kwargs", 6));
+_KWARGS_Test_(string_hash_array(""), 0ULL);
+
+/// @brief The 32-bit hash of KwargsKey32, both halves of the 64-bit hash folded together.
+[[nodiscard]] constexpr std::uint32_t string_hash_fold32(string_hash_type __hash) noexcept
+{
+    return static_cast<std::uint32_t>(__hash ^ (__hash >> 32));
+}
+
+/// @brief Whether no two of the hashes are equal, optionally after folding them to 32 bits.
+template<bool _Fold32, string_hash_type... _Hashes>
+[[nodiscard]] constexpr bool string_hashes_distinct() noexcept
+{
+    constexpr std::size_t size = sizeof...(_Hashes);
+
+    if constexpr (size > 1)
+    {
+        const string_hash_type hashes[size] = { (_Fold32 ? string_hash_fold32(_Hashes) : _Hashes)... };
+
+        for (std::size_t i = 1; i < size; ++i)
+        {
+            for (std::size_t j = 0; j < i; ++j)
+            {
+                if (hashes[i] == hashes[j])
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+_KWARGS_Test_(string_hashes_distinct<false>());
+_KWARGS_Test_(string_hashes_distinct<false, 1, 2, 3>());
+_KWARGS_Test_(string_hashes_distinct<false, 1, 2, 1>(), false);
+_KWARGS_Test_(string_hashes_distinct<false, 1, 0x1'0000'0000ULL>());
+_KWARGS_Test_(string_hashes_distinct<true, 1, 0x1'0000'0000ULL>(), false);
+
+/// @brief A multiplicative hash from a 32-bit key to one of 2^bits slots.
+struct key_slot_layout
+{
+    std::uint32_t multiplier;
+    unsigned bits;
+
+    // False if no multiplier was found; the slot table is then not used.
+    bool perfect;
+
+    [[nodiscard]] constexpr std::size_t slot(std::uint32_t __key32) const noexcept
+    { return static_cast<std::uint32_t>(__key32 * multiplier) >> (32 - bits); }
+};
+
+/// @brief Searches for a layout that sends each of the 32-bit hashes to a slot of its own.
+template<string_hash_type... _Hashes>
+[[nodiscard]] constexpr key_slot_layout find_key_slot_layout() noexcept
+{
+    constexpr std::size_t size = sizeof...(_Hashes);
+    constexpr std::uint32_t hashes[size] = { string_hash_fold32(_Hashes)... };
+
+    unsigned min_bits = 1;
+
+    for (; (std::size_t(1) << min_bits) < size; ++min_bits);
+
+    // Up to one eighth full, and never more than 2^16 slots. Every multiplier is tried
+    // before the table doubles, since the slots are stored in each Kwargs.
+    for (unsigned bits = min_bits; bits <= min_bits + 3 && bits <= 16; ++bits)
+    {
+        for (std::uint32_t i = 0; i < 4096; ++i)
+        {
+            const key_slot_layout layout{ 0x9E37'79B1U * (2 * i + 1), bits, true };
+
+            // 2^(min_bits + 3) < 16 * size slots, one bit each.
+            std::uint64_t used[size / 4 + 1] = { };
+            bool perfect = true;
+
+            for (std::size_t j = 0; j < size && perfect; ++j)
+            {
+                const std::size_t slot = layout.slot(hashes[j]);
+                const std::uint64_t bit = std::uint64_t(1) << (slot % 64);
+
+                perfect = (used[slot / 64] & bit) == 0;
+                used[slot / 64] |= bit;
+            }
+
+            if (perfect)
+            {
+                return layout;
+            }
+        }
+    }
+
+    return { 1, 1, false };
+}
+
+/**
+ * @brief The compile-time slot table of a non-empty OptionalList.
+ * 
+ * Each slot records the key that may live there. Unused slots repeat the first key,
+ * which hashes to another slot, so no lookup ever matches them.
+ */
+template<string_hash_type... _Hashes>
+struct key_slot_table
+{
+    static_assert(sizeof...(_Hashes) != 0);
+
+    static constexpr key_slot_layout layout = find_key_slot_layout<_Hashes...>();
+
+    static constexpr std::size_t size = layout.perfect ? std::size_t(1) << layout.bits : 1;
+
+    struct keys_type
+    {
+        string_hash_type hashes[size];
+        std::uint32_t hashes32[size];
+    };
+
+    static constexpr keys_type keys = []() constexpr noexcept -> keys_type
+    {
+        constexpr string_hash_type hashes[] = { _Hashes... };
+
+        keys_type result{};
+
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            result.hashes[i] = hashes[0];
+            result.hashes32[i] = string_hash_fold32(hashes[0]);
+        }
+
+        if constexpr (layout.perfect)
+        {
+            for (string_hash_type hash : hashes)
+            {
+                result.hashes[layout.slot(string_hash_fold32(hash))] = hash;
+                result.hashes32[layout.slot(string_hash_fold32(hash))] = string_hash_fold32(hash);
+            }
+        }
+
+        return result;
+    }();
+};
+
+_KWARGS_Test_(key_slot_table<1, 2, 3, 4, 5, 6, 7, 8, 9, 10>::layout.perfect);
+_KWARGS_Test_(key_slot_table<9976677729ULL>::size, 2ULL);
+
+/// @brief The slot table type of an OptionalList, or void if there is no usable one.
+template<string_hash_type... _Hashes>
+struct key_slot_table_of
+{ using type = std::conditional_t<key_slot_table<_Hashes...>::layout.perfect, key_slot_table<_Hashes...>, void>; };
+
+template<>
+struct key_slot_table_of<>
+{ using type = void; };
+
+/// @brief _Tp once for each value of a pack.
+template<typename _Tp, auto>
+using repeat_t = _Tp;
+
+/**
+ * @brief The slots of a Kwargs, which take no space when there is no slot table.
+ * 
+ * Each slot holds one more than the position of its pair in the list, or zero if it is empty,
+ * so that a table is a quarter of the size it would be with pointers.
+ */
+template<typename _SlotTable>
+struct kwargs_slots
+{
+    using slot_type = std::uint16_t;
+
+    slot_type _M_slots[_SlotTable::size] = { };
+};
+
+template<>
+struct kwargs_slots<void>
+{ };
+
+/// @brief A list of key hashes.
+template<string_hash_type... _Hashes>
+struct key_list
+{
+    static constexpr std::array<string_hash_type, sizeof...(_Hashes)> hashes = {{ _Hashes... }};
+
+    [[nodiscard]] static constexpr bool contains(string_hash_type __hash) noexcept
+    { return ((__hash == _Hashes) || ...); }
+
+    [[nodiscard]] static constexpr bool lacks(string_hash_type __hash) noexcept
+    { return ((__hash != _Hashes) && ...); }
+
+    template<bool _Fold32>
+    [[nodiscard]] static constexpr bool distinct() noexcept
+    { return string_hashes_distinct<_Fold32, _Hashes...>(); }
+};
+
+/// @brief The concatenation of key_lists.
+template<typename... _Lists>
+struct key_list_cat;
+
+template<string_hash_type... _Hashes>
+struct key_list_cat<key_list<_Hashes...>>
+{ using type = key_list<_Hashes...>; };
+
+template<string_hash_type... _First, string_hash_type... _Second, typename... _Rest>
+struct key_list_cat<key_list<_First...>, key_list<_Second...>, _Rest...>
+    : key_list_cat<key_list<_First..., _Second...>, _Rest...>
+{ };
+
+_KWARGS_Test_(key_list_cat<key_list<1, 2>, key_list<>, key_list<3>>::type::hashes[2], 3ULL);
+
+template<typename _KeyList>
+struct key_slot_table_of_list;
+
+template<string_hash_type... _Hashes>
+struct key_slot_table_of_list<key_list<_Hashes...>> : key_slot_table_of<_Hashes...>
+{ };
+
+/// @brief Stands between two keys of an OptionalList to make the second an alias of the first, see kwargs::alias.
+inline constexpr string_hash_type alias_marker = std::numeric_limits<string_hash_type>::max();
+
+/// @brief Stands before the keys that a Kwargs hides, see kwargs::without.
+inline constexpr string_hash_type without_marker = alias_marker - 1;
+
+/// @brief Ends the OptionalList of a view with a slot table, as returned by Kwargs::only() and Kwargs::except().
+inline constexpr string_hash_type view_marker = alias_marker - 2;
+
+/// @brief Splits an OptionalList at the first kwargs::without into the keys it lists and the keys it hides,
+///        and tells whether it ends with the view_marker.
+template<string_hash_type... _OptionalList>
+struct option_list_parts
+{
+    static constexpr string_hash_type options[sizeof...(_OptionalList) + 1] = { _OptionalList..., 0 };
+
+    static constexpr bool view = sizeof...(_OptionalList) != 0 && options[sizeof...(_OptionalList) - 1] == view_marker;
+
+    // The number of options before the view_marker.
+    static constexpr std::size_t count = sizeof...(_OptionalList) - view;
+
+    static constexpr std::size_t split = []() constexpr noexcept
+    {
+        std::size_t i = 0;
+        for (; i < count && options[i] != without_marker; ++i);
+        return i;
+    }();
+
+    static constexpr bool hides = split != count;
+
+    template<std::size_t... _Indices>
+    static auto _S_listed(std::index_sequence<_Indices...>) -> key_list<options[_Indices]...>;
+
+    template<std::size_t... _Indices>
+    static auto _S_hidden(std::index_sequence<_Indices...>) -> key_list<options[split + 1 + _Indices]...>;
+
+    using listed = decltype(_S_listed(std::make_index_sequence<split>()));
+
+    using hidden = decltype(_S_hidden(std::make_index_sequence<hides ? count - split - 1 : 0>()));
+};
+
+/// @brief A key_list without the markers of kwargs::alias and kwargs::without.
+template<typename _KeyList>
+struct unmarked_key_list;
+
+template<string_hash_type... _Hashes>
+struct unmarked_key_list<key_list<_Hashes...>>
+    : key_list_cat<key_list<>,
+        std::conditional_t<_Hashes == alias_marker || _Hashes == without_marker, key_list<>, key_list<_Hashes>>...>
+{ };
+
+_KWARGS_Test_(unmarked_key_list<option_list_parts<1, alias_marker, 2, without_marker, 3>::listed>::type::hashes[1], 2ULL);
+_KWARGS_Test_(option_list_parts<1, without_marker, 3, alias_marker, 4>::hidden::hashes[2], 4ULL);
+_KWARGS_Test_(option_list_parts<1, alias_marker, 2, view_marker>::listed::hashes.size(), 3ULL);
+_KWARGS_Test_(option_list_parts<1, 2, view_marker>::view && option_list_parts<1, 2>::view == false);
+
+/// @brief The groups of an OptionalList: each key, followed by the keys that kwargs::alias joins to it.
+template<string_hash_type... _OptionalList>
+struct key_groups
+{
+    static constexpr string_hash_type options[sizeof...(_OptionalList) + 1] = { _OptionalList..., 0 };
+
+    // A marker stands between two keys.
+    static constexpr bool well_formed = []() constexpr noexcept
+    {
+        for (std::size_t i = 0; i < sizeof...(_OptionalList); ++i)
+        {
+            if (options[i] == alias_marker && (i == 0 || i + 1 == sizeof...(_OptionalList) || options[i + 1] == alias_marker))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }();
+
+    static constexpr std::size_t markers = ((_OptionalList == alias_marker) + ... + std::size_t(0));
+
+    static constexpr std::size_t count = well_formed ? sizeof...(_OptionalList) - 2 * markers : 0;
+
+    static constexpr std::array<std::size_t, count> sizes = []() constexpr noexcept
+    {
+        std::array<std::size_t, count> result{};
+
+        std::size_t group = 0;
+
+        for (std::size_t i = 0; i < sizeof...(_OptionalList) && well_formed; ++i)
+        {
+            if (options[i] == alias_marker)
+            {
+                ++result[group - 1];
+                ++i;
+            }
+            else
+            {
+                result[group++] = 1;
+            }
+        }
+
+        return result;
+    }();
+};
+
+_KWARGS_Test_(key_groups<1, alias_marker, 2, 3>::sizes[0], 2ULL);
+_KWARGS_Test_(key_groups<1, alias_marker, 2, alias_marker>::well_formed, false);
+
+template<typename _KeyList>
+struct key_groups_of_list;
+
+template<string_hash_type... _Hashes>
+struct key_groups_of_list<key_list<_Hashes...>> : key_groups<_Hashes...>
+{ };
+
+/**
+ * @brief Links the slots of each group of _KeyList, a key and then its aliases, into a cycle,
+ *        so that the constructor of Kwargs fills the slots of a whole group at once.
+ */
+template<typename _SlotTable, typename _KeyList, typename _Groups>
+struct key_slot_groups
+{
+    static constexpr bool aliased = _Groups::markers != 0;
+
+    static constexpr std::array<std::size_t, _SlotTable::size> next = []() constexpr noexcept
+    {
+        std::array<std::size_t, _SlotTable::size> result{};
+
+        for (std::size_t i = 0; i < result.size(); ++i)
+        {
+            result[i] = i;
+        }
+
+        constexpr auto sizes = _Groups::sizes;
+
+        auto slot = [](std::size_t __index) constexpr noexcept -> std::size_t
+        { return _SlotTable::layout.slot(string_hash_fold32(_KeyList::hashes[__index])); };
+
+        std::size_t first = 0;
+
+        for (std::size_t size : sizes)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                result[slot(first + i)] = slot(first + (i + 1) % size);
+            }
+
+            first += size;
+        }
+
+        return result;
+    }();
+};
+
+/**
+ * @brief The number of key hashes a Kwargs without a slot table keeps in a packed array,
+ *        set by KWARGS_PACKED_KEY_CAPACITY. Longer lists are scanned pair by pair.
+ */
+#if defined(KWARGS_PACKED_KEY_CAPACITY)
+inline constexpr std::size_t packed_key_capacity = KWARGS_PACKED_KEY_CAPACITY;
+#else
+inline constexpr std::size_t packed_key_capacity = 0;
+#endif
+
+/// @brief The packed key hashes of a Kwargs, which take no space when disabled.
+template<std::size_t _Capacity>
+struct kwargs_packed_keys
+{
+    // Written by the constructor for its first size() elements only.
+    string_hash_type _M_keys[_Capacity];
+};
+
+template<>
+struct kwargs_packed_keys<0>
+{ };
+
+/// @brief Two bits of the 64-bit signature of a Kwargs, which rejects most absent keys at once.
+[[nodiscard]] constexpr std::uint64_t key_signature_bits(string_hash_type __hash) noexcept
+{
+    const std::uint64_t mixed = __hash * 0x9E37'79B9'7F4A'7C15ULL;
+    return (std::uint64_t(1) << (mixed >> 58)) | (std::uint64_t(1) << ((mixed >> 52) & 63));
+}
+
+/// @brief The slot of a key in the index of a Kwargs.
+[[nodiscard]] constexpr std::size_t key_index_slot(string_hash_type __hash, std::size_t __mask) noexcept
+{
+    return static_cast<std::size_t>((__hash * 0x9E37'79B9'7F4A'7C15ULL) >> 32) & __mask;
+}
+
+/// @brief The number of slots of the index of a Kwargs with __size pairs, at most half full.
+[[nodiscard]] constexpr std::size_t key_index_capacity(std::size_t __size) noexcept
+{
+    std::size_t capacity = 2;
+
+    for (; capacity < __size * 2; capacity *= 2);
+
+    return capacity;
+}
+
+_KWARGS_Test_(key_index_capacity(1), 2ULL);
+_KWARGS_Test_(key_index_capacity(33), 128ULL);
+
+/**
+ * @brief Kwargs without a slot table index lists longer than this, set by KWARGS_KEY_INDEX_THRESHOLD.
+ *        The index is allocated on the first lookup; shorter lists never allocate. There is no index
+ *        by default, which keeps every Kwargs trivially copyable.
+ */
+#if defined(KWARGS_KEY_INDEX_THRESHOLD)
+inline constexpr std::size_t key_index_threshold = KWARGS_KEY_INDEX_THRESHOLD;
+#else
+inline constexpr std::size_t key_index_threshold = 0;
+#endif
+
+/**
+ * @brief Whether Kwargs check their keys for unknown and duplicate ones, which is always done in
+ *        debug builds and also in release builds when KWARGS_VALIDATE_KEYS is defined.
+ */
+#if defined(KWARGS_VALIDATE_KEYS) || !defined(NDEBUG)
+inline constexpr bool validate_keys = true;
+#else
+inline constexpr bool validate_keys = false;
+#endif
+
+/// @brief Duplicate keys among at most this many pairs are found with a set on the stack (2 KiB);
+///        longer lists use a set on the heap that is freed when validation ends.
+inline constexpr std::size_t key_validation_stack_size = 256;
+
+/// @brief The signature of the keys of a Kwargs, which Kwargs with a slot table do not need.
+template<bool _Enabled>
+struct kwargs_key_signature
+{
+    std::uint64_t _M_signature = 0;
+
+    // Whether a key may be passed twice: set when its bits were already in the signature,
+    // and made exact when the keys are validated or indexed.
+    bool _M_repeats = false;
+};
+
+template<>
+struct kwargs_key_signature<false>
+{ };
+
+/**
+ * @brief The lazily built index of a Kwargs without a slot table, which maps slots to positions
+ *        in the list plus one (0 is empty); only present when KWARGS_KEY_INDEX_THRESHOLD is set.
+ */
+template<bool _Enabled>
+struct kwargs_key_index
+{
+    constexpr kwargs_key_index() noexcept = default;
+
+    // A copy builds an index of its own when it needs one.
+    constexpr kwargs_key_index(const kwargs_key_index&) noexcept
+    { }
+
+    constexpr kwargs_key_index(kwargs_key_index&& __other) noexcept
+        : _M_index(__other._M_index)
+    { __other._M_index = nullptr; }
+
+    constexpr kwargs_key_index& operator=(const kwargs_key_index& __other) noexcept
+    {
+        if (this != &__other)
+        {
+            delete[] _M_index;
+            _M_index = nullptr;
+        }
+
+        return *this;
+    }
+
+    constexpr kwargs_key_index& operator=(kwargs_key_index&& __other) noexcept
+    {
+        if (this != &__other)
+        {
+            delete[] _M_index;
+
+            _M_index = __other._M_index;
+            __other._M_index = nullptr;
+        }
+
+        return *this;
+    }
+
+    _KWARGS_DESTRUCTOR_CONSTEXPR ~kwargs_key_index() noexcept
+    { delete[] _M_index; }
+
+    std::uint32_t* _M_index = nullptr;
+};
+
+template<>
+struct kwargs_key_index<false>
+{ };
+
+/// @brief Selects the constructor of a view of Kwargs.
+struct kwargs_view_tag
+{ };
+
+/**
+ * @return The index of the first __key in __keys[0, __size), or __size.
+ * @note Blocks of 16 (AVX2) or 8 (SSE2) keys are compared at once and skipped
+ *       unless one of them may match, which the scalar loop then confirms.
+ */
+[[nodiscard]] inline std::size_t find_packed_key(const string_hash_type* __keys, std::size_t __size, string_hash_type __key) noexcept
+{
+    std::size_t i = 0;
+
+#if defined(_KWARGS_HAS_AVX2)
+    const __m256i needle = _mm256_set1_epi64x(static_cast<long long>(__key));
+
+    for (; i + 16 <= __size; i += 16)
+    {
+        const __m256i* block = reinterpret_cast<const __m256i*>(__keys + i);
+
+        const __m256i equal = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi64(_mm256_loadu_si256(block + 0), needle), _mm256_cmpeq_epi64(_mm256_loadu_si256(block + 1), needle)),
+            _mm256_or_si256(_mm256_cmpeq_epi64(_mm256_loadu_si256(block + 2), needle), _mm256_cmpeq_epi64(_mm256_loadu_si256(block + 3), needle)));
+
+        if (_mm256_testz_si256(equal, equal) == 0)
+        {
+            break;
+        }
+    }
+#elif defined(_KWARGS_HAS_SSE2)
+    const __m128i needle = _mm_set1_epi64x(static_cast<long long>(__key));
+
+    for (; i + 8 <= __size; i += 8)
+    {
+        const __m128i* block = reinterpret_cast<const __m128i*>(__keys + i);
+
+        // A 32-bit half may match on its own; such a block is only a candidate.
+        const __m128i equal = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi32(_mm_loadu_si128(block + 0), needle), _mm_cmpeq_epi32(_mm_loadu_si128(block + 1), needle)),
+            _mm_or_si128(_mm_cmpeq_epi32(_mm_loadu_si128(block + 2), needle), _mm_cmpeq_epi32(_mm_loadu_si128(block + 3), needle)));
+
+        if (_mm_movemask_epi8(equal) != 0)
+        {
+            break;
+        }
+    }
+#endif
+
+    for (; i < __size; ++i)
+    {
+        if (__keys[i] == __key)
+        {
+            return i;
+        }
+    }
+
+    return __size;
+}
+
+#undef _KWARGS_Test_
+
+}  // namespace detail
+
+
+#undef _KWARGS_INT128
+#undef _KWARGS_UINT128
+
+#undef _KWARGS_HAS_INT128
+#undef _KWARGS_HAS_UINT128
+
+#undef _KWARGS_HAS_FLOAT128
+
+#undef _KWARGS_IS_CONSTANT_EVALUATED
+#undef _KWARGS_LITTLE_ENDIAN
+#undef _KWARGS_HAS_SSSE3
+#undef _KWARGS_HAS_SSE2
+#undef _KWARGS_HAS_AVX2
+
+
+/**
+ * @brief The result of kwargs::parse, in the manner of std::from_chars_result.
+ * 
+ * @c ec is @c std::errc{} on success, @c std::errc::invalid_argument if no number was found
+ * (then @c value is @c _Tp{} and @c ptr is the beginning of the input), or
+ * @c std::errc::result_out_of_range if the number does not fit into @c _Tp
+ * (then @c value is clamped and @c ptr is past the whole number).
+ */
+template<typename _Tp>
+struct ParseResult
+{
+    _Tp value;
+
+    const char* ptr;
+
+    std::errc ec;
+
+    [[nodiscard]] constexpr explicit operator bool() const noexcept
+    { return ec == std::errc{}; }
+};
+
+
+/**
+ * @brief Parses a number from the beginning of [__first, __last) without wrapping on overflow.
+ * 
+ * Leading spaces are skipped. Parsing stops at the first character that cannot continue
+ * the number, which is returned in ParseResult::ptr, so that the caller can resume from there.
+ */
+template<typename _Tp>
+[[nodiscard]] constexpr auto parse(const char* __first, const char* __last) noexcept
+        -> std::enable_if_t<std::disjunction_v<detail::is_integral_or_enum<_Tp>, std::is_floating_point<_Tp>>, ParseResult<_Tp>>
+{
+    ParseResult<_Tp> result{ _Tp{}, nullptr, std::errc{} };
+
+    if constexpr (std::is_floating_point_v<_Tp>)
+    {
+        result.ptr = detail::parse_floating_point(__first, __last, result.value, result.ec);
+    }
+    else
+    {
+        result.ptr = detail::parse_integer(__first, __last, result.value, result.ec);
+    }
+
+    return result;
+}
+
+template<typename _Tp>
+[[nodiscard]] constexpr auto parse(std::string_view __str) noexcept
+        -> decltype(parse<_Tp>(__str.data(), __str.data() + __str.size()))
+{ return parse<_Tp>(__str.data(), __str.data() + __str.size()); }
+
+
+namespace fmt
+{
+
+/**
+ * @brief Selects how KwargsValue::value<std::string>() writes a floating-point value.
+ * 
+ * @code
+ * kwargs["ratio"]->value<std::string>(kwargs::fmt::fixed(3));       // "0.333"
+ * kwargs["ratio"]->value<std::string>(kwargs::fmt::scientific(2));  // "3.33e-01"
+ * @endcode
+ */
+struct FloatFormat
+{
+    enum Style : std::uint8_t
+    {
+        Shortest,
+        Fixed,
+        Scientific
+    };
+
+    Style style;
+
+    int precision;
+};
+
+/// The default conversion; the precision macros still apply.
+[[nodiscard]] constexpr FloatFormat shortest() noexcept
+{ return { FloatFormat::Shortest, 0 }; }
+
+/// @c __precision digits after the point, like printf("%.*f").
+[[nodiscard]] constexpr FloatFormat fixed(int __precision) noexcept
+{ return { FloatFormat::Fixed, __precision }; }
+
+/// One digit, the point, @c __precision digits and the exponent, like printf("%.*e").
+[[nodiscard]] constexpr FloatFormat scientific(int __precision) noexcept
+{ return { FloatFormat::Scientific, __precision }; }
+
+}  // namespace fmt
+
+
+namespace unit
+{
+
+/**
+ * @brief A unit suffix, worth @c num / @c den of the base unit.
+ */
+struct Suffix
+{
+    std::string_view name;
+
+    std::intmax_t num = 1;
+    std::intmax_t den = 1;
+};
+
+/**
+ * @brief A set of unit suffixes for KwargsValue::value<_Tp>(__table), e.g. value<std::size_t>(kwargs::unit::bytes).
+ * 
+ * The suffixes are grouped by their first character when the table is built, so that a lookup
+ * only compares those that start like the input. Names must start with an ASCII character,
+ * and are compared case-sensitively ("m" and "M" differ).
+ * 
+ * @code
+ * constexpr kwargs::unit::SuffixTable length({ { "mm", 1, 1000 }, { "cm", 1, 100 }, { "m", 1 }, { "km", 1000 } });
+ * @endcode
+ */
+template<std::size_t _Size>
+class SuffixTable
+{
+public:
+
+    static_assert(_Size < 0xFF, "cpp-kwargs: too many suffixes");
+
+    using suffix_type = Suffix;
+
+    constexpr SuffixTable(const Suffix (&__suffixes)[_Size]) noexcept
+    {
+        for (std::size_t c = 1; c < std::size(_M_first); ++c)
+        {
+            for (const Suffix& suffix : __suffixes)
+            {
+                if (suffix.name.empty() == false && static_cast<unsigned char>(suffix.name.front()) == c)
+                {
+                    if (_M_first[c] == 0)
+                    {
+                        _M_first[c] = static_cast<std::uint8_t>(_M_size + 1);
+                    }
+
+                    _M_suffixes[_M_size++] = suffix;
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] constexpr const Suffix* find(std::string_view __name) const noexcept
+    {
+        if (__name.empty() || static_cast<unsigned char>(__name.front()) >= std::size(_M_first))
+        {
+            return nullptr;
+        }
+
+        for (std::size_t i = _M_first[static_cast<unsigned char>(__name.front())]; i != 0 && i <= _M_size && _M_suffixes[i - 1].name.front() == __name.front(); ++i)
+        {
+            if (_M_suffixes[i - 1].name == __name)
+            {
+                return &_M_suffixes[i - 1];
+            }
+        }
+
+        return nullptr;
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    { return _M_size; }
+
+private:
+
+    Suffix _M_suffixes[_Size] { };
+    std::size_t _M_size = 0;
+
+    // 1 + the index of the first suffix that starts with each ASCII character, or 0.
+    std::uint8_t _M_first[128] { };
+};
+
+/// B; k (or K), M, G, T, P, E with an optional B as powers of 1000; Ki, Mi, Gi, Ti, Pi, Ei with an optional B as powers of 1024.
+inline constexpr SuffixTable bytes({
+    { "B", 1 },
+    { "k",  1'000 },                     { "K",  1'000 },   { "kB", 1'000 }, { "KB", 1'000 },
+    { "M",  1'000'000 },                 { "MB", 1'000'000 },
+    { "G",  1'000'000'000 },             { "GB", 1'000'000'000 },
+    { "T",  1'000'000'000'000 },         { "TB", 1'000'000'000'000 },
+    { "P",  1'000'000'000'000'000 },     { "PB", 1'000'000'000'000'000 },
+    { "E",  1'000'000'000'000'000'000 }, { "EB", 1'000'000'000'000'000'000 },
+    { "Ki", std::intmax_t(1) << 10 }, { "KiB", std::intmax_t(1) << 10 },
+    { "Mi", std::intmax_t(1) << 20 }, { "MiB", std::intmax_t(1) << 20 },
+    { "Gi", std::intmax_t(1) << 30 }, { "GiB", std::intmax_t(1) << 30 },
+    { "Ti", std::intmax_t(1) << 40 }, { "TiB", std::intmax_t(1) << 40 },
+    { "Pi", std::intmax_t(1) << 50 }, { "PiB", std::intmax_t(1) << 50 },
+    { "Ei", std::intmax_t(1) << 60 }, { "EiB", std::intmax_t(1) << 60 }
+});
+
+/// The SI prefixes from p to E; "1.5k" is 1500.
+inline constexpr SuffixTable si({
+    { "p", 1, 1'000'000'000'000 }, { "n", 1, 1'000'000'000 }, { "u", 1, 1'000'000 }, { "m", 1, 1'000 },
+    { "k", 1'000 }, { "M", 1'000'000 }, { "G", 1'000'000'000 }, { "T", 1'000'000'000'000 },
+    { "P", 1'000'000'000'000'000 }, { "E", 1'000'000'000'000'000'000 }
+});
+
+/// ns, us, ms, s, min, h and d, in seconds; the default for KwargsValue::value<std::chrono::duration>().
+inline constexpr SuffixTable durations({
+    { "ns", 1, 1'000'000'000 }, { "us", 1, 1'000'000 }, { "ms", 1, 1'000 },
+    { "s", 1 }, { "min", 60 }, { "h", 3'600 }, { "d", 86'400 }
+});
+
+}  // namespace unit
+
+
+class Type
+{
+private:
+
+    enum class NextTypeFlag : std::int32_t
+    {
+        Underlying,
+        PromoteNumeric,
+        ValueType,
+        DereferencedIterator,
+        Dereference,
+        ReturnValue,
+        Iterator,
+        PairFirstType,
+        PairSecondType
+    };
+
+    template<typename _Tp>
+    static constexpr Type _S_nextType(NextTypeFlag __flag) noexcept
+    {
+        switch (__flag)
+        {
+            case NextTypeFlag::Underlying:
+            {
+                return Type().construct<detail::enum_underlying_type_t<_Tp>>();
+            }
+
+            case NextTypeFlag::PromoteNumeric:
+            {
+                return Type().construct<detail::promote_numeric_t<_Tp>>();
+            }
+
+            case NextTypeFlag::ValueType:
+            {
+                return Type().construct<detail::container_value_type_t<_Tp>>();
+            }
+
+            case NextTypeFlag::DereferencedIterator:
+            {
+                return Type().construct<detail::dereferenced_iterator_t<_Tp>>();
+            }
+
+            case NextTypeFlag::Dereference:
+            {
+                return Type().construct<detail::dereference_t<_Tp>>();
+            }
+
+            case NextTypeFlag::ReturnValue:
+            {
+                return Type().construct<detail::return_type_of_t<_Tp>>();
+            }
+
+            case NextTypeFlag::Iterator:
+            {
+                return Type().construct<detail::container_iterator_t<_Tp>>();
+            }
+
+            case NextTypeFlag::PairFirstType:
+            {
+                if constexpr (detail::is_tuple_like_v<_Tp>)
+                {
+                    if constexpr (std::tuple_size_v<std::remove_reference_t<_Tp>> >= 1)
+                    {
+                        return Type().construct<detail::first_of_tuple_t<_Tp>>();
+                    }
+                    else
+                    {
+                        return Type().construct<_Tp>();
+                    }
+                }
+                else
+                {
+                    return Type().construct<_Tp>();
+                }
+            }
+
+            case NextTypeFlag::PairSecondType:
+            {
+                if constexpr (detail::is_tuple_like_v<_Tp>)
+                {
+                    if constexpr (std::tuple_size_v<std::remove_reference_t<_Tp>> >= 2)
+                    {
+                        return Type().construct<detail::second_of_tuple_t<_Tp>>();
+                    }
+                    else
+                    {
+                        return Type().construct<_Tp>();
+                    }
+                }
+                else
+                {
+                    return Type().construct<_Tp>();
+                }
+            }
+
+            default:
+            {
+                return Type().construct<_Tp>();
+            }
+        }
+    }
+
+public:
+
+    using size_type = detail::return_type_of_t<decltype(&std::type_info::hash_code)>;
+
+    static_assert(sizeof(size_type) == sizeof(void*));
+
+    /**
+     * @brief Initializes all member variables to default values.
+     */
+    constexpr Type() noexcept
+        : _M_hash(0), _M_size(0), _M_next(nullptr)
+        , _M_rank(0)
+        , _M_is_lvalue_ref(0)
+        , _M_is_rvalue_ref(0)
+        , _M_is_const(0)
+        , _M_is_volatile(0)
+        , _M_is_signed(0)
+        , _M_is_unsigned(0)
+        , _M_is_integral(0)
+        , _M_is_floating_point(0)
+        , _M_is_char(0)
+        , _M_is_enum(0)
+        , _M_is_class(0)
+        , _M_is_union(0)
+        , _M_is_pointer(0)
+        , _M_is_null_pointer(0)
+        , _M_is_char_pointer(0)
+        , _M_is_function(0)
+        , _M_is_member_function(0)
+        , _M_is_member_object(0)
+        , _M_is_array(0)
+        , _M_is_bounded_array(0)
+        , _M_is_std_array(0)
+        , _M_is_std_vector(0)
+        , _M_is_std_string(0)
+        , _M_is_std_string_view(0)
+        , _M_is_std_pair(0)
+        , _M_is_pair_like(0)
+        , _M_is_std_tuple(0)
+        , _M_is_tuple_like(0)
+        , _M_is_iterable(0)
+        , _M_is_insertable(0)
+        , _M_has_value_type(0)
+        , _M_has_data(0)
+    { }
+
+    /**
+     * @brief  Constructs the Type object based on the provided type.
+     * 
+     * @tparam _Tp The type to construct the Type object for.
+     * 
+     * @return Reference to the constructed Type object (*this).
+     */
+    template<typename _Tp>
+    constexpr Type& construct() noexcept
+    {
+        using type = detail::remove_cv_pair_t<detail::remove_reference_cv_t<_Tp>>;
+
+        _M_hash = typeid(type).hash_code();
+        _M_size = detail::size_of_v<type>;
+        _M_next = &Type::_S_nextType<type>;
+        _M_name = detail::type_name<_Tp>();
+
+        _M_rank               = detail::rank_v<type>;
+
+        _M_is_lvalue_ref      = std::is_lvalue_reference_v<_Tp>;
+        _M_is_rvalue_ref      = std::is_rvalue_reference_v<_Tp>;
+
+        _M_is_const           = std::is_const_v<std::remove_reference_t<_Tp>>;
+        _M_is_volatile        = std::is_volatile_v<std::remove_reference_t<_Tp>>;
+        
+        _M_is_signed          = detail::is_signed_v<type>;
+        _M_is_unsigned        = detail::is_unsigned_v<type>;
+        _M_is_integral        = std::is_integral_v<type>;
+        _M_is_floating_point  = std::is_floating_point_v<type>;
+        _M_is_char            = detail::is_char_v<type>;
+        _M_is_enum            = std::is_enum_v<type>;
+        
+        _M_is_class           = std::is_class_v<type>;
+        _M_is_union           = std::is_union_v<type>;
+        _M_is_pointer         = detail::is_pointer_v<type>;
+        _M_is_null_pointer    = std::is_null_pointer_v<type>;
+        _M_is_char_pointer    = detail::is_char_pointer_v<type>;
+        _M_is_function        = std::is_function_v<type>;
+        _M_is_member_function = std::is_member_function_pointer_v<type>;
+        _M_is_member_object   = std::is_member_object_pointer_v<type>;
+
+        _M_is_array           = std::is_array_v<type>;
+        _M_is_bounded_array   = detail::is_bounded_array_v<type>;
+        _M_is_std_array       = detail::is_std_array_v<type>;
+        _M_is_std_vector      = detail::is_std_vector_v<type>;
+        _M_is_std_string      = detail::is_std_string_v<type>;
+        _M_is_std_string_view = detail::is_std_string_view_v<type>;
+        _M_is_std_pair        = detail::is_std_pair_v<type>;
+        _M_is_pair_like       = detail::is_pair_like_v<type>;
+        _M_is_std_tuple       = detail::is_std_tuple_v<type>;
+        _M_is_tuple_like      = detail::is_tuple_like_v<type>;
+
+        _M_is_iterable        = detail::is_iterable_v<type>;
+        _M_is_insertable      = detail::is_insertable_container_v<type>;
+        _M_has_value_type     = detail::has_container_value_type_v<type>;
+        _M_has_data           = detail::has_container_data_v<type>;
+
+        return *this;
+    }
+
+    /**
+     * @brief  Checks whether the current Type matches the provided type.
+     * 
+     * @tparam _Tp The type to compare against.
+     * 
+     * @return True if the types match, false otherwise.
+     */
+    template<typename _Tp>
+    [[nodiscard]] constexpr bool isSameAs() const noexcept
+    { return _M_hash == typeid(detail::remove_cv_pair_t<detail::remove_reference_cv_t<_Tp>>).hash_code(); }
+
+    /**
+     * @brief  Checks whether the current Type matches any of the provided types.
+     * 
+     * @tparam _Args The types to compare against.
+     * 
+     * @return True if the Type matches any of the provided types, false otherwise.
+     */
+    template<typename... _Args>
+    [[nodiscard]] constexpr bool isAnyOf() const noexcept
+    {
+        if constexpr (sizeof...(_Args) == 0)
+        {
+            return false;
+        }
+        else
+        {
+            return (... || isSameAs<_Args>());
+        }
+    }
+
+
+    [[nodiscard]] constexpr bool operator==(const Type& __other) const noexcept
+    { return _M_hash == __other._M_hash; }
+
+    [[nodiscard]] constexpr bool operator!=(const Type& __other) const noexcept
+    { return _M_hash != __other._M_hash; }
+
+    [[nodiscard]] constexpr bool operator<(const Type& __other) const noexcept
+    { return _M_size < __other._M_size; }
+
+    [[nodiscard]] constexpr bool operator<=(const Type& __other) const noexcept
+    { return _M_size <= __other._M_size; }
+
+    [[nodiscard]] constexpr bool operator>(const Type& __other) const noexcept
+    { return _M_size > __other._M_size; }
+
+    [[nodiscard]] constexpr bool operator>=(const Type& __other) const noexcept
+    { return _M_size >= __other._M_size; }
+
+    /**
+     * @brief  Converts the Type object to its hash code.
+     * 
+     * @return The hash code of the Type.
+     */
+    [[nodiscard]] constexpr operator size_type() const noexcept
+    { return _M_hash; }
+
+    /**
+     * @brief  Checks whether the Type object has been constructed.
+     * 
+     * @return True if the Type object is constructed, false otherwise.
+     */
+    [[nodiscard]] constexpr operator bool() const noexcept
+    { return !_M_name.empty(); }
+
+    /**
+     * @brief  Retrieves the hash code of the Type.
+     * 
+     * @return The hash code of the Type.
+     */
+    [[nodiscard]] constexpr size_type hashCode() const noexcept
+    { return _M_hash; }
+
+     /**
+     * @brief  Retrieves the size of the Type.
+     * 
+     * @return The size of the Type in bytes.
+     */
+    [[nodiscard]] constexpr size_type size() const noexcept
+    { return _M_size; }
+
+    /**
+     * @brief  Retrieves the rank of the Type.
+     * 
+     * @return The rank of the Type.
+     */
+    [[nodiscard]] constexpr size_type rank() const noexcept
+    { return _M_rank; }
+
+
+    [[nodiscard]] constexpr bool isReference() const noexcept
+    { return _M_is_lvalue_ref || _M_is_rvalue_ref; }
+
+    [[nodiscard]] constexpr bool isLeftValueReference() const noexcept
+    { return _M_is_lvalue_ref; }
+
+    [[nodiscard]] constexpr bool isRightValueReference() const noexcept
+    { return _M_is_rvalue_ref; }
+
+
+    [[nodiscard]] constexpr bool isConst() const noexcept
+    { return _M_is_const; }
+
+    [[nodiscard]] constexpr bool isVolatile() const noexcept
+    { return _M_is_volatile; }
+
+    [[nodiscard]] constexpr bool isSigned() const noexcept
+    { return _M_is_signed; }
+
+    [[nodiscard]] constexpr bool isUnsigned() const noexcept
+    { return _M_is_unsigned; }
+
+    [[nodiscard]] constexpr bool isIntegral() const noexcept
+    { return _M_is_integral; }
+
+    [[nodiscard]] constexpr bool isIntegralOrEnum() const noexcept
+    { return _M_is_integral || _M_is_enum; }
+
+    [[nodiscard]] constexpr bool isFloatingPoint() const noexcept
+    { return _M_is_floating_point; }
+
+    [[nodiscard]] constexpr bool isCharacter() const noexcept
+    { return _M_is_char; }
+
+    [[nodiscard]] constexpr bool isEnum() const noexcept
+    { return _M_is_enum; }
+
+    [[nodiscard]] constexpr bool isClass() const noexcept
+    { return _M_is_class; }
+
+    [[nodiscard]] constexpr bool isStruct() const noexcept
+    { return _M_is_class; }
+
+    [[nodiscard]] constexpr bool isUnion() const noexcept
+    { return _M_is_union; }
+
+    [[nodiscard]] constexpr bool isPointer() const noexcept
+    { return _M_is_pointer; }
+
+    [[nodiscard]] constexpr bool isNullPointer() const noexcept
+    { return _M_is_null_pointer; }
+
+    [[nodiscard]] constexpr bool isCharacterPointer() const noexcept
+    { return _M_is_char_pointer; }
+
+    [[nodiscard]] constexpr bool isFunction() const noexcept
+    { return _M_is_function; }
+
+    [[nodiscard]] constexpr bool isMemberFunctionPointer() const noexcept
+    { return _M_is_member_function; }
+
+    [[nodiscard]] constexpr bool isMemberObjectPointer() const noexcept
+    { return _M_is_member_object; }
+
+    [[nodiscard]] constexpr bool isArray() const noexcept
+    { return _M_is_array; }
+
+    [[nodiscard]] constexpr bool isBoundedArray() const noexcept
+    { return _M_is_bounded_array; }
+
+    [[nodiscard]] constexpr bool isUnboundedArray() const noexcept
+    { return _M_is_array && !_M_is_bounded_array; }
+
+    [[nodiscard]] constexpr bool isStdArray() const noexcept
+    { return _M_is_std_array; }
+
+    [[nodiscard]] constexpr bool isStdVector() const noexcept
+    { return _M_is_std_vector; }
+
+    [[nodiscard]] constexpr bool isStdString() const noexcept
+    { return _M_is_std_string; }
+
+    [[nodiscard]] constexpr bool isStdStringView() const noexcept
+    { return _M_is_std_string_view; }
+
+    [[nodiscard]] constexpr bool isStdPair() const noexcept
+    { return _M_is_std_pair; }
+
+    [[nodiscard]] constexpr bool isPairLike() const noexcept
+    { return _M_is_pair_like; }
+
+    [[nodiscard]] constexpr bool isStdTuple() const noexcept
+    { return _M_is_std_tuple; }
+
+    [[nodiscard]] constexpr bool isTupleLike() const noexcept
+    { return _M_is_tuple_like; }
+
+    [[nodiscard]] constexpr bool isIterable() const noexcept
+    { return _M_is_iterable; }
+
+    [[nodiscard]] constexpr bool isInsertable() const noexcept
+    { return _M_is_insertable; }
+
+    /**
+     * @brief  Checks whether the Type has a value_type.
+     * 
+     * @return True if the Type has a value_type, false otherwise.
+     */
+    [[nodiscard]] constexpr bool hasValueType() const noexcept
+    { return _M_has_value_type; }
+
+    /**
+     * @brief  Checks whether the Type has a data member.
+     * 
+     * @return True if the Type has a data member, false otherwise.
+     */
+    [[nodiscard]] constexpr bool hasData() const noexcept
+    { return _M_has_data; }
+
+
+    [[nodiscard]] constexpr Type underlyingType() const noexcept
+    { return _M_next(NextTypeFlag::Underlying); }
+
+    [[nodiscard]] constexpr Type promoteNumericType() const noexcept
+    { return _M_next(NextTypeFlag::PromoteNumeric); }
+
+    [[nodiscard]] constexpr Type valueType() const noexcept
+    { return _M_next(NextTypeFlag::ValueType); }
+
+    [[nodiscard]] constexpr Type dereferencedIteratorType() const noexcept
+    { return _M_next(NextTypeFlag::DereferencedIterator); }
+
+    [[nodiscard]] constexpr Type dereferenceType() const noexcept
+    { return _M_next(NextTypeFlag::Dereference); }
+
+    [[nodiscard]] constexpr Type returnValueType() const noexcept
+    { return _M_next(NextTypeFlag::ReturnValue); }
+
+    [[nodiscard]] constexpr Type iteratorType() const noexcept
+    { return _M_next(NextTypeFlag::Iterator); }
+
+    /**
+     * @brief  Retrieves the first type of the Type if it is tuple-like.
+     * 
+     * @return The first Type.
+     */
+    [[nodiscard]] constexpr Type firstType() const noexcept
+    { return _M_next(NextTypeFlag::PairFirstType); }
+
+    /**
+     * @brief  Retrieves the second type of the Type if it is tuple-like.
+     * 
+     * @return The second Type.
+     */
+    [[nodiscard]] constexpr Type secondType() const noexcept
+    { return _M_next(NextTypeFlag::PairSecondType); }
+
+private:
+
+    size_type _M_hash;
+    size_type _M_size;
+
+    Type (*_M_next)(NextTypeFlag);
+    std::string_view _M_name;
+
+    size_type _M_rank               : 4;
+
+    size_type _M_is_lvalue_ref      : 1;
+    size_type _M_is_rvalue_ref      : 1;
+
+    size_type _M_is_const           : 1;
+    size_type _M_is_volatile        : 1;
+
+    size_type _M_is_signed          : 1;
+    size_type _M_is_unsigned        : 1;
+    size_type _M_is_integral        : 1;
+    size_type _M_is_floating_point  : 1;
+    size_type _M_is_char            : 1;
+    size_type _M_is_enum            : 1;
+
+    size_type _M_is_class           : 1;
+    size_type _M_is_union           : 1;
+    size_type _M_is_pointer         : 1;
+    size_type _M_is_null_pointer    : 1;
+    size_type _M_is_char_pointer    : 1;
+    size_type _M_is_function        : 1;
+    size_type _M_is_member_function : 1;
+    size_type _M_is_member_object   : 1;
+
+    size_type _M_is_array           : 1;
+    size_type _M_is_bounded_array   : 1;
+    size_type _M_is_std_array       : 1;
+    size_type _M_is_std_vector      : 1;
+    size_type _M_is_std_string      : 1;
+    size_type _M_is_std_string_view : 1;
+    size_type _M_is_std_pair        : 1;
+    size_type _M_is_pair_like       : 1;
+    size_type _M_is_std_tuple       : 1;
+    size_type _M_is_tuple_like      : 1;
+
+    size_type _M_is_iterable        : 1;
+    size_type _M_is_insertable      : 1;
+    size_type _M_has_value_type     : 1;
+    size_type _M_has_data           : 1;
+};
+
+
+class KwargsKey
+{
+public:
+
+    using value_type = detail::string_hash_type;
+    using ValueType  = value_type;
+
+    constexpr KwargsKey() = default;
+
+    template<std::size_t _Size>
+    _KWARGS_ATTRIBUTE_ALWAYS_INLINE constexpr KwargsKey(const char (&__str)[_Size]) noexcept
+        : _M_key(detail::string_hash_array(__str))
+    { }
+
+    /// @note It does not need to contains '\0' at the end.
+    constexpr KwargsKey(const char* const __str, std::size_t __size) noexcept
+        : _M_key(detail::string_hash_string(__str, __size))
+    { }
+
+    constexpr explicit KwargsKey(value_type __option) noexcept
+        : _M_key(__option)
+    { }
+
+    constexpr KwargsKey(const class KwargsKeyLiteral& __literal) noexcept;
+
+    [[nodiscard]] constexpr value_type value() const noexcept
+    { return _M_key; }
+
+    [[nodiscard]] constexpr operator value_type() const noexcept
+    { return _M_key; }
+
+    [[nodiscard]] constexpr bool operator==(KwargsKey __other) const noexcept
+    { return _M_key == __other._M_key; }
+
+    [[nodiscard]] constexpr bool operator!=(KwargsKey __other) const noexcept
+    { return _M_key != __other._M_key; }
+
+    [[nodiscard]] constexpr bool operator<(KwargsKey __other) const noexcept
+    { return _M_key < __other._M_key; }
+
+    [[nodiscard]] constexpr bool operator>(KwargsKey __other) const noexcept
+    { return _M_key > __other._M_key; }
+
+    [[nodiscard]] constexpr bool operator<=(KwargsKey __other) const noexcept
+    { return _M_key <= __other._M_key; }
+
+    [[nodiscard]] constexpr bool operator>=(KwargsKey __other) const noexcept
+    { return _M_key >= __other._M_key; }
+
+
+    /// @brief Multiple KwargsKeys can be joined using the `or` operator.
+    [[nodiscard]] friend constexpr std::array<KwargsKey, 2>
+        operator||(KwargsKey __first, KwargsKey __second) noexcept
+    { return {{__first, __second}}; }
+
+    template<std::size_t _StringSize>
+    [[nodiscard]] friend constexpr std::array<KwargsKey, 2>
+        operator||(KwargsKey __first, const char (&__second)[_StringSize]) noexcept
+    { return {{__first, KwargsKey(__second)}}; }
+
+    template<std::size_t _Size>
+    [[nodiscard]] friend constexpr std::array<KwargsKey, _Size + 1>
+        operator||(const std::array<KwargsKey, _Size>& __first, KwargsKey __second) noexcept
+    {
+        std::array<KwargsKey, _Size + 1> res;
+        detail::copy(__first.begin(), __first.end(), res.begin());
+        res.back() = __second;
+        return res;
+    }
+
+    template<std::size_t _Size, std::size_t _StringSize>
+    [[nodiscard]] friend constexpr std::array<KwargsKey, _Size + 1>
+        operator||(const std::array<KwargsKey, _Size>& __first, const char (&__second)[_StringSize]) noexcept
+    {
+        std::array<KwargsKey, _Size + 1> res;
+        detail::copy(__first.begin(), __first.end(), res.begin());
+        res.back() = KwargsKey(__second);
+        return res;
+    }
+
+private:
+
+    value_type _M_key = 0;
+};
+
+
+/**
+ * @brief A 32-bit KwargsKey, for tables of keys that should take half the memory.
+ * 
+ * Kwargs<_OptionalList...> statically asserts that the 32-bit keys of its list are distinct,
+ * so a KwargsKey32 identifies one of them as surely as a KwargsKey.
+ */
+class KwargsKey32
+{
+public:
+
+    using value_type = std::uint32_t;
+    using ValueType  = value_type;
+
+    // Explicit, so that names and literals keep choosing KwargsKey in overloads.
+
+    constexpr KwargsKey32() = default;
+
+    template<std::size_t _Size>
+    constexpr explicit KwargsKey32(const char (&__str)[_Size]) noexcept
+        : KwargsKey32(KwargsKey(__str))
+    { }
+
+    /// @note It does not need to contains '\0' at the end.
+    constexpr explicit KwargsKey32(const char* const __str, std::size_t __size) noexcept
+        : KwargsKey32(KwargsKey(__str, __size))
+    { }
+
+    constexpr explicit KwargsKey32(KwargsKey __key) noexcept
+        : _M_key(detail::string_hash_fold32(__key.value()))
+    { }
+
+    constexpr explicit KwargsKey32(value_type __option) noexcept
+        : _M_key(__option)
+    { }
+
+    constexpr explicit KwargsKey32(const class KwargsKeyLiteral& __literal) noexcept;
+
+    [[nodiscard]] constexpr value_type value() const noexcept
+    { return _M_key; }
+
+    [[nodiscard]] constexpr operator value_type() const noexcept
+    { return _M_key; }
+
+    [[nodiscard]] constexpr bool operator==(KwargsKey32 __other) const noexcept
+    { return _M_key == __other._M_key; }
+
+    [[nodiscard]] constexpr bool operator!=(KwargsKey32 __other) const noexcept
+    { return _M_key != __other._M_key; }
+
+    [[nodiscard]] constexpr bool operator<(KwargsKey32 __other) const noexcept
+    { return _M_key < __other._M_key; }
+
+    [[nodiscard]] constexpr bool operator>(KwargsKey32 __other) const noexcept
+    { return _M_key > __other._M_key; }
+
+    [[nodiscard]] constexpr bool operator<=(KwargsKey32 __other) const noexcept
+    { return _M_key <= __other._M_key; }
+
+    [[nodiscard]] constexpr bool operator>=(KwargsKey32 __other) const noexcept
+    { return _M_key >= __other._M_key; }
+
+private:
+
+    value_type _M_key = 0;
+};
+
+
+/**
+ * @brief A thread-safe, append-only pool of runtime key names.
+ * 
+ * Interning a name hashes it once and keeps its text for diagnostics. Lookups never lock: the
+ * slots are atomic and a grown index keeps the previous ones alive, so readers may run
+ * concurrently with intern(), which serializes writers with a mutex.
+ */
+class KeyTable
+{
+public:
+
+    KeyTable() = default;
+
+    KeyTable(const KeyTable&) = delete;
+    KeyTable& operator=(const KeyTable&) = delete;
+
+    ~KeyTable()
+    { delete _M_index.load(std::memory_order_relaxed); }
+
+    /// @brief Returns the key of __name, adding the name if it is not in the table yet.
+    KwargsKey intern(std::string_view __name)
+    {
+        const KwargsKey key(__name.data(), __name.size());
+
+        if (const _Node* node = _M_find(key, __name))
+        {
+            return node->key;
+        }
+
+        std::lock_guard<std::mutex> lock(_M_mutex);
+
+        // Another thread may have added it in the meantime.
+        if (const _Node* node = _M_find(key, __name))
+        {
+            return node->key;
+        }
+
+        const std::size_t size = _M_nodes.size();
+
+        if (_M_index.load(std::memory_order_relaxed) == nullptr || (size + 1) * 2 > _M_capacity)
+        {
+            _M_grow();
+        }
+
+        _M_nodes.push_back(std::make_unique<_Node>(_Node{ key, std::string(__name) }));
+        _M_insert(*_M_index.load(std::memory_order_relaxed), _M_nodes.back().get());
+
+        _M_size.store(size + 1, std::memory_order_release);
+
+        return key;
+    }
+
+    /// @return The interned key of __name, or nullptr if it has not been interned.
+    [[nodiscard]] const KwargsKey* find(std::string_view __name) const noexcept
+    {
+        const _Node* node = _M_find(KwargsKey(__name.data(), __name.size()), __name);
+        return node ? &node->key : nullptr;
+    }
+
+    [[nodiscard]] bool contains(std::string_view __name) const noexcept
+    { return find(__name) != nullptr; }
+
+    /// @return The name interned for __key, or an empty string_view if there is none.
+    [[nodiscard]] std::string_view nameOf(KwargsKey __key) const noexcept
+    {
+        const _Node* node = _M_find(__key, std::string_view(), false);
+        return node ? std::string_view(node->name) : std::string_view();
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    { return _M_size.load(std::memory_order_acquire); }
+
+private:
+
+    struct _Node
+    {
+        KwargsKey key;
+        std::string name;
+    };
+
+    struct _Index
+    {
+        std::size_t mask;
+        std::unique_ptr<std::atomic<const _Node*>[]> slots;
+
+        // Readers may still be probing the smaller indexes.
+        std::unique_ptr<_Index> previous;
+    };
+
+    [[nodiscard]] static bool _S_same_name(std::string_view __left, std::string_view __right) noexcept
+    {
+#if defined(KWARGS_KEY_CASE_INSENSITIVE)
+        if (__left.size() != __right.size())
+        {
+            return false;
+        }
+
+        for (std::size_t i = 0; i < __left.size(); ++i)
+        {
+            if (detail::tolower(__left[i]) != detail::tolower(__right[i]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+#else
+        return __left == __right;
+#endif
+    }
+
+    [[nodiscard]] const _Node* _M_find(KwargsKey __key, std::string_view __name, bool __compare_name = true) const noexcept
+    {
+        const _Index* index = _M_index.load(std::memory_order_acquire);
+
+        if (index == nullptr)
+        {
+            return nullptr;
+        }
+
+        for (std::size_t i = __key.value() & index->mask; ; i = (i + 1) & index->mask)
+        {
+            const _Node* node = index->slots[i].load(std::memory_order_acquire);
+
+            if (node == nullptr)
+            {
+                return nullptr;
+            }
+            else if (node->key == __key && (__compare_name == false || _S_same_name(node->name, __name)))
+            {
+                return node;
+            }
+        }
+    }
+
+    static void _M_insert(_Index& __index, const _Node* __node) noexcept
+    {
+        std::size_t i = __node->key.value() & __index.mask;
+
+        while (__index.slots[i].load(std::memory_order_relaxed) != nullptr)
+        {
+            i = (i + 1) & __index.mask;
+        }
+
+        __index.slots[i].store(__node, std::memory_order_release);
+    }
+
+    void _M_grow()
+    {
+        const std::size_t capacity = _M_capacity ? _M_capacity * 2 : 16;
+
+        auto index = std::make_unique<_Index>();
+        index->mask = capacity - 1;
+        index->slots = std::make_unique<std::atomic<const _Node*>[]>(capacity);
+
+        for (const auto& node : _M_nodes)
+        {
+            _M_insert(*index, node.get());
+        }
+
+        index->previous.reset(_M_index.load(std::memory_order_relaxed));
+
+        _M_capacity = capacity;
+        _M_index.store(index.release(), std::memory_order_release);
+    }
+
+    std::atomic<_Index*> _M_index{ nullptr };
+    std::atomic<std::size_t> _M_size{ 0 };
+
+    std::mutex _M_mutex;
+    std::size_t _M_capacity = 0;
+    std::vector<std::unique_ptr<_Node>> _M_nodes;
+};
+
+
+
+
+class KwargsValue
+{
+public:
+
+    enum ValueTag : std::int32_t
+    {
+        PointerFlag = 0,
+        ValueFlag,
+        AppliedFlag
+    };
+
+    template<typename _Tp>
+    static constexpr ValueTag checkTag() noexcept
+    {
+        if constexpr (
+            std::disjunction_v<
+                detail::is_integral_or_enum<_Tp>,
+                detail::is_pointer<_Tp>,
+                std::is_array<std::remove_reference_t<_Tp>>,
+                std::is_floating_point<std::remove_reference_t<_Tp>>> &&
+            detail::size_of_v<std::decay_t<_Tp>> <= sizeof(void*))
+        {
+            return ValueFlag;
+        }
+        else if constexpr (std::is_lvalue_reference_v<_Tp>)
+        {
+            return PointerFlag;
+        }
+        else
+        {
+            static_assert(std::disjunction_v<std::is_rvalue_reference<_Tp>, std::negation<std::is_reference<_Tp>>>);
+            return AppliedFlag;
+        }
+    }
+
+protected:
+
+    template<typename _Tp>
+    void _M_place(_Tp&& __value) noexcept
+    {
+        constexpr auto tag = checkTag<_Tp&&>();
+
+        if constexpr (tag == ValueFlag)
+        {
+            _M_data._M_value = 0;
+
+            auto ptr = detail::pointer_cast<std::byte*>(std::addressof(__value));
+
+            for (std::size_t i = 0; i < sizeof(_Tp); ++i, ++ptr)
+            {
+                _M_data._M_bytes[i] = *ptr;
+            }
+        }
+        else if constexpr (tag == AppliedFlag)
+        {
+            _M_data._M_ptr = new (std::nothrow) _Tp(std::move(__value));
+
+        }
+        else if constexpr (tag == PointerFlag)
+        {
+            _M_data._M_ptr = detail::pointer_cast<void*>(std::addressof(__value));
+        }
+    }
+
+protected:
+
+    enum WorkFlags : std::int32_t
+    {
+        DoGetTag,             // [unused]                      , ValueTag*
+        DoApplyAndCopy,       // type*                         , type**
+        DoFree,               // type*                         , [unused]
+        DoCompareEqual,       // std::pair<this, KwargsValue*>*, bool*
+        DoGetType,            // [unused]                      , Type*
+        DoGetUnderlyingType,  // [unused]                      , Type*
+        DoGetBeginIterator,   // this                          , iterator**
+        DoGetBeginValue,      // this                          , value_type*
+        DoGetBeginAnyValue,   // this                          , KwargsValue*
+        DoGetContainerSize,   // this                          , std::size_t*
+        DoGetContainerData,   // this                          , value_type**
+        DoIterate,            // std::pair<this, iterator**>*  , value_type*
+        DoIterateAny,         // std::pair<this, iterator**>*  , KwargsValue*
+        DoEndIteration,       // iterator*                     , [unused]
+        DoGetPairFirst,       // this                          , KwargsValue*
+        DoGetPairSecond,      // this                          , KwargsValue*
+        DoGetPayloadLayout,   // [unused]                      , std::pair<std::size_t, std::size_t>*
+        DoCopyPayloadTo,      // type*                         , void*
+        DoDestroyPayload,     // type*                         , [unused]
+        DoGetReferenceManager,// [unused]                      , manager*
+        DoGetDurationCount    // this                          , detail::duration_count*
+    };
+
+    template<typename _Tp>
+    static constexpr void _S_manage(WorkFlags __work, void* __inData, void* __outData)
+    {
+        using type = detail::enum_underlying_type_t<detail::remove_reference_cv_t<_Tp>>;
+
+        static_assert(std::negation_v<std::is_void<type>>);
+
+        switch (__work)
+        {
+            case DoGetTag:
+            {
+               *detail::pointer_cast<ValueTag*>(__outData) = checkTag<_Tp>();
+                break;
+            }
+
+            case DoApplyAndCopy:
+            {
+                if constexpr (std::negation_v<std::is_array<type>>)
+                {
+                    type*  iptr = detail::pointer_cast<type*>(__inData);
+                    type** optr = detail::pointer_cast<type**>(__outData);
+
+                    *optr = new type(*iptr);
+                }
+
+                break;
+            }
+
+            case DoFree:
+            {
+                if constexpr (std::negation_v<std::is_array<type>>)
+                {
+                    delete detail::pointer_cast<type*>(__inData);
+                }
+
+                break;
+            }
+
+            case DoCompareEqual:
+            {
+                auto optr = detail::pointer_cast<bool*>(__outData);
+
+                if constexpr (detail::is_equality_comparable_v<type>)
+                {
+                    auto iptr = detail::pointer_cast<std::pair<KwargsValue*, KwargsValue*>*>(__inData);
+
+                    *optr = (iptr->first->value<type>() == iptr->second->value<type>());
+                }
+                else
+                {
+                    *optr = false;
+                }
+
+                break;
+            }
+
+            case DoGetType:
+            {
+                *detail::pointer_cast<Type*>(__outData) = Type().construct<_Tp>();
+                break;
+            }
+
+            case DoGetUnderlyingType:
+            {
+                *detail::pointer_cast<Type*>(__outData) = Type().construct<type>();
+                break;
+            }
+
+            case DoGetBeginIterator:
+            {
+                auto iptr = detail::pointer_cast<KwargsValue*>(__inData);
+                auto optr = detail::pointer_cast<detail::container_iterator_t<type>**>(__outData);
+
+                *optr = new detail::container_iterator_t<type>(detail::container_begin_iterator(iptr->reference<type>()));
+                break;
+            }
+
+            case DoGetBeginValue:
+            {
+                using value_type = detail::container_element_type_t<type>;
+
+                auto iptr = detail::pointer_cast<KwargsValue*>(__inData);
+                auto optr = detail::pointer_cast<std::add_pointer_t<detail::remove_const_key_t<value_type>>>(__outData);
+
+                *optr = *detail::container_begin_iterator(iptr->reference<type>());
+                break;
+            }
+
+            case DoGetBeginAnyValue:
+            {
+                auto iptr = detail::pointer_cast<KwargsValue*>(__inData);
+                auto optr = detail::pointer_cast<KwargsValue*>(__outData);
+
+                *optr = *detail::container_begin_iterator(iptr->reference<type>());
+                break;
+            }
+
+            case DoGetContainerSize:
+            {
+                auto optr = detail::pointer_cast<std::size_t*>(__outData);
+
+                if constexpr (detail::has_container_size_v<type>)
+                {
+                    auto iptr = detail::pointer_cast<KwargsValue*>(__inData);
+                    *optr = static_cast<std::remove_reference_t<decltype(*optr)>>(iptr->pointer<type>()->size());
+                }
+                else if constexpr (detail::is_bounded_array_v<type>)
+                {
+                    *optr = std::extent_v<type>;
+                }
+                else if constexpr (detail::is_tuple_like_v<type>)
+                {
+                    *optr = std::tuple_size_v<type>;
+                }
+                else
+                {
+                    *optr = 1;
+                }
+
+                break;
+            }
+
+            case DoGetContainerData:
+            {
+                if constexpr (detail::has_container_data_v<type>)
+                {
+                    if constexpr (detail::is_dereferenceable_v<decltype(std::declval<type&>().data())>)
+                    {
+                        auto iptr = detail::pointer_cast<KwargsValue*>(__inData);
+                        auto optr = detail::pointer_cast<decltype(std::declval<type&>().data())*>(__outData);
+
+                        *optr = iptr->pointer<type>()->data();
+                    }
+                }
+
+                break;
+            }
+
+            case DoIterate:
+            {
+                using value_type = detail::container_element_type_t<type>;
+
+                auto iptr = detail::pointer_cast<std::add_pointer_t<std::pair<KwargsValue*, detail::container_iterator_t<type>**>>>(__inData);
+                auto optr = detail::pointer_cast<std::add_pointer_t<detail::remove_const_key_t<value_type>>>(__outData);
+
+                if (**iptr->second == detail::container_end_iterator(iptr->first->template reference<type>()))
+                {
+                    delete *iptr->second;
+                    *iptr->second = nullptr;
+                }
+                else
+                {
+                    *optr = static_cast<detail::remove_reference_cv_t<detail::dereferenced_iterator_t<type>>>(***iptr->second);
+                    ++**iptr->second;
+                }
+
+                break;
+            }
+
+            case DoIterateAny:
+            {
+                auto iptr = detail::pointer_cast<std::pair<KwargsValue*, detail::container_iterator_t<type>**>*>(__inData);
+                auto optr = detail::pointer_cast<KwargsValue*>(__outData);
+
+                if (**iptr->second == detail::container_end_iterator(iptr->first->template reference<type>()))
+                {
+                    delete *iptr->second;
+                    *iptr->second = nullptr;
+                }
+                else
+                {
+                    *optr = ***iptr->second;
+                    ++**iptr->second;
+                }
+
+                break;
+            }
+
+            case DoEndIteration:
+            {
+                auto iptr = detail::pointer_cast<detail::container_iterator_t<type>*>(__inData);
+                delete iptr;
+
+                break;
+            }
+
+            case DoGetPairFirst:
+            {
+                if constexpr (detail::is_pair_like_v<type>)
+                {
+                    auto iptr = detail::pointer_cast<KwargsValue*>(__inData);
+                    auto optr = detail::pointer_cast<KwargsValue*>(__outData);
+
+                    auto& [first, second] = iptr->reference<type>();
+
+                    *optr = first;
+                }
+                else if constexpr (detail::is_tuple_like_v<type>)
+                {
+                    if constexpr (std::tuple_size_v<type> == 2)
+                    {
+                        auto iptr = detail::pointer_cast<KwargsValue*>(__inData);
+                        auto optr = detail::pointer_cast<KwargsValue*>(__outData);
+
+                        auto& [first, second] = iptr->reference<type>();
+
+                        *optr = first;
+                    }
+                }
+                
+                break;
+            }
+
+            case DoGetPairSecond:
+            {
+                if constexpr (detail::is_pair_like_v<type>)
+                {
+                    auto iptr = detail::pointer_cast<KwargsValue*>(__inData);
+                    auto optr = detail::pointer_cast<KwargsValue*>(__outData);
+
+                    auto& [first, second] = iptr->reference<type>();
+
+                    *optr = second;
+                }
+                else if constexpr (detail::is_tuple_like_v<type>)
+                {
+                    if constexpr (std::tuple_size_v<type> == 2)
+                    {
+                        auto iptr = detail::pointer_cast<KwargsValue*>(__inData);
+                        auto optr = detail::pointer_cast<KwargsValue*>(__outData);
+
+                        auto& [first, second] = iptr->reference<type>();
+
+                        *optr = second;
+                    }
+                }
+                
+                break;
+            }
+
+            // The size and alignment of the object a value holds or refers to, or zeros if it cannot be copied.
+            case DoGetPayloadLayout:
+            {
+                auto optr = detail::pointer_cast<std::pair<std::size_t, std::size_t>*>(__outData);
+
+                if constexpr (std::conjunction_v<std::negation<std::is_array<type>>, std::is_copy_constructible<type>>)
+                {
+                    *optr = { sizeof(type), alignof(type) };
+                }
+                else
+                {
+                    *optr = { 0, 0 };
+                }
+
+                break;
+            }
+
+            case DoCopyPayloadTo:
+            {
+                if constexpr (std::conjunction_v<std::negation<std::is_array<type>>, std::is_copy_constructible<type>>)
+                {
+                    ::new (__outData) type(*detail::pointer_cast<type*>(__inData));
+                }
+
+                break;
+            }
+
+            case DoDestroyPayload:
+            {
+                if constexpr (std::negation_v<std::is_array<type>>)
+                {
+                    detail::pointer_cast<type*>(__inData)->~type();
+                }
+
+                break;
+            }
+
+            // The manager of a value that refers to an object of the same type.
+            case DoGetReferenceManager:
+            {
+                *detail::pointer_cast<void (**)(WorkFlags, void*, void*)>(__outData) = &KwargsValue::_S_manage<std::remove_reference_t<_Tp>&>;
+                break;
+            }
+
+            case DoGetDurationCount:
+            {
+                if constexpr (detail::is_duration_v<type>)
+                {
+                    using rep = typename type::rep;
+
+                    auto iptr = detail::pointer_cast<KwargsValue*>(__inData);
+                    auto optr = detail::pointer_cast<detail::duration_count*>(__outData);
+
+                    const rep count = iptr->reference<type>().count();
+
+                    optr->num = type::period::num;
+                    optr->den = type::period::den;
+
+                    if constexpr (std::is_floating_point_v<rep>)
+                    {
+                        optr->is_floating_point = true;
+                        optr->real = static_cast<long double>(count);
+                    }
+                    else
+                    {
+                        optr->integer = static_cast<std::intmax_t>(count);
+                    }
+                }
+
+                break;
+            }
+        }
+    }
+
+public:
+
+    constexpr KwargsValue() noexcept = default;
+
+    constexpr KwargsValue(const KwargsValue& __other) noexcept
+    {
+        if (__other.valueTag() == AppliedFlag)
+            __other._M_manager(DoApplyAndCopy, __other._M_data._M_ptr, &_M_data._M_ptr);
+        else
+            _M_data._M_value = __other._M_data._M_value;
+
+        _M_manager = __other._M_manager;
+    }
+
+    constexpr KwargsValue(KwargsValue&& __other) noexcept
+        : _M_manager(detail::exchange(__other._M_manager, &KwargsValue::_S_manage<int>))
+    {
+       _M_data._M_value = __other._M_data._M_value;
+    }
+
+    template<typename _Tp>
+    constexpr KwargsValue(_Tp&& __value) noexcept
+        : _M_manager(&KwargsValue::_S_manage<_Tp&&>)
+    {
+        if constexpr (std::is_array_v<std::remove_reference_t<_Tp>>)
+        {
+            static_assert(checkTag<decltype(__value)>() == ValueFlag);
+            _M_data._M_ptr = detail::pointer_cast<std::decay_t<_Tp>>(__value);
+        }
+        else
+        {
+            _M_place(std::forward<_Tp>(__value));
+        }
+    }
+    
+    template<typename _Tp, std::size_t _Size>
+    constexpr KwargsValue(const _Tp (&__value)[_Size]) noexcept
+        : _M_manager(&KwargsValue::_S_manage<const _Tp (&)[_Size]>)
+    {
+        static_assert(checkTag<decltype(__value)>() == ValueFlag);
+        _M_data._M_ptr = detail::pointer_cast<_Tp*>(__value);
+    }
+
+    _KWARGS_DESTRUCTOR_CONSTEXPR ~KwargsValue() noexcept
+    {
+        if (valueTag() == AppliedFlag)
+        {
+            _M_manager(DoFree, _M_data._M_ptr, nullptr);
+        }
+    }
+
+    [[nodiscard]] constexpr ValueTag valueTag() const noexcept
+    {
+        ValueTag _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(result);
+        _M_manager(DoGetTag, nullptr, &result);
+
+        return result;
+    }
+
+    [[nodiscard]] constexpr Type type() const noexcept
+    {
+        Type _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(result);
+        _M_manager(DoGetType, nullptr, &result);
+
+        return result;
+    }
+
+    [[nodiscard]] constexpr Type underlyingType() const noexcept
+    {
+        Type _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(result);
+        _M_manager(DoGetUnderlyingType, nullptr, &result);
+
+        return result;
+    }
+
+    template<typename _Tp>
+    [[nodiscard]] constexpr auto data() const noexcept -> std::remove_reference_t<_Tp>
+    {
+        std::remove_reference_t<_Tp> _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(result);
+        _M_manager(DoGetContainerData, detail::as_non_cv(this), &result);
+
+        return result;
+    }
+
+    [[nodiscard]] constexpr std::size_t elementCount() const noexcept
+    {
+        std::size_t _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(result);
+        _M_manager(DoGetContainerSize, detail::as_non_cv(this), &result);
+
+        return result;
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    { return elementCount(); }
+
+    template<typename _Tp>
+    [[nodiscard]] _KWARGS_NON_LITERAL_FUNCTION_CONSTEXPR _Tp first() const noexcept
+    {
+        KwargsValue _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(result);
+        _M_manager(DoGetPairFirst, detail::as_non_cv(this), &result);
+
+        return result.value<_Tp>();
+    }
+
+    template<typename _Tp>
+    [[nodiscard]] _KWARGS_NON_LITERAL_FUNCTION_CONSTEXPR _Tp second() const noexcept
+    {
+        KwargsValue _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(result);
+        _M_manager(DoGetPairSecond, detail::as_non_cv(this), &result);
+
+        return result.value<_Tp>();
+    }
+
+    template<typename _Tp>
+    [[nodiscard]] constexpr auto pointer() noexcept
+        -> std::add_pointer_t<std::remove_reference_t<_Tp>>
+    {
+        using result_type = std::add_pointer_t<std::remove_reference_t<_Tp>>;
+
+        switch (valueTag())
+        {
+            case PointerFlag:
+            case AppliedFlag:
+                
+                return detail::pointer_cast<result_type>(_M_data._M_ptr);
+
+
+            case ValueFlag:
+
+                // Taking the address of an array causes it to decay to a pointer to its first element.
+                if constexpr (std::is_array_v<std::remove_reference_t<_Tp>>)
+                {
+                    return detail::pointer_cast<result_type>(_M_data._M_ptr);
+                }
+                else
+                {
+                    return detail::pointer_cast<result_type>(&_M_data._M_value);
+                }
+
+            _KWARGS_ATTRIBUTE_UNLIKELY
+            default:
+                
+                assert(false);
+                return nullptr;
+        }
+    }
+
+    template<typename _Tp>
+    [[nodiscard]] constexpr auto pointer() const noexcept
+        -> std::add_pointer_t<std::add_const_t<std::remove_reference_t<_Tp>>>
+    {
+        using result_type = std::add_pointer_t<std::remove_reference_t<_Tp>>;
+
+        switch (valueTag())
+        {
+            case PointerFlag:
+            case AppliedFlag:
+                
+                return detail::pointer_cast<result_type>(_M_data._M_ptr);
+
+            case ValueFlag:
+
+                // Taking the address of an array causes it to decay to a pointer to its first element.
+                if constexpr (std::is_array_v<std::remove_reference_t<_Tp>>)
+                {
+                    return detail::pointer_cast<result_type>(_M_data._M_ptr);
+                }
+                else
+                {
+                    return detail::pointer_cast<result_type>(&_M_data._M_value);
+                }
+
+            _KWARGS_ATTRIBUTE_UNLIKELY
+            default:
+                
+                assert(false);
+                return nullptr;
+        }
+    }
+
+
+    template<typename _Tp>
+    [[nodiscard]] constexpr _Tp& reference() noexcept
+    { return *pointer<_Tp>(); }
+
+    template<typename _Tp>
+    [[nodiscard]] constexpr const _Tp& reference() const noexcept
+    { return *pointer<_Tp>(); }
+
+
+    template<typename _Tp>
+    [[nodiscard]] constexpr operator _Tp() const noexcept
+    {
+        static_assert(std::negation_v<std::disjunction<std::is_reference<_Tp>, std::is_array<_Tp>>>);
+        return value<_Tp>();
+    }
+
+    template<typename _Tp, typename... _Args>
+    [[nodiscard]] constexpr auto value(_Args&&... __args) const noexcept
+        -> std::enable_if_t<std::is_same_v<detail::remove_reference_cv_t<_Tp>, char>, std::remove_reference_t<_Tp>>
+    {
+        using result_type = std::remove_reference_t<_Tp>;
+
+        Type&& ty = type();
+
+        if (ty.isSameAs<bool>())
+        {
+            return static_cast<result_type>(static_cast<bool>(_M_data._M_bytes[0]) ? 't' : 'f');
+        }
+        else if (ty.isCharacter())
+        {
+            return static_cast<result_type>(_M_data._M_bytes[0]);
+        }
+        else if (ty.isCharacterPointer())
+        {
+            return reference<result_type*>()[0];
+        }
+        else if (ty.isIterable())
+        {
+            return _M_beginValue<result_type>(ty);
+        }
+        else
+        {
+            return static_cast<result_type>(value<int>(std::forward<_Args>(__args)...));
+        }
+    }
+
+    template<typename _Tp, typename... _Args>
+    [[nodiscard]] constexpr auto value(_Args&&... __args) const noexcept
+        -> std::enable_if_t<detail::is_char_pointer_v<_Tp>, std::remove_reference_t<_Tp>>
+    {
+        using result_type = std::remove_reference_t<_Tp>;
+
+        Type&& ty = type();
+
+        if (ty.isSameAs<bool>())
+        {
+            return detail::pointer_cast<result_type>(static_cast<bool>(_M_data._M_bytes[0]) ? "true" : "false");
+        }
+        else if (ty.isCharacter())
+        {
+            return detail::pointer_cast<result_type>(&_M_data._M_bytes[0]);
+        }
+        else if (ty.isCharacterPointer())
+        {
+            return detail::pointer_cast<result_type>(reference<const char*>());
+        }
+        else if (ty.isStdString())
+        {
+            return detail::pointer_cast<result_type>(pointer<std::string>()->c_str());
+        }
+        else if (ty.isStdStringView())
+        {
+            return detail::pointer_cast<result_type>(pointer<std::string_view>()->data());
+        }
+        else if (Type&& vty = ty.valueType(); ty.isStdVector() && vty.isCharacter())
+        {
+            return detail::pointer_cast<result_type>(pointer<std::vector<char>>()->data());
+        }
+        else if (ty.isStdArray() && vty.isCharacter())
+        {
+            return detail::pointer_cast<result_type>(pointer<std::array<char, 1>>()->data());
+        }
+
+        if constexpr (sizeof...(_Args) == 0)
+        {
+            return detail::pointer_cast<result_type>("");
+        }
+        else
+        {
+            return result_type(std::forward<_Args>(__args)...);
+        }
+    }
+
+    template<typename _Tp, typename... _Args>
+    [[nodiscard]] constexpr auto value(_Args&&... __args) const noexcept
+        -> std::enable_if_t<detail::is_std_string_v<_Tp>, std::remove_reference_t<_Tp>>
+    {
+        using result_type = std::remove_reference_t<_Tp>;
+
+        Type&& ty = type();
+
+        if (ty.isSameAs<bool>())
+        {
+            return result_type(
+                detail::pointer_cast<
+                    const detail::container_value_type_t<result_type>*>(
+                        static_cast<bool>(_M_data._M_bytes[0]) ? "true" : "false"));
+        }
+        else if (ty.isCharacter())
+        {
+            return result_type(1, static_cast<detail::container_value_type_t<result_type>>(_M_data._M_bytes[0]));
+        }
+        else if (ty.isCharacterPointer())
+        {
+            if (ty.isArray())
+            {
+                return result_type(reference<const detail::container_value_type_t<result_type>*>(), ty.size() / sizeof(char) - 1);
+            }
+            else
+            {
+                return result_type(reference<const detail::container_value_type_t<result_type>*>());
+            }
+        }
+        else if (ty.isStdString())
+        {
+            return reference<result_type>();
+        }
+        else if (ty.isStdStringView())
+        {
+            const auto* ptr = pointer<std::basic_string_view<detail::container_value_type_t<result_type>>>();
+            return result_type(ptr->data(), ptr->size());
+        }
+        else if (ty.isIntegralOrEnum())
+        {
+            if (ty.isSigned())
+            {
+                if (ty.size() == sizeof(std::int8_t))
+                {
+                    return detail::integer_to_string<result_type>(reference<std::int8_t >());
+                }
+                else if (ty.size() == sizeof(std::int16_t))
+                {
+                    return detail::integer_to_string<result_type>(reference<std::int16_t>());
+                }
+                else if (ty.size() == sizeof(std::int32_t))
+                {
+                    return detail::integer_to_string<result_type>(reference<std::int32_t>());
+                }
+                else // if (ty.size() == sizeof(std::int64_t))
+                {
+                    return detail::integer_to_string<result_type>(reference<std::int64_t>());
+                }
+            }
+            else
+            {
+                return detail::integer_to_string<result_type>(reference<std::uint64_t>());
+            }
+        }
+        else if (ty.isFloatingPoint())
+        {
+            auto convert = [&](auto __n) -> result_type {
+                if constexpr (std::conjunction_v<std::bool_constant<sizeof...(_Args) == 1>, std::is_same<detail::remove_reference_cv_t<_Args>, fmt::FloatFormat>...>)
+                {
+                    const fmt::FloatFormat& format = (__args, ...);
+
+                    if (format.style != fmt::FloatFormat::Shortest)
+                    {
+                        return detail::formatted_floating_point_to_string<result_type>(__n, format.style == fmt::FloatFormat::Scientific, format.precision);
+                    }
+                }
+
+                return detail::floating_point_to_string<result_type>(__n);
+            };
+
+            if (ty.size() == sizeof(float))
+            {
+                return convert(reference<float>());
+            }
+            else if (ty.size() == sizeof(double))
+            {
+                return convert(reference<double>());
+            }
+            else // if (ty.size() == sizeof(long double))
+            {
+                return convert(reference<long double>());
+            }
+        }
+        else if (ty.isPointer())
+        {
+            return detail::pointer_to_string<result_type>(reference<void*>());
+        }
+        else
+        {
+            return _M_getInsertableContainer<result_type>(ty);
+        }
+    }
+
+    template<typename _Tp, typename... _Args>
+    [[nodiscard]] constexpr auto value(_Args&&... __args) const noexcept
+        -> std::enable_if_t<detail::is_std_string_view_v<_Tp>, std::remove_reference_t<_Tp>>
+    {
+        using result_type = std::remove_reference_t<_Tp>;
+
+        Type&& ty = type();
+
+        if (ty.isSameAs<bool>())
+        {
+            return result_type(
+                detail::pointer_cast<
+                    const detail::container_value_type_t<result_type>*>(
+                        static_cast<bool>(_M_data._M_bytes[0]) ? "true" : "false"));
+        }
+        else if (ty.isCharacter())
+        {
+            return result_type(detail::pointer_cast<detail::container_value_type_t<result_type>*>(&_M_data._M_bytes[0]), 1);
+        }
+        else if (ty.isCharacterPointer())
+        {
+            if (ty.isArray())
+            {
+                return result_type(reference<const detail::container_value_type_t<result_type>*>(), ty.size() / sizeof(char) - 1);
+            }
+            else
+            {
+                return result_type(reference<const detail::container_value_type_t<result_type>*>());
+            }
+        }
+        else if (ty.isStdString())
+        {
+            const auto* ptr = pointer<std::basic_string<detail::container_value_type_t<result_type>>>();
+            return result_type(ptr->data(), ptr->size());
+        }
+        else if (ty.isStdStringView())
+        {
+            return reference<result_type>();
+        }
+        else if (Type&& vty = ty.valueType(); ty.isStdVector() && vty.isCharacter())
+        {
+            const auto* ptr = pointer<std::vector<detail::container_value_type_t<result_type>>>();
+            return result_type(ptr->data(), ptr->size());
+        }
+        else if (ty.isStdArray() && vty.isCharacter())
+        {
+            const auto* ptr = pointer<std::array<detail::container_value_type_t<result_type>, 1>>();
+            return result_type(ptr->data(), ty.size() / vty.size());
+        }
+
+        return result_type(std::forward<_Args>(__args)...);
+    }
+
+    template<typename _Tp, typename... _Args>
+    [[nodiscard]] constexpr auto value(_Args&&... __args) const noexcept
+        -> std::enable_if_t<detail::is_integral_or_enum_v<_Tp> && std::negation_v<std::is_same<detail::remove_reference_cv_t<_Tp>, char>>, std::remove_reference_t<_Tp>>
+    {
+        using result_type = std::remove_reference_t<_Tp>;
+
+        Type&& ty = type();
+
+        if constexpr (detail::is_suffix_table_argument_v<_Args...>)
+        {
+            std::string_view sv;
+
+            return _M_viewCharacters(ty, sv) ? detail::string_to_integer<result_type>(sv, (__args, ...)) : value<_Tp>();
+        }
+
+        if (ty.isIntegralOrEnum())
+        {
+            if (ty.isSigned())
+            {
+                if (ty.size() == sizeof(std::int8_t))
+                {
+                    return static_cast<result_type>(reference<std::int8_t>());
+                }
+                else if (ty.size() == sizeof(std::int16_t)) _KWARGS_ATTRIBUTE_UNLIKELY
+                {
+                    return static_cast<result_type>(reference<std::int16_t>());
+                }
+                else if (ty.size() == sizeof(std::int32_t)) _KWARGS_ATTRIBUTE_LIKELY
+                {
+                    return static_cast<result_type>(reference<std::int32_t>());
+                }
+                else // if (ty.size() == sizeof(std::int64_t))
+                {
+                    return static_cast<result_type>(reference<std::int64_t>());
+                }
+            }
+            else
+            {
+                return static_cast<result_type>(reference<std::uint64_t>());
+            }
+        }
+        else if (ty.isFloatingPoint())
+        {
+            if (ty.size() == sizeof(float))
+            {
+                return static_cast<result_type>(reference<float>());
+            }
+            else if (ty.size() == sizeof(double))
+            {
+                return static_cast<result_type>(reference<double>());
+            }
+            else // if (ty.size() == sizeof(long double))
+            {
+                return static_cast<result_type>(reference<long double>());
+            }
+        }
+        else if (ty.isCharacterPointer())
+        {
+            if (auto ptr = reference<const char*>(); ptr == nullptr)
+            {
+                return static_cast<result_type>(0);
+            }
+            else if (ty.isArray())
+            {
+                return detail::string_to_integer<result_type>(std::string_view(ptr, ty.size() / sizeof(char) - 1));
+            }
+            else
+            {
+                return detail::string_to_integer<result_type>(ptr);
+            }
+        }
+        else if (ty.isPointer() || ty.isArray())
+        {
+            return static_cast<result_type>(reinterpret_cast<std::uintptr_t>(reference<void*>()));
+        }
+        else if (ty.isStdString())
+        {
+            return detail::string_to_integer<result_type>(reference<std::string>());
+        }
+        else if (ty.isStdStringView())
+        {
+            return detail::string_to_integer<result_type>(reference<std::string_view>());
+        }
+        else if (ty.valueType().isCharacter())
+        {
+            if (ty.isStdArray())
+            {
+                std::string_view sv(reference<std::array<char, 1>>().data(), ty.size() / sizeof(char));
+
+                return detail::string_to_integer<result_type>(sv);
+            }
+            else if (ty.isStdVector())
+            {
+                std::string_view sv(reference<std::vector<char>>().data(), elementCount());
+
+                return detail::string_to_integer<result_type>(sv);
+            }
+        }
+
+        if constexpr (detail::is_suffix_table_argument_v<_Args...>)
+        {
+            return result_type{};
+        }
+        else
+        {
+            return result_type(std::forward<_Args>(__args)...);
+        }
+    }
+
+    template<typename _Tp, typename... _Args>
+    [[nodiscard]] constexpr auto value(_Args&&... __args) const noexcept
+        -> std::enable_if_t<std::is_floating_point_v<_Tp>, _Tp>
+    {
+        using result_type = std::remove_reference_t<_Tp>;
+
+        Type&& ty = type();
+
+        if constexpr (detail::is_suffix_table_argument_v<_Args...>)
+        {
+            std::string_view sv;
+
+            return _M_viewCharacters(ty, sv) ? detail::string_to_floating_point<result_type>(sv, (__args, ...)) : value<_Tp>();
+        }
+
+        if (ty.isIntegralOrEnum())
+        {
+            if (ty.isSigned())
+            {
+                if (ty.size() == sizeof(std::int8_t))
+                {
+                    return static_cast<result_type>(reference<std::int8_t>());
+                }
+                else if (ty.size() == sizeof(std::int16_t)) _KWARGS_ATTRIBUTE_UNLIKELY
+                {
+                    return static_cast<result_type>(reference<std::int16_t>());
+                }
+                else if (ty.size() == sizeof(std::int32_t)) _KWARGS_ATTRIBUTE_LIKELY
+                {
+                    return static_cast<result_type>(reference<std::int32_t>());
+                }
+                else // if (ty.size() == sizeof(std::int64_t))
+                {
+                    return static_cast<result_type>(reference<std::int64_t>());
+                }
+            }
+            else
+            {
+                return static_cast<result_type>(reference<std::uint64_t>());
+            }
+        }
+        else if (ty.isFloatingPoint())
+        {
+            if (ty.size() == sizeof(float))
+            {
+                return static_cast<result_type>(reference<float>());
+            }
+            else if (ty.size() == sizeof(double))
+            {
+                return static_cast<result_type>(reference<double>());
+            }
+            else // if (ty.size() == sizeof(long double))
+            {
+                return static_cast<result_type>(reference<long double>());
+            }
+        }
+        else if (ty.isCharacterPointer())
+        {
+            if (auto ptr = reference<const char*>(); ptr == nullptr)
+            {
+                return static_cast<result_type>(0);
+            }
+            else if (ty.isArray())
+            {
+                return static_cast<result_type>(detail::string_to_floating_point<result_type>(std::string_view(ptr, ty.size() / sizeof(char) - 1)));
+            }
+            else
+            {
+                return static_cast<result_type>(detail::string_to_floating_point<result_type>(ptr));
+            }
+        }
+        else if (ty.isStdString())
+        {
+            return detail::string_to_floating_point<result_type>(reference<std::string>());
+        }
+        else if (ty.isStdStringView())
+        {
+            return detail::string_to_floating_point<result_type>(reference<std::string_view>());
+        }
+        else if (ty.isStdArray())
+        {
+            return static_cast<result_type>(detail::string_to_floating_point<result_type>(std::string_view(reference<std::array<char, 1>>().data(), elementCount())));
+        }
+        else if (ty.isStdVector())
+        {
+            return static_cast<result_type>(detail::string_to_floating_point<result_type>(std::string_view(reference<std::vector<char>>().data(), elementCount())));
+        }
+
+        if constexpr (detail::is_suffix_table_argument_v<_Args...>)
+        {
+            return result_type{};
+        }
+        else
+        {
+            return result_type(std::forward<_Args>(__args)...);
+        }
+    }
+
+    template<typename _Tp, typename... _Args>
+    [[nodiscard]] constexpr auto value(_Args&&... __args) const noexcept
+        -> std::enable_if_t<detail::is_pointer_v<std::remove_reference_t<_Tp>> && std::negation_v<detail::is_char_pointer<_Tp>>, std::remove_reference_t<_Tp>>
+    {
+        using result_type = std::remove_reference_t<_Tp>;
+
+        Type&& ty = type();
+
+        if constexpr (std::is_null_pointer_v<result_type>)
+        {
+            return static_cast<result_type>(nullptr);
+        }
+        else if (ty.isPointer())
+        {
+            return reference<result_type>();
+        }
+        else if constexpr (std::negation_v<std::is_null_pointer<result_type>>)
+        {
+            if (ty.hasData())
+            {
+                return data<detail::container_value_type_t<result_type>*>();
+            }
+            else
+            {
+                return result_type(std::forward<_Args>(__args)...);
+            }
+        }
+        else
+        {
+            return result_type(std::forward<_Args>(__args)...);
+        }
+    }
+
+    template<typename _Tp, typename... _Args>
+    [[nodiscard]] constexpr auto value(_Args&&... __args) const noexcept
+        -> std::enable_if_t<std::conjunction_v<detail::is_tuple_like<_Tp>, std::negation<detail::is_std_array<_Tp>>>, std::remove_reference_t<_Tp>>
+    {
+        using result_type = std::remove_reference_t<_Tp>;
+
+        Type&& ty = type();
+        
+        if (ty.isSameAs<result_type>())
+        {
+            return reference<result_type>();
+        }
+        else if constexpr (std::tuple_size_v<result_type> == 2)
+        {
+            return result_type(first<detail::first_of_tuple_t<result_type>>(), second<detail::second_of_tuple_t<result_type>>());
+        }
+        else
+        {
+            return result_type(std::forward<_Args>(__args)...);
+        }
+    }
+
+    template<typename _Tp, typename... _Args>
+    [[nodiscard]] constexpr auto value(_Args&&... __args) const noexcept
+        -> std::enable_if_t<detail::is_unbounded_array_v<_Tp>, std::decay_t<_Tp>>
+    {
+        using result_type = std::decay_t<_Tp>;
+
+        Type&& ty = type();
+
+        if (ty.isSameAs<std::remove_cv_t<std::decay_t<_Tp>>>() || (ty.isArray() && ty.valueType().isSameAs<std::remove_cv_t<std::remove_extent_t<_Tp>>>()))
+        {
+            return reference<result_type>();
+        }
+        else
+        {
+            return result_type(std::forward<_Args>(__args)...);
+        }
+    }
+
+    template<typename _Tp, typename... _Args>
+    [[nodiscard]] constexpr auto value(_Args&&... __args) const noexcept
+        -> std::enable_if_t<detail::is_bounded_array_v<_Tp>, std::array<std::remove_extent_t<std::remove_reference_t<_Tp>>, std::extent_v<std::remove_reference_t<_Tp>>>>
+    {
+        using result_type = std::array<std::remove_extent_t<std::remove_reference_t<_Tp>>, std::extent_v<std::remove_reference_t<_Tp>>>;
+
+        return value<result_type>(std::forward<_Args>(__args)...);
+    }
+
+    template<typename _Tp, typename... _Args>
+    [[nodiscard]] constexpr auto value(_Args&&...) const noexcept
+        -> std::enable_if_t<std::conjunction_v<
+            detail::is_insertable_container<_Tp>,
+            std::negation<std::disjunction<
+                detail::is_std_string<_Tp>,
+                detail::is_std_string_view<_Tp>>>>, std::remove_reference_t<_Tp>>
+    {
+        using result_type = std::remove_reference_t<_Tp>;
+
+        Type&& ty = type();
+
+        if (ty.isSameAs<result_type>())
+        {
+            return reference<result_type>();
+        }
+        else
+        {
+            return _M_getInsertableContainer<result_type>(ty);
+        }
+    }
+
+    template<typename _Tp, typename... _Args>
+    [[nodiscard]] constexpr auto value(_Args&&...) const noexcept
+        -> std::enable_if_t<std::conjunction_v<
+            detail::is_iterable<_Tp>,
+            std::negation<std::disjunction<
+                std::is_array<std::remove_reference_t<_Tp>>,
+                detail::is_insertable_container<_Tp>,
+                detail::is_std_string<_Tp>,
+                detail::is_std_string_view<_Tp>>>>, std::remove_reference_t<_Tp>>
+    {
+        using result_type = std::remove_reference_t<_Tp>;
+
+        Type&& ty = type();
+
+        if (ty.isSameAs<result_type>())
+        {
+            return reference<result_type>();
+        }
+        else
+        {
+            return _M_getIterableContainer<result_type>(ty);
+        }
+    }
+
+    /**
+     * @brief A string such as "250ms" is read with kwargs::unit::durations, or with the suffix table
+     *        given as the only argument; a number without a suffix, or a numeric value, counts @c _Tp::period;
+     *        a stored duration of another type is rescaled as @c std::chrono::duration_cast does.
+     *        A string whose suffix is not in the table, such as "10m", gives the default value.
+     */
+    template<typename _Tp, typename... _Args>
+    [[nodiscard]] constexpr auto value(_Args&&... __args) const noexcept
+        -> std::enable_if_t<detail::is_duration_v<_Tp>, std::remove_reference_t<_Tp>>
+    {
+        using result_type = std::remove_reference_t<_Tp>;
+
+        using rep = typename detail::remove_reference_cv_t<_Tp>::rep;
+        using period = typename detail::remove_reference_cv_t<_Tp>::period;
+
+        Type&& ty = type();
+
+        if (ty.isSameAs<detail::remove_reference_cv_t<_Tp>>())
+        {
+            return reference<result_type>();
+        }
+        else if (detail::duration_count count; _M_manager(DoGetDurationCount, detail::as_non_cv(this), &count), count.num != 0)
+        {
+            // Another duration type, rescaled from its own period.
+            return result_type(detail::rescale_duration<rep, period>(count));
+        }
+        else if (std::string_view sv; _M_viewCharacters(ty, sv))
+        {
+            std::errc ec = std::errc{};
+
+            auto convert = [&sv, &ec](const auto& __table) constexpr noexcept -> rep {
+                if constexpr (std::is_floating_point_v<rep>)
+                {
+                    return detail::string_to_floating_point<rep, period>(sv, __table, ec);
+                }
+                else
+                {
+                    return detail::string_to_integer<rep, period>(sv, __table, ec);
+                }
+            };
+
+            if constexpr (detail::is_suffix_table_argument_v<_Args...>)
+            {
+                return result_type(convert((__args, ...)));
+            }
+            else if (const rep count = convert(unit::durations); ec != std::errc::invalid_argument)
+            {
+                return result_type(count);
+            }
+        }
+        else if (ty.isIntegralOrEnum() || ty.isFloatingPoint())
+        {
+            return result_type(value<rep>());
+        }
+
+        if constexpr (detail::is_suffix_table_argument_v<_Args...>)
+        {
+            return result_type{};
+        }
+        else
+        {
+            return result_type(std::forward<_Args>(__args)...);
+        }
+    }
+
+    template<typename _Tp, typename... _Args>
+    [[nodiscard]] constexpr auto value(_Args&&... __args) const noexcept
+        -> std::enable_if_t<
+            std::disjunction_v<
+                std::is_class<std::remove_reference_t<_Tp>>,
+                std::is_union<std::remove_reference_t<_Tp>>> &&
+            std::negation_v<std::disjunction<
+                detail::is_insertable_container<_Tp>,
+                detail::is_iterable<_Tp>,
+                detail::is_tuple_like<_Tp>,
+                detail::is_duration<_Tp>>>, std::remove_reference_t<_Tp>>
+    {
+        using result_type = std::remove_reference_t<_Tp>;
+
+        Type&& ty = type();
+
+        if (ty.isSameAs<result_type>())
+        {
+            return reference<result_type>();
+        }
+        else
+        {
+            return result_type(std::forward<_Args>(__args)...);
+        }
+    }
+
+    /**
+     * @brief Writes the characters of value<std::string>() to [__first, __last).
+     * 
+     * Values of type bool, a character type, const char* or a char array, std::string, std::string_view,
+     * an integral, enumeration, floating-point or pointer type are written without allocating and
+     * never throw; other values go through value<std::string>(), which may throw std::bad_alloc.
+     * 
+     * @return Pointer past the last written character, or nullptr if the range is too small.
+     */
+    constexpr char* valueTo(char* __first, char* __last) const
+    {
+        const auto capacity = static_cast<std::size_t>(__last - __first);
+
+        return _M_toChars([__first, capacity](const char* __data, std::size_t __size) constexpr noexcept -> char* {
+            return __size > capacity ? nullptr : detail::copy(__data, __data + __size, __first);
+        });
+    }
+
+    /**
+     * @brief Appends the characters of value<std::string>() to @c __str, see valueTo().
+     */
+    _KWARGS_NON_LITERAL_FUNCTION_CONSTEXPR std::string& appendTo(std::string& __str) const
+    {
+        _M_toChars([&__str](const char* __data, std::size_t __size) -> void {
+            __str.append(__data, __size);
+        });
+
+        return __str;
+    }
+
+    constexpr KwargsValue& operator=(const KwargsValue& __other)
+    {
+        if (valueTag() == AppliedFlag)
+        {
+            _M_manager(DoFree, _M_data._M_ptr, nullptr);
+        }
+
+        if (__other.valueTag() == AppliedFlag)
+        {
+            __other._M_manager(DoApplyAndCopy, __other._M_data._M_ptr, &_M_data._M_ptr);
+        }
+        else
+        {
+            _M_data._M_value = __other._M_data._M_value;
+        }
+
+        _M_manager = __other._M_manager;
+
+        return *this;
+    }
+
+    constexpr KwargsValue& operator=(KwargsValue&& __other) noexcept
+    {
+        if (valueTag() == AppliedFlag)
+        {
+            _M_manager(DoFree, _M_data._M_ptr, nullptr);
+        }
+
+        _M_data._M_value = __other._M_data._M_value;
+
+        _M_manager = detail::exchange(__other._M_manager, &KwargsValue::_S_manage<int>);
+
+        return *this;
+    }
+
+    constexpr void swap(KwargsValue& __other) noexcept
+    { detail::bit_swap(*this, __other); }
+
+    [[nodiscard]] constexpr bool operator==(const KwargsValue& __other) const noexcept
+    {
+        bool _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(result);
+
+        auto in_data = std::make_pair(this, &__other);
+        _M_manager(DoCompareEqual, &in_data, &result);
+
+        return result;
+    }
+
+    template<typename _Tp>
+    [[nodiscard]] constexpr bool operator==(const _Tp& __other) const noexcept
+    { return value<_Tp>() == __other; }
+
+protected:
+
+    // Hands the characters of value<std::string>() to __write(const char*, std::size_t).
+    template<typename _Writer>
+    constexpr auto _M_toChars(_Writer&& __write) const -> std::invoke_result_t<_Writer&, const char*, std::size_t>
+    {
+        Type&& ty = type();
+
+        if (ty.isSameAs<bool>())
+        {
+            return static_cast<bool>(_M_data._M_bytes[0]) ? __write("true", 4) : __write("false", 5);
+        }
+        else if (ty.isCharacter())
+        {
+            return __write(detail::pointer_cast<const char*>(&_M_data._M_bytes[0]), 1);
+        }
+        else if (ty.isCharacterPointer())
+        {
+            const char* str = reference<const char*>();
+
+            return __write(str, ty.isArray() ? ty.size() / sizeof(char) - 1 : std::char_traits<char>::length(str));
+        }
+        else if (ty.isStdString())
+        {
+            const auto& str = reference<std::string>();
+            return __write(str.data(), str.size());
+        }
+        else if (ty.isStdStringView())
+        {
+            const auto& str = reference<std::string_view>();
+            return __write(str.data(), str.size());
+        }
+        else if (ty.isIntegralOrEnum())
+        {
+            if (ty.isSigned())
+            {
+                if (ty.size() == sizeof(std::int8_t))
+                {
+                    return _M_integerToChars<std::int8_t>(__write);
+                }
+                else if (ty.size() == sizeof(std::int16_t))
+                {
+                    return _M_integerToChars<std::int16_t>(__write);
+                }
+                else if (ty.size() == sizeof(std::int32_t))
+                {
+                    return _M_integerToChars<std::int32_t>(__write);
+                }
+                else // if (ty.size() == sizeof(std::int64_t))
+                {
+                    return _M_integerToChars<std::int64_t>(__write);
+                }
+            }
+            else
+            {
+                return _M_integerToChars<std::uint64_t>(__write);
+            }
+        }
+        else if (ty.isFloatingPoint())
+        {
+            if (ty.size() == sizeof(float))
+            {
+                return _M_floatingPointToChars<float>(__write);
+            }
+            else if (ty.size() == sizeof(double))
+            {
+                return _M_floatingPointToChars<double>(__write);
+            }
+            else // if (ty.size() == sizeof(long double))
+            {
+                return _M_floatingPointToChars<long double>(__write);
+            }
+        }
+        else if (ty.isPointer())
+        {
+            char _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(buffer[detail::integer_chars_max_v<std::uintptr_t>]);
+            const char* last = detail::integer_to_chars(buffer, reinterpret_cast<std::uintptr_t>(reference<void*>()), 16);
+
+            return __write(static_cast<const char*>(buffer), static_cast<std::size_t>(last - buffer));
+        }
+        else
+        {
+            const auto str = value<std::string>();
+            return __write(str.data(), str.size());
+        }
+    }
+
+    // Kept out of _M_toChars so that only the buffer in use is on the stack,
+    // or in thread-local storage with KWARGS_CONVERT_WITH_BOUNDED_STACK.
+    template<typename _Tp, typename _Writer>
+    constexpr auto _M_integerToChars(_Writer& __write) const -> std::invoke_result_t<_Writer&, const char*, std::size_t>
+    {
+        using buffer_type = std::array<char, detail::integer_chars_max_v<_Tp>>;
+
+        return detail::with_scratch<buffer_type, KwargsValue>([this, &__write](buffer_type& __buffer) constexpr {
+            const char* const last = detail::integer_to_chars(__buffer.data(), reference<_Tp>());
+
+            return __write(static_cast<const char*>(__buffer.data()), static_cast<std::size_t>(last - __buffer.data()));
+        });
+    }
+
+    template<typename _Tp, typename _Writer>
+    constexpr auto _M_floatingPointToChars(_Writer& __write) const -> std::invoke_result_t<_Writer&, const char*, std::size_t>
+    {
+        using buffer_type = std::array<char, detail::floating_point_chars_max_v<_Tp>>;
+
+        return detail::with_scratch<buffer_type, KwargsValue>([this, &__write](buffer_type& __buffer) constexpr {
+            const char* const last = detail::floating_point_to_chars(__buffer.data(), reference<_Tp>());
+
+            return __write(static_cast<const char*>(__buffer.data()), static_cast<std::size_t>(last - __buffer.data()));
+        });
+    }
+
+    // Views the characters of a string-like value; false for other types.
+    constexpr bool _M_viewCharacters(const Type& __ty, std::string_view& __sv) const noexcept
+    {
+        if (__ty.isCharacterPointer())
+        {
+            if (const char* ptr = reference<const char*>(); ptr == nullptr)
+            {
+                __sv = std::string_view();
+            }
+            else if (__ty.isArray())
+            {
+                __sv = std::string_view(ptr, __ty.size() / sizeof(char) - 1);
+            }
+            else
+            {
+                __sv = std::string_view(ptr);
+            }
+        }
+        else if (__ty.isStdString())
+        {
+            __sv = reference<std::string>();
+        }
+        else if (__ty.isStdStringView())
+        {
+            __sv = reference<std::string_view>();
+        }
+        else if (__ty.isStdArray() && __ty.valueType().isCharacter())
+        {
+            __sv = std::string_view(reference<std::array<char, 1>>().data(), __ty.size() / sizeof(char));
+        }
+        else if (__ty.isStdVector() && __ty.valueType().isCharacter())
+        {
+            __sv = std::string_view(reference<std::vector<char>>().data(), elementCount());
+        }
+        else
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    template<typename _Tp>
+    [[nodiscard]] constexpr _Tp _M_getInsertableContainer(const Type& __ty) const noexcept
+    {
+        using type1 = detail::remove_reference_cv_t<detail::container_value_type_t<detail::remove_reference_cv_t<_Tp>>>;
+        using type2 = detail::remove_reference_cv_t<detail::dereferenced_iterator_t<detail::remove_reference_cv_t<_Tp>>>;
+
+        if (Type&& vty = __ty.valueType(); vty.isAnyOf<type1, type2>() ||
+            (detail::is_char_v<type1> && vty.isCharacter()) ||
+            (detail::is_char_pointer_v<_Tp> && vty.isCharacterPointer()) ||
+            (detail::is_std_string_v<_Tp> && vty.isStdString()) ||
+            (detail::is_std_string_view_v<_Tp> && vty.isStdStringView()))
+        {
+            return _M_copyToInsertableContainer<detail::remove_reference_cv_t<_Tp>>();
+        }
+        else
+        {
+            return _M_copyToInsertableContainerWithConversion<detail::remove_reference_cv_t<_Tp>>();
+        }
+    }
+
+    template<typename _Tp>
+    [[nodiscard]] constexpr _Tp _M_getIterableContainer(const Type& __ty) const noexcept
+    {
+        using type1 = detail::remove_reference_cv_t<detail::container_value_type_t<detail::remove_reference_cv_t<_Tp>>>;
+        using type2 = detail::remove_reference_cv_t<detail::dereferenced_iterator_t<detail::remove_reference_cv_t<_Tp>>>;
+
+        if (Type&& vty = __ty.valueType(); vty.isAnyOf<type1, type2>() ||
+            (detail::is_char_v<type1> && vty.isCharacter()) ||
+            (detail::is_char_pointer_v<_Tp> && vty.isCharacterPointer()) ||
+            (detail::is_std_string_v<_Tp> && vty.isStdString()) ||
+            (detail::is_std_string_view_v<_Tp> && vty.isStdStringView()))
+        {
+            return _M_copyToIterableContainer<detail::remove_reference_cv_t<_Tp>>();
+        }
+        else
+        {
+            return _M_copyToIterableContainerWithConversion<detail::remove_reference_cv_t<_Tp>>();
+        }
+    }
+
+    template<typename _Tp>
+    [[nodiscard]] _KWARGS_NON_LITERAL_FUNCTION_CONSTEXPR _Tp _M_beginValue(const Type& __ty) const noexcept
+    {
+        if (Type&& vty = __ty.valueType(); vty.isSameAs<_Tp>() ||
+            (detail::is_char_v<_Tp> && vty.isCharacter()) ||
+            (detail::is_char_pointer_v<_Tp> && vty.isCharacterPointer()) ||
+            (detail::is_std_string_v<_Tp> && vty.isStdString()) ||
+            (detail::is_std_string_view_v<_Tp> && vty.isStdStringView()))
+        {
+            _Tp result{};
+            _M_manager(DoGetBeginValue, detail::as_non_cv(this), &result);
+            return result;
+        }
+        else
+        {
+            KwargsValue result;
+            _M_manager(DoGetBeginAnyValue, detail::as_non_cv(this), &result);
+            return result;
+        }
+    }
+
+    template<typename _Tp>
+    [[nodiscard]] constexpr _Tp _M_copyToInsertableContainer() const noexcept
+    {
+        static_assert(std::negation_v<std::is_reference<_Tp>> && detail::is_insertable_container_v<_Tp>);
+
+        void* _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(iterator);
+        _M_manager(DoGetBeginIterator, detail::as_non_cv(this), &iterator);
+
+        _Tp result{};
+        std::pair<const KwargsValue*, void**> param;
+
+        detail::container_element_type_t<_Tp> element{};
+
+        _M_manager(DoIterate, &(param = std::make_pair(this, &iterator)), &element);
+
+
+        for (; iterator; _M_manager(DoIterate, &(param = std::make_pair(this, &iterator)), &element))
+        {
+#if defined(_MSC_VER)
+#   pragma warning (push)
+#   pragma warning (disable: 26800)  // C26800: Use of a moved from object: 'object'.
+#endif
+            detail::container_insert(result, std::move(element));
+#if defined(_MSC_VER)
+#   pragma warning (pop)
+#endif
+        }
+
+        return result;
+    }
+
+    template<typename _Tp>
+    [[nodiscard]] _KWARGS_NON_LITERAL_FUNCTION_CONSTEXPR _Tp _M_copyToInsertableContainerWithConversion() const noexcept
+    {
+        static_assert(std::negation_v<std::is_reference<_Tp>>&& detail::is_insertable_container_v<_Tp>);
+
+        void* _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(iterator);
+        _M_manager(DoGetBeginIterator, detail::as_non_cv(this), &iterator);
+
+        _Tp result{};
+        std::pair<const KwargsValue*, void**> param;
+
+        KwargsValue element;
+
+        _M_manager(DoIterateAny, &(param = std::make_pair(this, &iterator)), &element);
+
+        for (; iterator; _M_manager(DoIterateAny, &(param = std::make_pair(this, &iterator)), &element))
+        {
+            using type = detail::container_element_type_t<_Tp>;
+
+            detail::container_insert(result, element.value<type>());
+        }
+
+        return result;
+    }
+
+    template<typename _Tp>
+    [[nodiscard]] constexpr _Tp _M_copyToIterableContainer() const noexcept
+    {
+        static_assert(std::negation_v<std::is_reference<_Tp>> && detail::is_iterable_v<_Tp>);
+
+        void* _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(iterator);
+        _M_manager(DoGetBeginIterator, detail::as_non_cv(this), &iterator);
+
+        _Tp result{};
+
+        auto it = detail::container_begin_iterator(result);
+        auto last = detail::container_end_iterator(result);
+
+        std::pair<const KwargsValue*, void**> param;
+
+        detail::container_element_type_t<_Tp> element{};
+
+        _M_manager(DoIterate, &(param = std::make_pair(this, &iterator)), &element);
+
+        for (; iterator; _M_manager(DoIterate, &(param = std::make_pair(this, &iterator)), &element), ++it)
+        {
+            if (it == last)
+            {
+                _M_manager(DoEndIteration, iterator, nullptr);
+                break;
+            }
+
+#if defined(_MSC_VER)
+#   pragma warning (push)
+#   pragma warning (disable: 26800)  // C26800: Use of a moved from object: 'object'.
+#endif
+            *it = std::move(element);
+#if defined(_MSC_VER)
+#   pragma warning (pop)
+#endif
+        }
+
+        return result;
+    }
+
+    template<typename _Tp>
+    [[nodiscard]] _KWARGS_NON_LITERAL_FUNCTION_CONSTEXPR _Tp _M_copyToIterableContainerWithConversion() const noexcept
+    {
+        static_assert(std::negation_v<std::is_reference<_Tp>>&& detail::is_iterable_v<_Tp>);
+
+        void* _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(iterator);
+        _M_manager(DoGetBeginIterator, detail::as_non_cv(this), &iterator);
+
+        _Tp result{};
+
+        auto it = detail::container_begin_iterator(result);
+        auto last = detail::container_end_iterator(result);
+
+        std::pair<const KwargsValue*, void**> param;
+
+        KwargsValue element;
+
+        _M_manager(DoIterateAny, &(param = std::make_pair(this, &iterator)), &element);
+
+        for (; iterator; _M_manager(DoIterateAny, &(param = std::make_pair(this, &iterator)), &element), ++it)
+        {
+            if (it == last)
+            {
+                _M_manager(DoEndIteration, iterator, nullptr);
+                break;
+            }
+
+            using type = detail::container_element_type_t<_Tp>;
+
+            *it = element.value<type>();
+        }
+
+        return result;
+    }
+
+private:
+    
+    union Data
+    {
+        void* _M_ptr = nullptr;
+        
+        std::uintptr_t _M_value;
+
+        std::byte _M_bytes[sizeof(void*)];
+
+    } _M_data;
+
+    void (*_M_manager)(WorkFlags, void*, void*) = &_S_manage<int>;
+
+    friend class KwargsMap;
+};
+
+constexpr void swap(KwargsValue& __left, KwargsValue& __right) noexcept
+{ __left.swap(__right); }
+
+
+class Args
+{
+protected:
+
+    enum WorkFlags : int
+    {
+        DoFree,    /// _M_data , [unused], [unused]
+        DoFind,    /// _M_data , [used]  , KwargsValue**
+        DoGetSize  /// [unused], [unused], std::size_t*
+    };
+
+    template<typename... _Args>
+    static void _S_manage(WorkFlags __work, void* __inData, int __index, void* __outData)
+    {
+        switch (__work)
+        {
+            case DoFree:
+            {
+                auto iptr = reinterpret_cast<std::array<KwargsValue, sizeof...(_Args)>*>(__inData);
+
+                delete iptr;
+                break;
+            }
+
+            case DoFind:
+            {
+                auto iptr = reinterpret_cast<std::array<KwargsValue, sizeof...(_Args)>*>(__inData);
+                auto optr = reinterpret_cast<KwargsValue**>(__outData);
+
+                if (__index >= 0)
+                {
+                    assert(__index < static_cast<decltype(__index)>(sizeof...(_Args)));
+                    *optr = &(*iptr)[static_cast<std::size_t>(__index)];
+                }
+                else
+                {
+                    assert(-__index <= static_cast<decltype(__index)>(sizeof...(_Args)));
+                    *optr = &(*iptr)[sizeof...(_Args) + __index];
+                }
+
+                break;
+            }
+
+            case DoGetSize:
+            {
+                auto optr = reinterpret_cast<std::size_t*>(__outData);
+                *optr = sizeof...(_Args);
+                break;
+            }
+        }
+    }
+
+public:
+
+    constexpr Args() = default;
+
+    template<typename... _Args>
+    Args(_Args&&... __args) noexcept
+        : _M_manager(&Args::_S_manage<_Args...>)
+    {
+        _M_data = new std::array<KwargsValue, sizeof...(_Args)>{{ std::forward<_Args>(__args)... }};
+    }
+
+    _KWARGS_DESTRUCTOR_CONSTEXPR ~Args() noexcept
+    {
+        if (_M_data)
+        {
+            _M_manager(DoFree, _M_data, 0, nullptr);
+        }
+    }
+
+    [[nodiscard]]
+    constexpr std::size_t size() const noexcept
+    {
+        std::size_t _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(result);
+        _M_manager(DoGetSize, nullptr, 0, &result);
+        return result;
+    }
+
+    [[nodiscard]]
+    constexpr KwargsValue& operator[](int __i) noexcept
+    {
+        KwargsValue* _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(result);
+        _M_manager(DoFind, _M_data, __i, &result);
+        return *result;
+    }
+
+    [[nodiscard]]
+    constexpr const KwargsValue& operator[](int __i) const noexcept
+    {
+        KwargsValue* _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(result);
+        _M_manager(DoFind, _M_data, __i, &result);
+        return *result;
+    }
+
+private:
+
+    void* _M_data = nullptr;
+
+    void (*_M_manager)(WorkFlags, void*, int, void*) = &Args::_S_manage<>;
+};
+
+
+/**
+ * @brief In an OptionalList, makes the key after it an alias of the key before it. The Kwargs then
+ *        finds a value passed under any name of such a group by each of them:
+ * @code
+ * void print(Kwargs<"name"_opt, kwargs::alias, "lastname"_opt, kwargs::alias, "surname"_opt, "age"_opt> kwargs);
+ * @endcode
+ */
+inline constexpr KwargsKey::ValueType alias = detail::alias_marker;
+
+/**
+ * @brief In an OptionalList, hides the keys after it and their aliases from lookups and iteration.
+ *        except() on a Kwargs without a slot table returns such a Kwargs, so the view keeps its
+ *        filter in the type rather than at runtime:
+ * @code
+ * void describe_rest(Kwargs<kwargs::without, "size"_opt> kwargs);
+ * describe_rest(kwargs.except<"size"_opt>());
+ * @endcode
+ */
+inline constexpr KwargsKey::ValueType without = detail::without_marker;
+
+namespace detail
+{
+
+/// @brief The keys of an OptionalList, each followed by its aliases, without the markers between them.
+template<string_hash_type... _OptionalList>
+using aliased_key_list_t = typename unmarked_key_list<typename option_list_parts<_OptionalList...>::listed>::type;
+
+/// @brief The keys that an OptionalList hides after kwargs::without.
+template<string_hash_type... _OptionalList>
+using hidden_key_list_t = typename unmarked_key_list<typename option_list_parts<_OptionalList...>::hidden>::type;
+
+/// @brief The groups of the keys that an OptionalList lists before kwargs::without.
+template<string_hash_type... _OptionalList>
+using key_groups_t = key_groups_of_list<typename option_list_parts<_OptionalList...>::listed>;
+
+template<string_hash_type... _OptionalList>
+using kwargs_slot_table_t = typename key_slot_table_of_list<aliased_key_list_t<_OptionalList...>>::type;
+
+}  // namespace detail
+
+
+/// @brief The errors found by the key validation of Kwargs.
+enum class KeyError : std::uint8_t
+{
+    /// A key that is not in the OptionalList.
+    Unknown,
+
+    /// A key that is passed more than once; lookups find its first occurrence.
+    Duplicate
+};
+
+/// @brief Receives the errors found by the key validation of Kwargs and KwargsSchema, see setKeyErrorHandler().
+using KeyErrorHandler = void (*)(KeyError __error, KwargsKey __key);
+
+namespace detail
+{
+
+/// @brief Asserts, so that debug builds stop at a bad key and release builds ignore it.
+inline void default_key_error_handler([[maybe_unused]] KeyError __error, KwargsKey) noexcept
+{
+    assert(__error != KeyError::Unknown && "This key is not in the OptionalList.");
+    assert(__error != KeyError::Duplicate && "This key is passed more than once.");
+}
+
+inline std::atomic<KeyErrorHandler> key_error_handler{ &default_key_error_handler };
+
+inline void report_key_error(KeyError __error, KwargsKey __key) noexcept
+{ key_error_handler.load(std::memory_order_acquire)(__error, __key); }
+
+}  // namespace detail
+
+/**
+ * @brief Sets the handler called for each unknown or duplicate key found by the constructor
+ *        of Kwargs or KwargsSchema, for all threads; nullptr restores the default, which asserts.
+ * 
+ * The keys are checked in one linear pass in debug builds, and in release builds when
+ * KWARGS_VALIDATE_KEYS is defined. The handler must not throw.
+ * 
+ * @return The previous handler.
+ */
+inline KeyErrorHandler setKeyErrorHandler(KeyErrorHandler __handler) noexcept
+{
+    return detail::key_error_handler.exchange(
+        __handler ? __handler : &detail::default_key_error_handler, std::memory_order_acq_rel);
+}
+
+
+/**
+ * @brief The record of one lookup site for Kwargs::cached(): where its key was found last, and
+ *        how often it was found there again.
+ * 
+ * Keep one per call site, usually as a function-local static. The counters are updated without
+ * read-modify-write instructions, so concurrent lookups through one record may lose a few counts.
+ */
+class LookupCache
+{
+public:
+
+    constexpr LookupCache() noexcept = default;
+
+    LookupCache(const LookupCache&) = delete;
+    LookupCache& operator=(const LookupCache&) = delete;
+
+    /// @return The number of lookups that found their key at the remembered position.
+    [[nodiscard]] std::uint64_t hits() const noexcept
+    { return _M_hits.load(std::memory_order_relaxed); }
+
+    /// @return The number of lookups that had to search the list.
+    [[nodiscard]] std::uint64_t misses() const noexcept
+    { return _M_misses.load(std::memory_order_relaxed); }
+
+    void resetCounters() noexcept
+    {
+        _M_hits.store(0, std::memory_order_relaxed);
+        _M_misses.store(0, std::memory_order_relaxed);
+    }
+
+private:
+
+    template<KwargsKey::ValueType...>
+    friend class Kwargs;
+
+    static void _S_count(std::atomic<std::uint64_t>& __counter) noexcept
+    { __counter.store(__counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed); }
+
+    std::atomic<std::size_t> _M_position{ 0 };
+
+    std::atomic<std::uint64_t> _M_hits{ 0 };
+    std::atomic<std::uint64_t> _M_misses{ 0 };
+};
+
+
+template<KwargsKey::ValueType... _OptionalList>
+class Kwargs
+    : private detail::kwargs_slots<detail::kwargs_slot_table_t<_OptionalList...>>
+    , private detail::kwargs_packed_keys<
+        std::is_void_v<detail::kwargs_slot_table_t<_OptionalList...>> ? detail::packed_key_capacity : 0>
+    , private detail::kwargs_key_signature<std::is_void_v<detail::kwargs_slot_table_t<_OptionalList...>>>
+    , private detail::kwargs_key_index<
+        std::is_void_v<detail::kwargs_slot_table_t<_OptionalList...>> && detail::key_index_threshold != 0>
+{
+    // The keys of the OptionalList, each followed by the aliases joined to it with kwargs::alias.
+    using _KeyList = detail::aliased_key_list_t<_OptionalList...>;
+
+    using _Groups = detail::key_groups_t<_OptionalList...>;
+
+    // The keys after kwargs::without, which lookups and iteration skip together with their groups.
+    using _HiddenList = detail::hidden_key_list_t<_OptionalList...>;
+
+    static constexpr bool _S_hides = _HiddenList::hashes.size() != 0;
+
+    // Maps each of those keys to a slot of its own, filled once by the constructor.
+    using _SlotTable = detail::kwargs_slot_table_t<_OptionalList...>;
+
+    static constexpr bool _S_has_slots = std::negation_v<std::is_void<_SlotTable>>;
 
-        Type&& ty = type();
+    // Slots hold 16-bit positions; the slot table of a longer list ignores the pairs after this many.
+    static constexpr std::size_t _S_max_slotted_size = std::numeric_limits<std::uint16_t>::max();
 
-        if (ty.isSameAs<bool>())
-        {
-            return result_type(
-                detail::pointer_cast<
-                    const detail::container_value_type_t<result_type>*>(
-                        static_cast<bool>(_M_data._M_bytes[0]) ? "true" : "false"));
-        }
-        else if (ty.isCharacter())
-        {
-            return result_type(detail::pointer_cast<detail::container_value_type_t<result_type>*>(&_M_data._M_bytes[0]), 1);
-        }
-        else if (ty.isCharacterPointer())
-        {
-            if (ty.isArray())
-            {
-                return result_type(reference<const detail::container_value_type_t<result_type>*>(), ty.size() / sizeof(char) - 1);
-            }
-            else
-            {
-                return result_type(reference<const detail::container_value_type_t<result_type>*>());
-            }
-        }
-        else if (ty.isStdString())
-        {
-            const auto* ptr = pointer<std::basic_string<detail::container_value_type_t<result_type>>>();
-            return result_type(ptr->data(), ptr->size());
-        }
-        else if (ty.isStdStringView())
-        {
-            return reference<result_type>();
-        }
-        else if (Type&& vty = ty.valueType(); ty.isStdVector() && vty.isCharacter())
-        {
-            const auto* ptr = pointer<std::vector<detail::container_value_type_t<result_type>>>();
-            return result_type(ptr->data(), ptr->size());
-        }
-        else if (ty.isStdArray() && vty.isCharacter())
-        {
-            const auto* ptr = pointer<std::array<detail::container_value_type_t<result_type>, 1>>();
-            return result_type(ptr->data(), ty.size() / vty.size());
-        }
+    static constexpr bool _S_aliased = _Groups::markers != 0;
 
-        return result_type(std::forward<_Args>(__args)...);
-    }
+    // The slots of a key and its aliases point to the same value.
+    using _SlotGroups = detail::key_slot_groups<_SlotTable, _KeyList, _Groups>;
 
-    template<typename _Tp, typename... _Args>
-    [[nodiscard]] constexpr auto value(_Args&&... __args) const noexcept
-        -> std::enable_if_t<detail::is_integral_or_enum_v<_Tp> && std::negation_v<std::is_same<detail::remove_reference_cv_t<_Tp>, char>>, std::remove_reference_t<_Tp>>
+    // Otherwise up to this many key hashes are copied into a packed array and scanned with SIMD.
+    static constexpr std::size_t _S_packed_capacity = _S_has_slots ? 0 : detail::packed_key_capacity;
+
+    // A view returned by only() or except(), whose OptionalList ends with the view_marker.
+    static constexpr bool _S_view = detail::option_list_parts<_OptionalList...>::view;
+
+    // The type of the views of a Kwargs with a slot table, which converts back to it.
+    using _ViewType = std::conditional_t<_S_has_slots && _S_view == false, Kwargs<_OptionalList..., detail::view_marker>, Kwargs>;
+
+    // The iteration of a view skips the pairs that its lookups cannot find: unknown, duplicate or hidden ones.
+    static constexpr bool _S_filtered = _S_view || _S_hides;
+
+    class _FilteredIterator;
+
+public:
+
+    using value_type = std::pair<const KwargsKey, KwargsValue>;
+    using container_type = std::initializer_list<value_type>;
+
+    using const_iterator = std::conditional_t<_S_filtered, _FilteredIterator, typename container_type::const_iterator>;
+    using iterator = const_iterator;
+
+    struct DataItem
     {
-        using result_type = std::remove_reference_t<_Tp>;
+        constexpr DataItem(const KwargsValue* __that = nullptr) noexcept
+            : _M_that(__that)
+        { }
 
-        Type&& ty = type();
+        template<typename _ValueType, typename... _Args>
+        [[nodiscard]] constexpr _ValueType valueOr(_Args&&... __args) const noexcept
+        { return _M_that ? _M_that->value<_ValueType>(std::forward<_Args>(__args)...) : _ValueType(std::forward<_Args>(__args)...); }
 
-        if (ty.isIntegralOrEnum())
+        // Converts with __format; the remaining arguments construct the default.
+        template<typename _ValueType, typename... _Args>
+        [[nodiscard]] constexpr _ValueType valueOr(fmt::FloatFormat __format, _Args&&... __args) const noexcept
+        { return _M_that ? _M_that->value<_ValueType>(__format) : _ValueType(std::forward<_Args>(__args)...); }
+
+        // Converts with the unit suffixes in __table; the remaining arguments construct the default.
+        template<typename _ValueType, std::size_t _Size, typename... _Args>
+        [[nodiscard]] constexpr _ValueType valueOr(const unit::SuffixTable<_Size>& __table, _Args&&... __args) const noexcept
+        { return _M_that ? _M_that->value<_ValueType>(__table) : _ValueType(std::forward<_Args>(__args)...); }
+
+        [[nodiscard]] constexpr bool hasValue() const noexcept
+        { return static_cast<bool>(_M_that); }
+
+        [[nodiscard]] constexpr const KwargsValue* operator->() const noexcept
+        { return _M_that; }
+
+        [[nodiscard]] constexpr const KwargsValue& operator*() const noexcept
+        { return *_M_that; }
+
+    private:
+
+        const KwargsValue* _M_that;
+    };
+
+    static_assert(_Groups::well_formed,
+        "cpp-kwargs: kwargs::alias must stand between two keys of the OptionalList.");
+
+    static_assert(_S_has_slots == false || _S_hides == false,
+        "cpp-kwargs: kwargs::without needs an OptionalList without a slot table; except() clears the slots of the others.");
+
+    static_assert(_KeyList::template distinct<false>(),
+        "cpp-kwargs: Two names in the OptionalList or their aliases have the same hash (or a name is listed twice).");
+
+    static_assert(_KeyList::template distinct<true>(),
+        "cpp-kwargs: Two names in the OptionalList or their aliases have the same KwargsKey32.");
+
+    constexpr Kwargs(container_type __list) noexcept
+        : _M_data(__list)
+    {
+        if constexpr (_S_has_slots)
         {
-            if (ty.isSigned())
+            static_assert(_S_view == false, "cpp-kwargs: Views are made by only() and except().");
+
+            assert(__list.size() <= _S_max_slotted_size && "cpp-kwargs: Too many pairs for the slot table.");
+
+            typename Kwargs::slot_type position = 0;
+
+            for (const auto& i : __list)
             {
-                if (ty.size() == sizeof(std::int8_t))
+                if (position == _S_max_slotted_size)
                 {
-                    return static_cast<result_type>(reference<std::int8_t>());
+                    break;
                 }
-                else if (ty.size() == sizeof(std::int16_t)) _KWARGS_ATTRIBUTE_UNLIKELY
+
+                ++position;
+
+                const std::size_t slot = _SlotTable::layout.slot(KwargsKey32(i.first).value());
+
+                if (_SlotTable::keys.hashes[slot] != i.first.value())
                 {
-                    return static_cast<result_type>(reference<std::int16_t>());
+                    if constexpr (detail::validate_keys)
+                    {
+                        detail::report_key_error(KeyError::Unknown, i.first);
+                    }
                 }
-                else if (ty.size() == sizeof(std::int32_t)) _KWARGS_ATTRIBUTE_LIKELY
+                else if (this->_M_slots[slot] == 0)
                 {
-                    return static_cast<result_type>(reference<std::int32_t>());
+                    if constexpr (_SlotGroups::aliased)
+                    {
+                        for (std::size_t s = slot; this->_M_slots[s] == 0; s = _SlotGroups::next[s])
+                        {
+                            this->_M_slots[s] = position;
+                        }
+                    }
+                    else
+                    {
+                        this->_M_slots[slot] = position;
+                    }
                 }
-                else // if (ty.size() == sizeof(std::int64_t))
+                else if constexpr (detail::validate_keys)
                 {
-                    return static_cast<result_type>(reference<std::int64_t>());
+                    detail::report_key_error(KeyError::Duplicate, i.first);
                 }
             }
-            else
-            {
-                return static_cast<result_type>(reference<std::uint64_t>());
-            }
-        }
-        else if (ty.isFloatingPoint())
-        {
-            if (ty.size() == sizeof(float))
-            {
-                return static_cast<result_type>(reference<float>());
-            }
-            else if (ty.size() == sizeof(double))
-            {
-                return static_cast<result_type>(reference<double>());
-            }
-            else // if (ty.size() == sizeof(long double))
-            {
-                return static_cast<result_type>(reference<long double>());
-            }
-        }
-        else if (ty.isCharacterPointer())
-        {
-            if (auto ptr = reference<const char*>(); ptr == nullptr)
-            {
-                return static_cast<result_type>(0);
-            }
-            else if (ty.isArray())
-            {
-                return detail::string_to_integer<result_type>(std::string_view(ptr, ty.size() / sizeof(char) - 1));
-            }
-            else
-            {
-                return detail::string_to_integer<result_type>(ptr);
-            }
-        }
-        else if (ty.isPointer() || ty.isArray())
-        {
-            return static_cast<result_type>(reinterpret_cast<std::uintptr_t>(reference<void*>()));
         }
-        else if (ty.isStdString())
-        {
-            return detail::string_to_integer<result_type>(reference<std::string>());
-        }
-        else if (ty.isStdStringView())
-        {
-            return detail::string_to_integer<result_type>(reference<std::string_view>());
-        }
-        else if (ty.valueType().isCharacter())
+        else
         {
-            if (ty.isStdArray())
+            _M_signKeys();
+
+            if constexpr (_S_packed_capacity != 0)
             {
-                std::string_view sv(reference<std::array<char, 1>>().data(), ty.size() / sizeof(char));
+                if (__list.size() <= _S_packed_capacity)
+                {
+                    std::size_t k = 0;
 
-                return detail::string_to_integer<result_type>(sv);
+                    for (const auto& i : __list)
+                    {
+                        this->_M_keys[k++] = i.first.value();
+                    }
+                }
             }
-            else if (ty.isStdVector())
-            {
-                std::string_view sv(reference<std::vector<char>>().data(), elementCount());
 
-                return detail::string_to_integer<result_type>(sv);
+            if constexpr (detail::validate_keys)
+            {
+                if (detail::is_constant_evaluated() == false)
+                {
+                    _M_validate();
+                }
             }
         }
-
-        return result_type(std::forward<_Args>(__args)...);
     }
 
-    template<typename _Tp, typename... _Args>
-    [[nodiscard]] constexpr auto value(_Args&&... __args) const noexcept
-        -> std::enable_if_t<std::is_floating_point_v<_Tp>, _Tp>
+    /// @brief Passes a view of only() or except() on as a Kwargs of the same keys; lookups still see only its pairs.
+    template<typename _View, std::enable_if_t<std::is_same_v<_View, _ViewType> && std::is_same_v<_View, Kwargs> == false, int> = 0>
+    constexpr Kwargs(const _View& __view) noexcept
+        : Kwargs(detail::kwargs_view_tag(), __view)
+    { }
+
+    /**
+     * @brief A view of the pairs of _Keys and their aliases only, which shares the list of this Kwargs.
+     * @note _Keys need a slot table, which holds what the view shows.
+     * @code
+     * Label(Kwargs<"text"_opt, "font"_opt, "size"_opt> kwargs) : _M_font(kwargs.only<"font"_opt, "size"_opt>()) { }
+     * @endcode
+     */
+    template<KwargsKey::ValueType... _Keys>
+    [[nodiscard]] constexpr Kwargs<_Keys..., detail::view_marker> only() const noexcept
     {
-        using result_type = std::remove_reference_t<_Tp>;
+        static_assert(Kwargs<_Keys...>::_S_has_slots,
+            "cpp-kwargs: only() needs keys with a slot table; use except() or a shorter list.");
 
-        Type&& ty = type();
+        return Kwargs<_Keys..., detail::view_marker>(detail::kwargs_view_tag(), *this);
+    }
 
-        if (ty.isIntegralOrEnum())
+    /**
+     * @brief A view of all pairs but those of _Keys and their aliases, which shares the list of this Kwargs.
+     * @return A view with the slots of this Kwargs but those of _Keys, which converts back to this type,
+     *         or without a slot table, a Kwargs that lists _Keys after kwargs::without.
+     */
+    template<KwargsKey::ValueType... _Keys>
+    [[nodiscard]] constexpr auto except() const noexcept
+    {
+        if constexpr (_S_has_slots)
         {
-            if (ty.isSigned())
+            _ViewType view(detail::kwargs_view_tag(), *this);
+
+            for (KwargsKey::ValueType key : detail::aliased_key_list_t<_Keys...>::hashes)
             {
-                if (ty.size() == sizeof(std::int8_t))
-                {
-                    return static_cast<result_type>(reference<std::int8_t>());
-                }
-                else if (ty.size() == sizeof(std::int16_t)) _KWARGS_ATTRIBUTE_UNLIKELY
-                {
-                    return static_cast<result_type>(reference<std::int16_t>());
-                }
-                else if (ty.size() == sizeof(std::int32_t)) _KWARGS_ATTRIBUTE_LIKELY
+                const std::size_t slot = _SlotTable::layout.slot(detail::string_hash_fold32(key));
+
+                if (_SlotTable::keys.hashes[slot] != key)
                 {
-                    return static_cast<result_type>(reference<std::int32_t>());
+                    continue;
                 }
-                else // if (ty.size() == sizeof(std::int64_t))
+
+                // The slots of a group are cleared together.
+                for (std::size_t s = slot; view._M_slots[s] != 0; s = _SlotGroups::next[s])
                 {
-                    return static_cast<result_type>(reference<std::int64_t>());
+                    view._M_slots[s] = 0;
                 }
             }
-            else
-            {
-                return static_cast<result_type>(reference<std::uint64_t>());
-            }
+
+            return view;
         }
-        else if (ty.isFloatingPoint())
+        else if constexpr (detail::option_list_parts<_OptionalList...>::hides)
         {
-            if (ty.size() == sizeof(float))
-            {
-                return static_cast<result_type>(reference<float>());
-            }
-            else if (ty.size() == sizeof(double))
-            {
-                return static_cast<result_type>(reference<double>());
-            }
-            else // if (ty.size() == sizeof(long double))
-            {
-                return static_cast<result_type>(reference<long double>());
-            }
+            return Kwargs<_OptionalList..., _Keys...>(detail::kwargs_view_tag(), *this);
         }
-        else if (ty.isCharacterPointer())
+        else
         {
-            if (auto ptr = reference<const char*>(); ptr == nullptr)
-            {
-                return static_cast<result_type>(0);
-            }
-            else if (ty.isArray())
-            {
-                return static_cast<result_type>(detail::string_to_floating_point<result_type>(std::string_view(ptr, ty.size() / sizeof(char) - 1)));
-            }
-            else
-            {
-                return static_cast<result_type>(detail::string_to_floating_point<result_type>(ptr));
-            }
+            return Kwargs<_OptionalList..., detail::without_marker, _Keys...>(detail::kwargs_view_tag(), *this);
         }
-        else if (ty.isStdString())
+    }
+
+    [[nodiscard]] constexpr DataItem operator[](KwargsKey __option) noexcept
+    {
+        if constexpr (_S_has_slots)
+        {
+            const std::size_t slot = _SlotTable::layout.slot(KwargsKey32(__option).value());
+            return DataItem(_SlotTable::keys.hashes[slot] == __option.value() ? _M_slotValue(slot) : nullptr);
+        }
+        else if constexpr (_S_aliased)
         {
-            return static_cast<result_type>(detail::string_to_floating_point<long double>(reference<std::string>()));
+            return _M_findInGroup(__option);
         }
-        else if (ty.isStdStringView())
+        else
         {
-            return static_cast<result_type>(detail::string_to_floating_point<long double>(reference<std::string_view>()));
+            return _M_find(__option);
         }
-        else if (ty.isStdArray())
+    }
+
+    /// @note Needs a non-empty OptionalList, whose 32-bit keys are known to be distinct.
+    [[nodiscard]] constexpr DataItem operator[](KwargsKey32 __option) noexcept
+    {
+        static_assert(_KeyList::hashes.size() != 0, "cpp-kwargs: KwargsKey32 needs an OptionalList.");
+
+        if constexpr (_S_has_slots)
         {
-            return static_cast<result_type>(detail::string_to_floating_point<result_type>(std::string_view(reference<std::array<char, 1>>().data(), elementCount())));
+            const std::size_t slot = _SlotTable::layout.slot(__option.value());
+            return DataItem(_SlotTable::keys.hashes32[slot] == __option.value() ? _M_slotValue(slot) : nullptr);
         }
-        else if (ty.isStdVector())
+
+        for (const auto& i : _M_data)
         {
-            return static_cast<result_type>(detail::string_to_floating_point<result_type>(std::string_view(reference<std::vector<char>>().data(), elementCount())));
+            if (KwargsKey32(i.first) == __option && _S_shows(i.first.value()))
+            {
+                return DataItem(&i.second);
+            }
         }
 
-        return result_type(std::forward<_Args>(__args)...);
+        return DataItem(nullptr);
     }
 
-    template<typename _Tp, typename... _Args>
-    [[nodiscard]] constexpr auto value(_Args&&... __args) const noexcept
-        -> std::enable_if_t<detail::is_pointer_v<std::remove_reference_t<_Tp>> && std::negation_v<detail::is_char_pointer<_Tp>>, std::remove_reference_t<_Tp>>
+    /**
+     * @brief Looks up __option at the position where it was found last through __cache first,
+     *        and falls back to operator[] otherwise.
+     * 
+     * A remembered position is only taken when no earlier pair has the key, so that duplicate
+     * keys give the first occurrence, as operator[] does. The earlier keys are only compared
+     * when the constructor saw a key whose signature bits were already set.
+     * @code
+     * static kwargs::LookupCache cache;
+     * int size = kwargs.cached("size", cache).valueOr<int>(9);
+     * @endcode
+     */
+    [[nodiscard]] DataItem cached(KwargsKey __option, LookupCache& __cache) noexcept
     {
-        using result_type = std::remove_reference_t<_Tp>;
+        const std::size_t position = __cache._M_position.load(std::memory_order_relaxed);
 
-        Type&& ty = type();
+        if (position < _M_data.size() && _M_data.begin()[position].first == __option
+            && _M_shows(_M_data.begin()[position]) && _M_isFirstAt(position, __option)) _KWARGS_ATTRIBUTE_LIKELY
+        {
+            LookupCache::_S_count(__cache._M_hits);
+            return DataItem(&_M_data.begin()[position].second);
+        }
 
-        if constexpr (std::is_null_pointer_v<result_type>)
+        LookupCache::_S_count(__cache._M_misses);
+
+        const DataItem item = operator[](__option);
+
+        if (item.hasValue())
         {
-            return static_cast<result_type>(nullptr);
+            // The values are members of one array of pairs.
+            const std::size_t offset = static_cast<std::size_t>(
+                reinterpret_cast<const char*>(item.operator->()) - reinterpret_cast<const char*>(&_M_data.begin()->second));
+
+            __cache._M_position.store(offset / sizeof(value_type), std::memory_order_relaxed);
         }
-        else if (ty.isPointer())
+
+        return item;
+    }
+
+    template<std::size_t _Size>
+    [[nodiscard]] constexpr DataItem operator[](const std::array<KwargsKey, _Size>& __options) noexcept
+    {
+        for (KwargsKey key : __options)
         {
-            return reference<result_type>();
+            if (DataItem item = operator[](key); item.hasValue())
+            {
+                return item;
+            }
         }
-        else if constexpr (std::negation_v<std::is_null_pointer<result_type>>)
+
+        return DataItem(nullptr);
+    }
+
+    /**
+     * @brief Looks up all of _Keys in a single pass over the list.
+     * @return A DataItem for each key, in order, e.g. `auto [size, name] = kwargs.extract<"size"_opt, "name"_opt>();`
+     */
+    template<KwargsKey::value_type... _Keys>
+    [[nodiscard]] constexpr std::tuple<detail::repeat_t<DataItem, _Keys>...> extract() noexcept
+    {
+        using table = typename detail::key_slot_table_of<_Keys...>::type;
+
+        if constexpr (_S_has_slots || std::is_void_v<table>)
         {
-            if (ty.hasData())
+            return std::apply([](auto... __items) constexpr noexcept { return std::make_tuple(__items...); },
+                extract(KwargsKey(_Keys)...));
+        }
+        else
+        {
+            // Each pair is matched against the keys through their own slot table.
+            const KwargsValue* found[table::size] = { };
+
+            for (const auto& i : _M_data)
             {
-                return data<detail::container_value_type_t<result_type>*>();
+                const std::size_t slot = table::layout.slot(KwargsKey32(i.first).value());
+
+                if (table::keys.hashes[slot] == i.first.value() && found[slot] == nullptr && _M_shows(i))
+                {
+                    found[slot] = &i.second;
+                }
             }
-            else
+
+            return { DataItem(found[table::layout.slot(detail::string_hash_fold32(_Keys))])... };
+        }
+    }
+
+    /// @brief Looks up all of __keys in a single pass over the list, for keys known only at runtime.
+    template<typename... _Keys>
+    [[nodiscard]] constexpr std::array<DataItem, sizeof...(_Keys)> extract(const _Keys&... __keys) noexcept
+    {
+        const KwargsKey keys[] = { KwargsKey(__keys)... };
+
+        std::array<DataItem, sizeof...(_Keys)> result{};
+
+        if constexpr (_S_has_slots || _S_aliased)
+        {
+            for (std::size_t k = 0; k < result.size(); ++k)
             {
-                return result_type(std::forward<_Args>(__args)...);
+                result[k] = operator[](keys[k]);
             }
         }
         else
         {
-            return result_type(std::forward<_Args>(__args)...);
+            std::size_t remaining = result.size();
+
+            for (auto it = _M_data.begin(); it != _M_data.end() && remaining; ++it)
+            {
+                for (std::size_t k = 0; k < result.size(); ++k)
+                {
+                    if (keys[k] == it->first && result[k].hasValue() == false && _M_shows(*it))
+                    {
+                        result[k] = DataItem(&it->second);
+                        --remaining;
+                    }
+                }
+            }
         }
+
+        return result;
     }
 
-    template<typename _Tp, typename... _Args>
-    [[nodiscard]] constexpr auto value(_Args&&... __args) const noexcept
-        -> std::enable_if_t<std::conjunction_v<detail::is_tuple_like<_Tp>, std::negation<detail::is_std_array<_Tp>>>, std::remove_reference_t<_Tp>>
+    [[nodiscard]] constexpr const_iterator begin() const noexcept
     {
-        using result_type = std::remove_reference_t<_Tp>;
-
-        Type&& ty = type();
-        
-        if (ty.isSameAs<result_type>())
+        if constexpr (_S_filtered)
         {
-            return reference<result_type>();
+            return const_iterator(this, _M_data.begin());
         }
-        else if constexpr (std::tuple_size_v<result_type> == 2)
+        else
         {
-            return result_type(first<detail::first_of_tuple_t<result_type>>(), second<detail::second_of_tuple_t<result_type>>());
+            return _M_data.begin();
+        }
+    }
+
+    [[nodiscard]] constexpr const_iterator end() const noexcept
+    {
+        if constexpr (_S_filtered)
+        {
+            return const_iterator(this, _M_data.end());
         }
         else
         {
-            return result_type(std::forward<_Args>(__args)...);
+            return _M_data.end();
         }
     }
 
-    template<typename _Tp, typename... _Args>
-    [[nodiscard]] constexpr auto value(_Args&&... __args) const noexcept
-        -> std::enable_if_t<detail::is_unbounded_array_v<_Tp>, std::decay_t<_Tp>>
+    /// @return The number of pairs that iteration visits; a view counts the pairs it shows in one pass.
+    [[nodiscard]] constexpr std::size_t size() const noexcept
     {
-        using result_type = std::decay_t<_Tp>;
+        if constexpr (_S_filtered)
+        {
+            std::size_t count = 0;
 
-        Type&& ty = type();
+            for (const auto& i : _M_data)
+            {
+                count += _M_shows(i);
+            }
 
-        if (ty.isSameAs<std::remove_cv_t<std::decay_t<_Tp>>>() || (ty.isArray() && ty.valueType().isSameAs<std::remove_cv_t<std::remove_extent_t<_Tp>>>()))
-        {
-            return reference<result_type>();
+            return count;
         }
         else
         {
-            return result_type(std::forward<_Args>(__args)...);
+            return _M_data.size();
         }
     }
 
-    template<typename _Tp, typename... _Args>
-    [[nodiscard]] constexpr auto value(_Args&&... __args) const noexcept
-        -> std::enable_if_t<detail::is_bounded_array_v<_Tp>, std::array<std::remove_extent_t<std::remove_reference_t<_Tp>>, std::extent_v<std::remove_reference_t<_Tp>>>>
+protected:
+
+    template<KwargsKey::ValueType _Current>
+    [[nodiscard]] constexpr bool _M_contains(KwargsKey __option) const noexcept
+    { return __option == KwargsKey(_Current); }
+
+    template<KwargsKey::ValueType _Current, KwargsKey::ValueType _Next, KwargsKey::ValueType... _Args>
+    [[nodiscard]] constexpr bool _M_contains(KwargsKey __option) const noexcept
+    { return __option == KwargsKey(_Current) || _M_contains<_Next, _Args...>(__option); }
+
+private:
+
+    template<KwargsKey::ValueType...>
+    friend class Kwargs;
+
+    friend class KwargsMap;
+
+    /// @brief Fills the slots from the pairs that __source shows, or hides the keys of the type without a slot table.
+    template<KwargsKey::ValueType... _Source>
+    constexpr Kwargs(detail::kwargs_view_tag, const Kwargs<_Source...>& __source) noexcept
+        : _M_data(__source._M_data)
     {
-        using result_type = std::array<std::remove_extent_t<std::remove_reference_t<_Tp>>, std::extent_v<std::remove_reference_t<_Tp>>>;
+        if constexpr (std::is_same_v<typename Kwargs<_Source...>::_SlotTable, _SlotTable> && _S_has_slots)
+        {
+            // The same keys, so the slots of __source already hold what it shows.
+            for (std::size_t s = 0; s < _SlotTable::size; ++s)
+            {
+                this->_M_slots[s] = __source._M_slots[s];
+            }
+        }
+        else if constexpr (_S_has_slots)
+        {
+            typename Kwargs::slot_type position = 0;
 
-        return value<result_type>(std::forward<_Args>(__args)...);
+            for (const auto& i : _M_data)
+            {
+                if (position == _S_max_slotted_size)
+                {
+                    break;
+                }
+
+                ++position;
+
+                const std::size_t slot = _SlotTable::layout.slot(KwargsKey32(i.first).value());
+
+                if (_SlotTable::keys.hashes[slot] == i.first.value() && this->_M_slots[slot] == 0 && __source._M_shows(i))
+                {
+                    for (std::size_t s = slot; this->_M_slots[s] == 0; s = _SlotGroups::next[s])
+                    {
+                        this->_M_slots[s] = position;
+                    }
+                }
+            }
+        }
+        else
+        {
+            // Only except() gets here, whose type hides the keys of __source and some more.
+            static_assert(Kwargs<_Source...>::_S_has_slots == false);
+
+            _M_signKeys();
+
+            if constexpr (_S_packed_capacity != 0)
+            {
+                if (_M_data.size() <= _S_packed_capacity)
+                {
+                    std::size_t k = 0;
+
+                    for (const auto& i : _M_data)
+                    {
+                        this->_M_keys[k++] = i.first.value();
+                    }
+                }
+            }
+        }
     }
 
-    template<typename _Tp, typename... _Args>
-    [[nodiscard]] constexpr auto value(_Args&&...) const noexcept
-        -> std::enable_if_t<std::conjunction_v<
-            detail::is_insertable_container<_Tp>,
-            std::negation<std::disjunction<
-                detail::is_std_string<_Tp>,
-                detail::is_std_string_view<_Tp>>>>, std::remove_reference_t<_Tp>>
+    /// @brief Builds the signature of a Kwargs without a slot table.
+    constexpr void _M_signKeys() noexcept
     {
-        using result_type = std::remove_reference_t<_Tp>;
+        for (const auto& i : _M_data)
+        {
+            const std::uint64_t bits = detail::key_signature_bits(i.first.value());
 
-        Type&& ty = type();
+            this->_M_repeats = this->_M_repeats || (this->_M_signature & bits) == bits;
+            this->_M_signature |= bits;
+        }
+    }
 
-        if (ty.isSameAs<result_type>())
+    /// @return Whether a lookup through this Kwargs may return __pair, which a view hides otherwise.
+    [[nodiscard]] constexpr bool _M_shows(const value_type& __pair) const noexcept
+    {
+        if constexpr (_S_has_slots)
         {
-            return reference<result_type>();
+            const std::size_t slot = _SlotTable::layout.slot(KwargsKey32(__pair.first).value());
+            return _SlotTable::keys.hashes[slot] == __pair.first.value()
+                && this->_M_slots[slot] == static_cast<std::size_t>(&__pair - _M_data.begin()) + 1;
         }
         else
         {
-            return _M_getInsertableContainer<result_type>(ty);
+            return _S_shows(__pair.first.value());
         }
     }
 
-    template<typename _Tp, typename... _Args>
-    [[nodiscard]] constexpr auto value(_Args&&...) const noexcept
-        -> std::enable_if_t<std::conjunction_v<
-            detail::is_iterable<_Tp>,
-            std::negation<std::disjunction<
-                std::is_array<std::remove_reference_t<_Tp>>,
-                detail::is_insertable_container<_Tp>,
-                detail::is_std_string<_Tp>,
-                detail::is_std_string_view<_Tp>>>>, std::remove_reference_t<_Tp>>
+    /// @return Whether a Kwargs without a slot table shows __hash, which is neither after kwargs::without
+    ///         nor in a group of this OptionalList with one of those keys.
+    [[nodiscard]] static constexpr bool _S_shows([[maybe_unused]] KwargsKey::ValueType __hash) noexcept
     {
-        using result_type = std::remove_reference_t<_Tp>;
+        if constexpr (_S_hides)
+        {
+            if (_HiddenList::contains(__hash))
+            {
+                return false;
+            }
 
-        Type&& ty = type();
+            if constexpr (_S_aliased)
+            {
+                std::size_t first = 0;
 
-        if (ty.isSameAs<result_type>())
+                for (std::size_t size : _Groups::sizes)
+                {
+                    bool in_group = false, group_hidden = false;
+
+                    for (std::size_t i = first; i < first + size; ++i)
+                    {
+                        in_group = in_group || _KeyList::hashes[i] == __hash;
+                        group_hidden = group_hidden || _HiddenList::contains(_KeyList::hashes[i]);
+                    }
+
+                    if (in_group)
+                    {
+                        return group_hidden == false;
+                    }
+
+                    first += size;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    /// @return The value that a slot refers to, or nullptr if the slot is empty.
+    [[nodiscard]] constexpr const KwargsValue* _M_slotValue(std::size_t __slot) const noexcept
+    {
+        if constexpr (_S_has_slots)
         {
-            return reference<result_type>();
+            return this->_M_slots[__slot] != 0 ? &_M_data.begin()[this->_M_slots[__slot] - 1].second : nullptr;
         }
         else
         {
-            return _M_getIterableContainer<result_type>(ty);
+            return nullptr;
         }
     }
 
-    template<typename _Tp, typename... _Args>
-    [[nodiscard]] constexpr auto value(_Args&&... __args) const noexcept
-        -> std::enable_if_t<
-            std::disjunction_v<
-                std::is_class<std::remove_reference_t<_Tp>>,
-                std::is_union<std::remove_reference_t<_Tp>>> &&
-            std::negation_v<std::disjunction<
-                detail::is_insertable_container<_Tp>,
-                detail::is_iterable<_Tp>,
-                detail::is_tuple_like<_Tp>>>, std::remove_reference_t<_Tp>>
+    /// @brief Looks up __option without a slot table: signature, then packed keys or index, then a scan.
+    [[nodiscard]] constexpr DataItem _M_find(KwargsKey __option) noexcept
     {
-        using result_type = std::remove_reference_t<_Tp>;
+        const std::uint64_t bits = detail::key_signature_bits(__option.value());
 
-        Type&& ty = type();
+        if ((this->_M_signature & bits) != bits)
+        {
+            return DataItem(nullptr);
+        }
 
-        if (ty.isSameAs<result_type>())
+        if (_S_shows(__option.value()) == false)
         {
-            return reference<result_type>();
+            return DataItem(nullptr);
         }
-        else
+
+        if constexpr (_S_packed_capacity != 0)
         {
-            return result_type(std::forward<_Args>(__args)...);
+            if (_M_data.size() <= _S_packed_capacity && detail::is_constant_evaluated() == false)
+            {
+                const std::size_t index = detail::find_packed_key(this->_M_keys, _M_data.size(), __option.value());
+                return DataItem(index != _M_data.size() ? &_M_data.begin()[index].second : nullptr);
+            }
+        }
+
+        if constexpr (detail::key_index_threshold != 0)
+        {
+            if (_M_data.size() > detail::key_index_threshold && detail::is_constant_evaluated() == false)
+            {
+                if (this->_M_index != nullptr || _M_buildIndex())
+                {
+                    return _M_findInIndex(__option);
+                }
+            }
+        }
+
+        for (const auto& i : _M_data)
+        {
+            if (i.first == __option)
+            {
+                return DataItem(&i.second);
+            }
         }
+
+        return DataItem(nullptr);
     }
 
-    constexpr KwargsValue& operator=(const KwargsValue& __other)
+    /**
+     * @brief Whether no pair before __position has the key __option. A slot only points at the first
+     *        pair of its key, and a list whose keys are known to be distinct needs no scan either.
+     */
+    [[nodiscard]] bool _M_isFirstAt([[maybe_unused]] std::size_t __position, [[maybe_unused]] KwargsKey __option) const noexcept
     {
-        if (valueTag() == AppliedFlag)
+        if constexpr (_S_has_slots)
         {
-            _M_manager(DoFree, _M_data._M_ptr, nullptr);
+            return true;
         }
-
-        if (__other.valueTag() == AppliedFlag)
+        else if (this->_M_repeats == false) _KWARGS_ATTRIBUTE_LIKELY
         {
-            __other._M_manager(DoApplyAndCopy, __other._M_data._M_ptr, &_M_data._M_ptr);
+            return true;
         }
-        else
+
+        if constexpr (_S_packed_capacity != 0)
         {
-            _M_data._M_value = __other._M_data._M_value;
+            if (_M_data.size() <= _S_packed_capacity)
+            {
+                return detail::find_packed_key(this->_M_keys, __position, __option.value()) == __position;
+            }
         }
 
-        _M_manager = __other._M_manager;
+        for (std::size_t i = 0; i < __position; ++i)
+        {
+            if (_M_data.begin()[i].first == __option)
+            {
+                return false;
+            }
+        }
 
-        return *this;
+        return true;
     }
 
-    constexpr KwargsValue& operator=(KwargsValue&& __other) noexcept
+    /// @brief Without a slot table, a key with aliases is looked up by each key of its group in turn.
+    [[nodiscard]] constexpr DataItem _M_findInGroup(KwargsKey __option) noexcept
     {
-        if (valueTag() == AppliedFlag)
+        std::size_t first = 0;
+
+        for (std::size_t size : _Groups::sizes)
         {
-            _M_manager(DoFree, _M_data._M_ptr, nullptr);
-        }
+            for (std::size_t i = first; i < first + size; ++i)
+            {
+                if (_KeyList::hashes[i] == __option.value())
+                {
+                    for (std::size_t j = first; j < first + size; ++j)
+                    {
+                        if (DataItem item = _M_find(KwargsKey(_KeyList::hashes[j])); item.hasValue())
+                        {
+                            return item;
+                        }
+                    }
 
-        _M_data._M_value = __other._M_data._M_value;
+                    return DataItem(nullptr);
+                }
+            }
 
-        _M_manager = detail::exchange(__other._M_manager, &KwargsValue::_S_manage<int>);
+            first += size;
+        }
 
-        return *this;
+        return _M_find(__option);
     }
 
-    constexpr void swap(KwargsValue& __other) noexcept
-    { detail::bit_swap(*this, __other); }
-
-    [[nodiscard]] constexpr bool operator==(const KwargsValue& __other) const noexcept
+    /**
+     * @brief Reports unknown and duplicate keys of a Kwargs without a slot table in one pass.
+     * @note A list longer than key_validation_stack_size needs a set on the heap, or the index when it
+     *       is longer than KWARGS_KEY_INDEX_THRESHOLD, which is then built at once. Only when that
+     *       allocation fails are the pairs compared with each other, in O(n^2) time.
+     */
+    void _M_validate() noexcept
     {
-        bool _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(result);
+        if constexpr (_KeyList::hashes.size() != 0)
+        {
+            for (const auto& i : _M_data)
+            {
+                if (_KeyList::contains(i.first.value()) == false)
+                {
+                    detail::report_key_error(KeyError::Unknown, i.first);
+                }
+            }
+        }
 
-        auto in_data = std::make_pair(this, &__other);
-        _M_manager(DoCompareEqual, &in_data, &result);
+        if (_M_data.size() < 2)
+        {
+            return;
+        }
 
-        return result;
-    }
+        // A list that is indexed anyway is indexed now.
+        if constexpr (detail::key_index_threshold != 0)
+        {
+            if (_M_data.size() > detail::key_index_threshold && _M_buildIndex(true))
+            {
+                return;
+            }
+        }
 
-    template<typename _Tp>
-    [[nodiscard]] constexpr bool operator==(const _Tp& __other) const noexcept
-    { return value<_Tp>() == __other; }
+        const std::size_t mask = detail::key_index_capacity(_M_data.size()) - 1;
 
-protected:
+        if (_M_data.size() <= detail::key_validation_stack_size)
+        {
+            std::uint32_t set[detail::key_index_capacity(detail::key_validation_stack_size)];
 
-    template<typename _Tp>
-    [[nodiscard]] constexpr _Tp _M_getInsertableContainer(const Type& __ty) const noexcept
-    {
-        using type1 = detail::remove_reference_cv_t<detail::container_value_type_t<detail::remove_reference_cv_t<_Tp>>>;
-        using type2 = detail::remove_reference_cv_t<detail::dereferenced_iterator_t<detail::remove_reference_cv_t<_Tp>>>;
+            for (std::size_t i = 0; i <= mask; ++i)
+            {
+                set[i] = 0;
+            }
 
-        if (Type&& vty = __ty.valueType(); vty.isAnyOf<type1, type2>() ||
-            (detail::is_char_v<type1> && vty.isCharacter()) ||
-            (detail::is_char_pointer_v<_Tp> && vty.isCharacterPointer()) ||
-            (detail::is_std_string_v<_Tp> && vty.isStdString()) ||
-            (detail::is_std_string_view_v<_Tp> && vty.isStdStringView()))
+            this->_M_repeats = _M_indexKeys(set, mask, true);
+        }
+        else if (std::unique_ptr<std::uint32_t[]> set(new (std::nothrow) std::uint32_t[mask + 1]()); set != nullptr)
         {
-            return _M_copyToInsertableContainer<detail::remove_reference_cv_t<_Tp>>();
+            this->_M_repeats = _M_indexKeys(set.get(), mask, true);
         }
         else
         {
-            return _M_copyToInsertableContainerWithConversion<detail::remove_reference_cv_t<_Tp>>();
+            this->_M_repeats = false;
+
+            for (auto i = _M_data.begin() + 1; i != _M_data.end(); ++i)
+            {
+                for (auto j = _M_data.begin(); j != i; ++j)
+                {
+                    if (j->first == i->first)
+                    {
+                        detail::report_key_error(KeyError::Duplicate, i->first);
+                        this->_M_repeats = true;
+                        break;
+                    }
+                }
+            }
         }
     }
 
-    template<typename _Tp>
-    [[nodiscard]] constexpr _Tp _M_getIterableContainer(const Type& __ty) const noexcept
+    /// @return Whether the index could be allocated.
+    bool _M_buildIndex(bool __report = false) noexcept
     {
-        using type1 = detail::remove_reference_cv_t<detail::container_value_type_t<detail::remove_reference_cv_t<_Tp>>>;
-        using type2 = detail::remove_reference_cv_t<detail::dereferenced_iterator_t<detail::remove_reference_cv_t<_Tp>>>;
+        const std::size_t mask = detail::key_index_capacity(_M_data.size()) - 1;
 
-        if (Type&& vty = __ty.valueType(); vty.isAnyOf<type1, type2>() ||
-            (detail::is_char_v<type1> && vty.isCharacter()) ||
-            (detail::is_char_pointer_v<_Tp> && vty.isCharacterPointer()) ||
-            (detail::is_std_string_v<_Tp> && vty.isStdString()) ||
-            (detail::is_std_string_view_v<_Tp> && vty.isStdStringView()))
-        {
-            return _M_copyToIterableContainer<detail::remove_reference_cv_t<_Tp>>();
-        }
-        else
+        this->_M_index = new (std::nothrow) std::uint32_t[mask + 1]();
+
+        if (this->_M_index == nullptr)
         {
-            return _M_copyToIterableContainerWithConversion<detail::remove_reference_cv_t<_Tp>>();
+            return false;
         }
+
+        this->_M_repeats = _M_indexKeys(this->_M_index, mask, __report);
+        return true;
     }
 
-    template<typename _Tp>
-    [[nodiscard]] _KWARGS_NON_LITERAL_FUNCTION_CONSTEXPR _Tp _M_beginValue(const Type& __ty) const noexcept
+    /**
+     * @brief Maps the slots of __index to positions in the list plus one, reporting duplicates if __report.
+     * @return Whether a key is passed more than once.
+     */
+    bool _M_indexKeys(std::uint32_t* __index, std::size_t __mask, bool __report) const noexcept
     {
-        if (Type&& vty = __ty.valueType(); vty.isSameAs<_Tp>() ||
-            (detail::is_char_v<_Tp> && vty.isCharacter()) ||
-            (detail::is_char_pointer_v<_Tp> && vty.isCharacterPointer()) ||
-            (detail::is_std_string_v<_Tp> && vty.isStdString()) ||
-            (detail::is_std_string_view_v<_Tp> && vty.isStdStringView()))
+        std::uint32_t position = 0;
+
+        bool repeats = false;
+
+        for (const auto& i : _M_data)
         {
-            _Tp result{};
-            _M_manager(DoGetBeginValue, detail::as_non_cv(this), &result);
-            return result;
+            ++position;
+
+            for (std::size_t slot = detail::key_index_slot(i.first.value(), __mask); ; slot = (slot + 1) & __mask)
+            {
+                if (__index[slot] == 0)
+                {
+                    __index[slot] = position;
+                    break;
+                }
+                // The first of duplicate keys is found, as by the scan.
+                else if (_M_data.begin()[__index[slot] - 1].first == i.first)
+                {
+                    if (__report)
+                    {
+                        detail::report_key_error(KeyError::Duplicate, i.first);
+                    }
+
+                    repeats = true;
+                    break;
+                }
+            }
         }
-        else
+
+        return repeats;
+    }
+
+    [[nodiscard]] DataItem _M_findInIndex(KwargsKey __option) const noexcept
+    {
+        const std::size_t mask = detail::key_index_capacity(_M_data.size()) - 1;
+
+        for (std::size_t slot = detail::key_index_slot(__option.value(), mask); this->_M_index[slot] != 0; slot = (slot + 1) & mask)
         {
-            KwargsValue result;
-            _M_manager(DoGetBeginAnyValue, detail::as_non_cv(this), &result);
-            return result;
+            const value_type& pair = _M_data.begin()[this->_M_index[slot] - 1];
+
+            if (pair.first == __option)
+            {
+                return DataItem(&pair.second);
+            }
         }
+
+        return DataItem(nullptr);
     }
 
-    template<typename _Tp>
-    [[nodiscard]] constexpr _Tp _M_copyToInsertableContainer() const noexcept
+    /// @brief Visits the pairs of a view that its lookups can find, see _M_shows().
+    class _FilteredIterator
     {
-        static_assert(std::negation_v<std::is_reference<_Tp>> && detail::is_insertable_container_v<_Tp>);
-
-        void* _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(iterator);
-        _M_manager(DoGetBeginIterator, detail::as_non_cv(this), &iterator);
+    public:
 
-        _Tp result{};
-        std::pair<const KwargsValue*, void**> param;
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename Kwargs::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = const value_type&;
 
-        std::conditional_t<
-            std::is_default_constructible_v<detail::remove_reference_cv_t<detail::dereferenced_iterator_t<_Tp>>>,
-            detail::remove_reference_cv_t<detail::dereferenced_iterator_t<_Tp>>,
-            detail::remove_reference_cv_t<detail::container_value_type_t<detail::remove_reference_cv_t<_Tp>>>
-        > element{};
+        constexpr _FilteredIterator() noexcept = default;
 
-        _M_manager(DoIterate, &(param = std::make_pair(this, &iterator)), &element);
+        [[nodiscard]] constexpr reference operator*() const noexcept
+        { return *_M_current; }
 
+        [[nodiscard]] constexpr pointer operator->() const noexcept
+        { return _M_current; }
 
-        for (; iterator; _M_manager(DoIterate, &(param = std::make_pair(this, &iterator)), &element))
+        constexpr _FilteredIterator& operator++() noexcept
         {
-#if defined(_MSC_VER)
-#   pragma warning (push)
-#   pragma warning (disable: 26800)  // C26800: Use of a moved from object: 'object'.
-#endif
-            detail::container_insert(result, std::move(element));
-#if defined(_MSC_VER)
-#   pragma warning (pop)
-#endif
+            ++_M_current;
+            _M_skip();
+            return *this;
         }
 
-        return result;
-    }
+        constexpr _FilteredIterator operator++(int) noexcept
+        {
+            _FilteredIterator result = *this;
+            ++*this;
+            return result;
+        }
 
-    template<typename _Tp>
-    [[nodiscard]] _KWARGS_NON_LITERAL_FUNCTION_CONSTEXPR _Tp _M_copyToInsertableContainerWithConversion() const noexcept
-    {
-        static_assert(std::negation_v<std::is_reference<_Tp>>&& detail::is_insertable_container_v<_Tp>);
+        [[nodiscard]] constexpr bool operator==(const _FilteredIterator& __other) const noexcept
+        { return _M_current == __other._M_current; }
 
-        void* _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(iterator);
-        _M_manager(DoGetBeginIterator, detail::as_non_cv(this), &iterator);
+        [[nodiscard]] constexpr bool operator!=(const _FilteredIterator& __other) const noexcept
+        { return _M_current != __other._M_current; }
 
-        _Tp result{};
-        std::pair<const KwargsValue*, void**> param;
+    private:
 
-        KwargsValue element;
+        friend class Kwargs;
 
-        _M_manager(DoIterateAny, &(param = std::make_pair(this, &iterator)), &element);
+        constexpr _FilteredIterator(const Kwargs* __owner, pointer __current) noexcept
+            : _M_owner(__owner), _M_current(__current)
+        { _M_skip(); }
 
-        for (; iterator; _M_manager(DoIterateAny, &(param = std::make_pair(this, &iterator)), &element))
+        constexpr void _M_skip() noexcept
         {
-            using type = std::conditional_t<
-                std::is_default_constructible_v<detail::remove_reference_cv_t<detail::dereferenced_iterator_t<_Tp>>>,
-                detail::remove_reference_cv_t<detail::dereferenced_iterator_t<_Tp>>,
-                detail::remove_reference_cv_t<detail::container_value_type_t<detail::remove_reference_cv_t<_Tp>>>>;
-
-            detail::container_insert(result, element.value<type>());
+            for (; _M_current != _M_owner->_M_data.end() && _M_owner->_M_shows(*_M_current) == false; ++_M_current);
         }
 
-        return result;
-    }
+        const Kwargs* _M_owner = nullptr;
 
-    template<typename _Tp>
-    [[nodiscard]] constexpr _Tp _M_copyToIterableContainer() const noexcept
-    {
-        static_assert(std::negation_v<std::is_reference<_Tp>> && detail::is_iterable_v<_Tp>);
+        pointer _M_current = nullptr;
+    };
 
-        void* _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(iterator);
-        _M_manager(DoGetBeginIterator, detail::as_non_cv(this), &iterator);
+private:
 
-        _Tp result{};
+    container_type _M_data;
+};
 
-        auto it = detail::container_begin_iterator(result);
-        auto last = detail::container_end_iterator(result);
 
-        std::pair<const KwargsValue*, void**> param;
+/**
+ * @brief Declares a key of KwargsSchema, the type its value converts to and an optional default.
+ * @note Before C++20 the default must be an integral, enumeration or pointer constant.
+ */
+template<KwargsKey::ValueType _Key, typename _Tp, auto... _Default>
+struct Param
+{
+    static_assert(sizeof...(_Default) <= 1, "cpp-kwargs: A Param has at most one default.");
 
-        std::conditional_t<
-            std::is_default_constructible_v<detail::remove_reference_cv_t<detail::dereferenced_iterator_t<_Tp>>>,
-            detail::remove_reference_cv_t<detail::dereferenced_iterator_t<_Tp>>,
-            detail::remove_reference_cv_t<detail::container_value_type_t<detail::remove_reference_cv_t<_Tp>>>
-        > element{};
+    static constexpr KwargsKey::value_type key = _Key;
 
-        _M_manager(DoIterate, &(param = std::make_pair(this, &iterator)), &element);
+    using value_type = _Tp;
 
-        for (; iterator; _M_manager(DoIterate, &(param = std::make_pair(this, &iterator)), &element), ++it)
+    // Built for each missing key, so that no static object has to be initialized first.
+    [[nodiscard]] static value_type default_value() noexcept(std::is_nothrow_constructible_v<value_type, decltype(_Default)...>)
+    { return value_type(_Default...); }
+};
+
+/**
+ * @brief A Kwargs whose values are converted to the types of their Params once, on construction.
+ * 
+ * Every pair is matched to its Param through the compile-time slot table and converted to that
+ * type only; missing keys keep the default of their Param.
+ */
+template<typename... _Params>
+class KwargsSchema
+{
+public:
+
+    using container_type = typename Kwargs<>::container_type;
+    using tuple_type = std::tuple<typename _Params::value_type...>;
+
+    static_assert(sizeof...(_Params) != 0, "cpp-kwargs: A KwargsSchema needs at least one Param.");
+
+    static_assert(detail::string_hashes_distinct<false, _Params::key...>(),
+        "cpp-kwargs: Two Params of the KwargsSchema have the same key hash.");
+
+    /**
+     * @note Of duplicate keys the first is kept, as Kwargs finds it. Building a default or converting
+     *       a value to the type of its Param may throw, e.g. std::bad_alloc for std::string.
+     */
+    KwargsSchema(container_type __list = { })
+        : _M_values(_Params::default_value()...)
+    {
+        // One bit for each Param that has been assigned.
+        std::uint64_t assigned[(sizeof...(_Params) + 63) / 64] = { };
+
+        for (const auto& i : __list)
         {
-            if (it == last)
+            const std::size_t index = _S_index_of(i.first);
+
+            if (index == sizeof...(_Params))
             {
-                _M_manager(DoEndIteration, iterator, nullptr);
-                break;
+                if constexpr (detail::validate_keys)
+                {
+                    detail::report_key_error(KeyError::Unknown, i.first);
+                }
+            }
+            else if (const std::uint64_t bit = std::uint64_t(1) << (index % 64); (assigned[index / 64] & bit) == 0)
+            {
+                assigned[index / 64] |= bit;
+                _M_assign(index, i.second, std::index_sequence_for<_Params...>());
+            }
+            else if constexpr (detail::validate_keys)
+            {
+                detail::report_key_error(KeyError::Duplicate, i.first);
             }
-
-#if defined(_MSC_VER)
-#   pragma warning (push)
-#   pragma warning (disable: 26800)  // C26800: Use of a moved from object: 'object'.
-#endif
-            *it = std::move(element);
-#if defined(_MSC_VER)
-#   pragma warning (pop)
-#endif
         }
-
-        return result;
     }
 
-    template<typename _Tp>
-    [[nodiscard]] _KWARGS_NON_LITERAL_FUNCTION_CONSTEXPR _Tp _M_copyToIterableContainerWithConversion() const noexcept
+    /// @return The converted value of _Key, or its default.
+    template<KwargsKey::ValueType _Key>
+    [[nodiscard]] constexpr const auto& get() const noexcept
     {
-        static_assert(std::negation_v<std::is_reference<_Tp>>&& detail::is_iterable_v<_Tp>);
+        constexpr std::size_t index = _S_index_of(KwargsKey(_Key));
+        static_assert(index != sizeof...(_Params), "cpp-kwargs: This key is not in the KwargsSchema.");
 
-        void* _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(iterator);
-        _M_manager(DoGetBeginIterator, detail::as_non_cv(this), &iterator);
+        return std::get<index>(_M_values);
+    }
 
-        _Tp result{};
+    /// @return All values in the order of the Params, e.g. for structured bindings.
+    [[nodiscard]] constexpr const tuple_type& values() const noexcept
+    { return _M_values; }
 
-        auto it = detail::container_begin_iterator(result);
-        auto last = detail::container_end_iterator(result);
+    /// @return A _Struct aggregate-initialized with all values in the order of the Params.
+    template<typename _Struct>
+    [[nodiscard]] constexpr _Struct as() const
+    { return std::apply([](const auto&... __values) -> _Struct { return _Struct{ __values... }; }, _M_values); }
+
+private:
+
+    using _SlotTable = typename detail::key_slot_table_of<_Params::key...>::type;
+
+    /// @return The index of the Param of __key, or the number of Params.
+    [[nodiscard]] static constexpr std::size_t _S_index_of(KwargsKey __key) noexcept
+    {
+        constexpr KwargsKey::value_type keys[] = { _Params::key... };
+
+        if constexpr (std::negation_v<std::is_void<_SlotTable>>)
+        {
+            constexpr auto indexes = []() constexpr noexcept -> std::array<std::size_t, _SlotTable::size>
+            {
+                std::array<std::size_t, _SlotTable::size> result{};
 
-        std::pair<const KwargsValue*, void**> param;
+                for (std::size_t i = 0; i < result.size(); ++i)
+                {
+                    result[i] = sizeof...(_Params);
+                }
 
-        KwargsValue element;
+                for (std::size_t i = 0; i < sizeof...(_Params); ++i)
+                {
+                    result[_SlotTable::layout.slot(detail::string_hash_fold32(keys[i]))] = i;
+                }
 
-        _M_manager(DoIterateAny, &(param = std::make_pair(this, &iterator)), &element);
+                return result;
+            }();
 
-        for (; iterator; _M_manager(DoIterateAny, &(param = std::make_pair(this, &iterator)), &element), ++it)
+            const std::size_t slot = _SlotTable::layout.slot(KwargsKey32(__key).value());
+
+            return _SlotTable::keys.hashes[slot] == __key.value() ? indexes[slot] : sizeof...(_Params);
+        }
+        else
         {
-            if (it == last)
-            {
-                _M_manager(DoEndIteration, iterator, nullptr);
-                break;
-            }
+            std::size_t i = 0;
 
-            using type = std::conditional_t<
-                std::is_default_constructible_v<detail::remove_reference_cv_t<detail::dereferenced_iterator_t<_Tp>>>,
-                detail::remove_reference_cv_t<detail::dereferenced_iterator_t<_Tp>>,
-                detail::remove_reference_cv_t<detail::container_value_type_t<detail::remove_reference_cv_t<_Tp>>>>;
+            for (; i < sizeof...(_Params) && keys[i] != __key.value(); ++i);
 
-            *it = element.value<type>();
+            return i;
         }
+    }
 
-        return result;
+    template<std::size_t... _Indexes>
+    void _M_assign(std::size_t __index, const KwargsValue& __value, std::index_sequence<_Indexes...>)
+    {
+        (void)((__index == _Indexes
+            && (std::get<_Indexes>(_M_values) = __value.value<std::tuple_element_t<_Indexes, tuple_type>>(), true)) || ...);
     }
 
 private:
-    
-    union Data
-    {
-        void* _M_ptr = nullptr;
-        
-        std::uintptr_t _M_value;
 
-        std::byte _M_bytes[sizeof(void*)];
+    tuple_type _M_values;
+};
 
-    } _M_data;
 
-    void (*_M_manager)(WorkFlags, void*, void*) = &_S_manage<int>;
-};
+/**
+ * @brief An owning map of keys to values, for options that are built once and looked up often.
+ * 
+ * The pairs, their open-addressing index and copies of the objects the values hold or refer to
+ * share a single allocation, so a KwargsMap outlives the call it was built from. Values that
+ * hold pointers still point to the same objects, and objects that cannot be copied, or need more
+ * than the alignment of std::max_align_t, are kept as KwargsValue keeps them.
+ * 
+ * @code
+ * kwargs::KwargsMap options = kwargs;   // or { { "size", 18 }, { "name", "huanhuanonly" } }
+ * int size = options["size"].valueOr<int>(9);
+ * @endcode
+ */
+class KwargsMap
+{
+public:
 
-constexpr void swap(KwargsValue& __left, KwargsValue& __right) noexcept
-{ __left.swap(__right); }
+    using value_type = Kwargs<>::value_type;
 
+    using iterator = const value_type*;
+    using const_iterator = const value_type*;
 
-class Args
-{
-protected:
+    using DataItem = Kwargs<>::DataItem;
 
-    enum WorkFlags : int
+    KwargsMap() noexcept = default;
+
+    /// @note Of duplicate keys the first is kept, as Kwargs finds it.
+    KwargsMap(Kwargs<>::container_type __list)
+    { _M_assign(__list.begin(), __list.end(), &KwargsMap::_S_showsAll); }
+
+    /// @note Only the pairs that lookups through __kwargs may find are copied, so views are frozen as they are seen.
+    template<KwargsKey::ValueType... _OptionalList>
+    KwargsMap(const Kwargs<_OptionalList...>& __kwargs)
     {
-        DoFree,    /// _M_data , [unused], [unused]
-        DoFind,    /// _M_data , [used]  , KwargsValue**
-        DoGetSize  /// [unused], [unused], std::size_t*
-    };
+        _M_assign(__kwargs._M_data.begin(), __kwargs._M_data.end(),
+            [&__kwargs](const value_type& __pair) noexcept -> bool { return __kwargs._M_shows(__pair); });
+    }
 
-    template<typename... _Args>
-    static void _S_manage(WorkFlags __work, void* __inData, int __index, void* __outData)
+    KwargsMap(const KwargsMap& __other)
+    { _M_assign(__other.begin(), __other.end(), &KwargsMap::_S_showsAll); }
+
+    KwargsMap(KwargsMap&& __other) noexcept
+        : _M_block(detail::exchange(__other._M_block, nullptr))
+        , _M_size(detail::exchange(__other._M_size, std::size_t(0)))
+        , _M_capacity(detail::exchange(__other._M_capacity, std::size_t(0)))
+        , _M_payloadSize(detail::exchange(__other._M_payloadSize, std::size_t(0)))
+        , _M_payloadCapacity(detail::exchange(__other._M_payloadCapacity, std::size_t(0)))
+    { }
+
+    KwargsMap& operator=(const KwargsMap& __other)
     {
-        switch (__work)
+        if (this != &__other)
         {
-            case DoFree:
-            {
-                auto iptr = reinterpret_cast<std::array<KwargsValue, sizeof...(_Args)>*>(__inData);
+            KwargsMap(__other).swap(*this);
+        }
 
-                delete iptr;
-                break;
-            }
+        return *this;
+    }
 
-            case DoFind:
-            {
-                auto iptr = reinterpret_cast<std::array<KwargsValue, sizeof...(_Args)>*>(__inData);
-                auto optr = reinterpret_cast<KwargsValue**>(__outData);
+    KwargsMap& operator=(KwargsMap&& __other) noexcept
+    {
+        KwargsMap(std::move(__other)).swap(*this);
+        return *this;
+    }
 
-                if (__index >= 0)
-                {
-                    assert(__index < static_cast<decltype(__index)>(sizeof...(_Args)));
-                    *optr = &(*iptr)[static_cast<std::size_t>(__index)];
-                }
-                else
-                {
-                    assert(-__index <= static_cast<decltype(__index)>(sizeof...(_Args)));
-                    *optr = &(*iptr)[sizeof...(_Args) + __index];
-                }
+    ~KwargsMap() noexcept
+    { _M_destroy(); }
 
-                break;
-            }
+    void swap(KwargsMap& __other) noexcept
+    {
+        std::swap(_M_block, __other._M_block);
+        std::swap(_M_size, __other._M_size);
+        std::swap(_M_capacity, __other._M_capacity);
+        std::swap(_M_payloadSize, __other._M_payloadSize);
+        std::swap(_M_payloadCapacity, __other._M_payloadCapacity);
+    }
 
-            case DoGetSize:
+    /**
+     * @brief Adds a copy of __value under __key unless the key is present.
+     * @return Whether it was added. A full map moves to a block twice as large.
+     */
+    bool insert(KwargsKey __key, const KwargsValue& __value)
+    {
+        if (contains(__key))
+        {
+            return false;
+        }
+
+        if (_M_size == _M_capacity || _M_payloadSize + _S_payloadBound(__value) > _M_payloadCapacity)
+        {
+            KwargsMap larger;
+
+            larger._M_allocate(
+                std::max(_M_capacity * 2, std::size_t(4)),
+                std::max(_M_payloadCapacity * 2, _M_payloadSize + _S_payloadBound(__value)));
+
+            for (const auto& i : *this)
             {
-                auto optr = reinterpret_cast<std::size_t*>(__outData);
-                *optr = sizeof...(_Args);
-                break;
+                larger._M_append(i.first, i.second);
             }
+
+            // __value may live in the old block, so it is copied before that block goes away.
+            larger._M_append(__key, __value);
+            larger.swap(*this);
+            return true;
         }
+
+        _M_append(__key, __value);
+        return true;
     }
 
-public:
+    [[nodiscard]] DataItem operator[](KwargsKey __key) const noexcept
+    {
+        if (_M_size == 0)
+        {
+            return DataItem(nullptr);
+        }
 
-    constexpr Args() = default;
+        const std::size_t mask = _S_slotCount(_M_capacity) - 1;
 
-    template<typename... _Args>
-    Args(_Args&&... __args) noexcept
-        : _M_manager(&Args::_S_manage<_Args...>)
-    {
-        _M_data = new std::array<KwargsValue, sizeof...(_Args)>{{ std::forward<_Args>(__args)... }};
+        for (std::size_t slot = detail::key_index_slot(__key.value(), mask); _M_slots()[slot] != 0; slot = (slot + 1) & mask)
+        {
+            const value_type& pair = _M_pairs()[_M_slots()[slot] - 1];
+
+            if (pair.first == __key)
+            {
+                return DataItem(&pair.second);
+            }
+        }
+
+        return DataItem(nullptr);
     }
 
-    _KWARGS_DESTRUCTOR_CONSTEXPR ~Args() noexcept
+    template<std::size_t _Size>
+    [[nodiscard]] DataItem operator[](const std::array<KwargsKey, _Size>& __keys) const noexcept
     {
-        if (_M_data)
+        for (KwargsKey key : __keys)
         {
-            _M_manager(DoFree, _M_data, 0, nullptr);
+            if (DataItem item = operator[](key); item.hasValue())
+            {
+                return item;
+            }
         }
-    }
 
-    [[nodiscard]]
-    constexpr std::size_t size() const noexcept
-    {
-        std::size_t _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(result);
-        _M_manager(DoGetSize, nullptr, 0, &result);
-        return result;
+        return DataItem(nullptr);
     }
 
-    [[nodiscard]]
-    constexpr KwargsValue& operator[](int __i) noexcept
-    {
-        KwargsValue* _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(result);
-        _M_manager(DoFind, _M_data, __i, &result);
-        return *result;
-    }
+    [[nodiscard]] bool contains(KwargsKey __key) const noexcept
+    { return operator[](__key).hasValue(); }
 
-    [[nodiscard]]
-    constexpr const KwargsValue& operator[](int __i) const noexcept
-    {
-        KwargsValue* _KWARGS_VARIABLE_OPTIONAL_INITIALIZATION_CONSTEXPR(result);
-        _M_manager(DoFind, _M_data, __i, &result);
-        return *result;
-    }
+    /// @brief The pairs in the order they were added.
+    [[nodiscard]] const_iterator begin() const noexcept
+    { return _M_pairs(); }
+
+    [[nodiscard]] const_iterator end() const noexcept
+    { return _M_pairs() + _M_size; }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    { return _M_size; }
+
+    [[nodiscard]] bool empty() const noexcept
+    { return _M_size == 0; }
 
 private:
 
-    void* _M_data = nullptr;
+    // The block holds the pairs, then the index of their positions plus one, then the payloads.
+    static constexpr std::size_t _S_payloadAlignment = alignof(std::max_align_t);
 
-    void (*_M_manager)(WorkFlags, void*, int, void*) = &Args::_S_manage<>;
-};
+    [[nodiscard]] static constexpr std::size_t _S_slotCount(std::size_t __capacity) noexcept
+    { return detail::key_index_capacity(__capacity); }
 
+    [[nodiscard]] static constexpr std::size_t _S_payloadOffset(std::size_t __capacity) noexcept
+    {
+        const std::size_t end = __capacity * sizeof(value_type) + _S_slotCount(__capacity) * sizeof(std::uint32_t);
+        return (end + _S_payloadAlignment - 1) / _S_payloadAlignment * _S_payloadAlignment;
+    }
 
-template<KwargsKey::ValueType... _OptionalList>
-class Kwargs
-{
-public:
+    [[nodiscard]] value_type* _M_pairs() const noexcept
+    { return detail::pointer_cast<value_type*>(_M_block); }
 
-    using value_type = std::pair<const KwargsKey, KwargsValue>;
-    using container_type = std::initializer_list<value_type>;
+    [[nodiscard]] std::uint32_t* _M_slots() const noexcept
+    { return detail::pointer_cast<std::uint32_t*>(_M_block + _M_capacity * sizeof(value_type)); }
 
-    using iterator = typename container_type::iterator;
-    using const_iterator = typename container_type::const_iterator;
+    [[nodiscard]] std::byte* _M_payloads() const noexcept
+    { return _M_block + _S_payloadOffset(_M_capacity); }
 
-    struct DataItem
+    /// @return The size and alignment of the copy of the object __value holds or refers to, or zeros if it is not copied.
+    [[nodiscard]] static std::pair<std::size_t, std::size_t> _S_payloadLayout(const KwargsValue& __value) noexcept
     {
-        constexpr DataItem(const KwargsValue* __that = nullptr) noexcept
-            : _M_that(__that)
-        { }
+        std::pair<std::size_t, std::size_t> layout{ 0, 0 };
 
-        template<typename _ValueType, typename... _Args>
-        [[nodiscard]] constexpr _ValueType valueOr(_Args&&... __args) const noexcept
-        { return _M_that ? _M_that->value<_ValueType>(std::forward<_Args>(__args)...) : _ValueType(std::forward<_Args>(__args)...); }
+        if (__value.valueTag() != KwargsValue::ValueFlag)
+        {
+            __value._M_manager(KwargsValue::DoGetPayloadLayout, nullptr, &layout);
+        }
 
-        [[nodiscard]] constexpr bool hasValue() const noexcept
-        { return static_cast<bool>(_M_that); }
+        return layout.second > _S_payloadAlignment ? std::pair<std::size_t, std::size_t>{ 0, 0 } : layout;
+    }
 
-        [[nodiscard]] constexpr const KwargsValue* operator->() const noexcept
-        { return _M_that; }
+    /// @return The payload bytes that __value may take, including padding.
+    [[nodiscard]] static std::size_t _S_payloadBound(const KwargsValue& __value) noexcept
+    {
+        const auto [size, alignment] = _S_payloadLayout(__value);
+        return size ? size + alignment - 1 : 0;
+    }
 
-        [[nodiscard]] constexpr const KwargsValue& operator*() const noexcept
-        { return *_M_that; }
+    void _M_allocate(std::size_t __capacity, std::size_t __payloadCapacity)
+    {
+        _M_block = static_cast<std::byte*>(::operator new(_S_payloadOffset(__capacity) + __payloadCapacity));
 
-    private:
+        _M_capacity = __capacity;
+        _M_payloadCapacity = __payloadCapacity;
 
-        const KwargsValue* _M_that;
-    };
+        std::memset(_M_slots(), 0, _S_slotCount(__capacity) * sizeof(std::uint32_t));
+    }
 
-    constexpr Kwargs(container_type __list) noexcept
-        : _M_data(__list)
+    [[nodiscard]] static bool _S_showsAll(const value_type&) noexcept
+    { return true; }
+
+    /// @brief Replaces the pairs of this map; if a copy throws, the pairs copied so far are destroyed with the block.
+    template<typename _Iterator, typename _Predicate>
+    void _M_assign(_Iterator __first, _Iterator __last, _Predicate __shows)
     {
-        // If _OptionalList is not empty then check whether all keys are in _OptionalList
-        if constexpr (sizeof...(_OptionalList) != 0)
+        std::size_t payloadCapacity = 0;
+
+        for (auto it = __first; it != __last; ++it)
         {
-            for (const auto& i : __list)
-            {
-                if (_M_contains<_OptionalList...>(i.first) == false)
-                {
-                    assert(false && "This key is not in the OptionalList.");
-                }
-            }
+            payloadCapacity += _S_payloadBound(it->second);
+        }
+
+        KwargsMap result;
+
+        if (__first != __last)
+        {
+            result._M_allocate(static_cast<std::size_t>(__last - __first), payloadCapacity);
         }
 
-        // Check for duplicate keys
-        assert([&]() constexpr noexcept -> bool
+        for (; __first != __last; ++__first)
         {
-            if (__list.size())
+            if (__shows(*__first) && result.contains(__first->first) == false)
             {
-                for (auto it = __list.begin() + 1; it != __list.end(); ++it)
-                {
-                    for (auto ft = __list.begin(); ft != it; ++ft)
-                    {
-                        if (it->first == ft->first)
-                        {
-                            return false;
-                        }
-                    }
-                }
+                result._M_append(__first->first, __first->second);
             }
+        }
 
-            return true;
-        }());
+        result.swap(*this);
     }
 
-    [[nodiscard]] constexpr DataItem operator[](KwargsKey __option) noexcept
+    /// @brief Adds a pair for a key that is not present, with room for it already in the block.
+    void _M_append(KwargsKey __key, const KwargsValue& __value)
     {
-        for (const auto& i : _M_data)
+        if (const auto [size, alignment] = _S_payloadLayout(__value); size != 0)
         {
-            if (i.first == __option)
-            {
-                return DataItem(&i.second);
-            }
+            const std::size_t offset = (_M_payloadSize + alignment - 1) / alignment * alignment;
+            std::byte* payload = _M_payloads() + offset;
+
+            // The pair is added only once the copy exists, so a throwing copy leaves the map as it was.
+            __value._M_manager(KwargsValue::DoCopyPayloadTo, __value._M_data._M_ptr, payload);
+
+            value_type* pair = ::new (_M_pairs() + _M_size) value_type(__key, KwargsValue());
+
+            // The pair refers to the copy, which the map destroys.
+            __value._M_manager(KwargsValue::DoGetReferenceManager, nullptr, &pair->second._M_manager);
+            pair->second._M_data._M_ptr = payload;
+
+            _M_payloadSize = offset + size;
+        }
+        else
+        {
+            ::new (_M_pairs() + _M_size) value_type(__key, __value);
         }
 
-        return DataItem(nullptr);
+        const std::size_t mask = _S_slotCount(_M_capacity) - 1;
+
+        std::size_t slot = detail::key_index_slot(__key.value(), mask);
+
+        for (; _M_slots()[slot] != 0; slot = (slot + 1) & mask);
+
+        _M_slots()[slot] = static_cast<std::uint32_t>(++_M_size);
     }
 
-    template<std::size_t _Size>
-    [[nodiscard]] constexpr DataItem operator[](const std::array<KwargsKey, _Size>& __options) noexcept
+    void _M_destroy() noexcept
     {
-        for (KwargsKey key : __options)
+        for (std::size_t i = 0; i < _M_size; ++i)
         {
-            for (const auto& i : _M_data)
-            {
-                if (i.first == key)
-                {
-                    return DataItem(&i.second);
-                }
-            }
-        }
-        return DataItem(nullptr);
-    }
+            KwargsValue& value = _M_pairs()[i].second;
 
-    [[nodiscard]] constexpr const_iterator begin() const noexcept
-    { return _M_data.begin(); }
+            // Only the copies in the block are referred to from inside it.
+            const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(value._M_data._M_ptr);
+            const std::uintptr_t payloads = reinterpret_cast<std::uintptr_t>(_M_payloads());
 
-    [[nodiscard]] constexpr const_iterator end() const noexcept
-    { return _M_data.end(); }
+            if (value.valueTag() == KwargsValue::PointerFlag && address - payloads < _M_payloadSize)
+            {
+                value._M_manager(KwargsValue::DoDestroyPayload, value._M_data._M_ptr, nullptr);
+            }
 
-    [[nodiscard]] constexpr std::size_t size() const noexcept
-    { return _M_data.size(); }
+            _M_pairs()[i].~value_type();
+        }
 
-protected:
+        ::operator delete(_M_block);
+    }
 
-    template<KwargsKey::ValueType _Current>
-    [[nodiscard]] constexpr bool _M_contains(KwargsKey __option) const noexcept
-    { return __option == KwargsKey(_Current); }
+private:
 
-    template<KwargsKey::ValueType _Current, KwargsKey::ValueType _Next, KwargsKey::ValueType... _Args>
-    [[nodiscard]] constexpr bool _M_contains(KwargsKey __option) const noexcept
-    { return __option == KwargsKey(_Current) || _M_contains<_Next, _Args...>(__option); }
+    std::byte* _M_block = nullptr;
 
-private:
+    std::size_t _M_size = 0;
+    std::size_t _M_capacity = 0;
 
-    container_type _M_data;
+    std::size_t _M_payloadSize = 0;
+    std::size_t _M_payloadCapacity = 0;
 };
 
+inline void swap(KwargsMap& __left, KwargsMap& __right) noexcept
+{ __left.swap(__right); }
+
 
 class KwargsKeyLiteral
 {
@@ -4562,6 +11033,8 @@ private:
 
 constexpr KwargsKey::KwargsKey(const KwargsKeyLiteral& __literal) noexcept : _M_key(__literal.value()) { }
 
+constexpr KwargsKey32::KwargsKey32(const KwargsKeyLiteral& __literal) noexcept : KwargsKey32(KwargsKey(__literal)) { }
+
 
 #if defined(_MSC_VER)
 #   pragma warning (pop)
@@ -4581,7 +11054,7 @@ inline namespace literals
 #   endif
 #endif
 
-[[nodiscard]] constexpr auto
+[[nodiscard]] _KWARGS_CONSTEVAL auto
 #if    defined(KWARGS_USE_LITERAL_SUFFIX_NO_UNDERSCORE) && defined(KWARGS_USE_SHORT_LITERAL_SUFFIX)
     operator""o
 #elif  defined(KWARGS_USE_LITERAL_SUFFIX_NO_UNDERSCORE)
@@ -4592,11 +11065,11 @@ inline namespace literals
     operator""_opt
 #endif
         (const char* const __str, std::size_t __size) noexcept
-{ return KwargsKeyLiteral(detail::string_hash_string(__str, __size)); }
+{ return KwargsKeyLiteral(detail::string_hash_literal(__str, __size)); }
 
 
 template<char... _String>
-[[nodiscard]] constexpr auto
+[[nodiscard]] _KWARGS_CONSTEVAL auto
 #if    defined(KWARGS_USE_LITERAL_SUFFIX_NO_UNDERSCORE) && defined(KWARGS_USE_SHORT_LITERAL_SUFFIX)
     operator""o
 #elif  defined(KWARGS_USE_LITERAL_SUFFIX_NO_UNDERSCORE)
@@ -4610,7 +11083,7 @@ template<char... _String>
 { return KwargsKeyLiteral(detail::string_hash_characters<_String...>()); }
 
 
-[[nodiscard]] constexpr auto
+[[nodiscard]] _KWARGS_CONSTEVAL auto
 #if    defined(KWARGS_USE_LITERAL_SUFFIX_NO_UNDERSCORE) && defined(KWARGS_USE_SHORT_LITERAL_SUFFIX)
     operator""o
 #elif  defined(KWARGS_USE_LITERAL_SUFFIX_NO_UNDERSCORE)
@@ -4621,7 +11094,7 @@ template<char... _String>
     operator""_opt
 #endif
         (char __ch) noexcept
-{ return KwargsKeyLiteral(detail::string_hash_character(__ch)); }
+{ return KwargsKeyLiteral(detail::string_hash_append(0, __ch)); }
 
 
 }  // namespace literals
@@ -4635,6 +11108,9 @@ template<char... _String>
 
 #undef _KWARGS_ATTRIBUTE_LIKELY
 #undef _KWARGS_ATTRIBUTE_UNLIKELY
+#undef _KWARGS_ATTRIBUTE_ALWAYS_INLINE
+
+#undef _KWARGS_CONSTEVAL
 
 #undef __kwargs_detail
 
@@ -4645,10 +11121,18 @@ template<char... _String>
 // --- Export ---
 
 using kwargs::KwargsKey;
+using kwargs::KwargsKey32;
+using kwargs::KeyTable;
 using kwargs::KwargsValue;
 
 using kwargs::Kwargs;
 using kwargs::Args;
+using kwargs::LookupCache;
+using kwargs::KeyError;
+
+using kwargs::Param;
+using kwargs::KwargsSchema;
+using kwargs::KwargsMap;
 
 using namespace kwargs::literals;
 
@@ -0,0 +1,18 @@
+// Compiled to assembly by CMakeLists.txt: the keys of { "name", value } pairs
+// must reach the call site as constants, without a call into the hashing code.
+
+#include "../include/kwargs.h"
+
+int use(Kwargs<"name"_opt, "old"_opt> __kwargs);
+
+int use_any(Kwargs<> __kwargs);
+
+int call()
+{
+    return use({ { "name", 1 }, { "old", 2 } });
+}
+
+int call_long()
+{
+    return use_any({ { "an_option_name_that_is_longer_than_a_cache_line_of_text_xyz", 3 } });
+}
@@ -0,0 +1,121 @@
+#ifndef KWARGS_CONVERT_WITH_BOUNDED_STACK
+#   define KWARGS_CONVERT_WITH_BOUNDED_STACK
+#endif
+
+#include "test.h"
+
+#if __has_include(<ucontext.h>)
+
+#include <ucontext.h>
+#include <cstring>
+
+static ucontext_t main_context, fiber_context;
+
+static void (*fiber_function)() = nullptr;
+
+static void fiber_entry()
+{ fiber_function(); }
+
+alignas(64) static unsigned char fiber_stack[256 * 1024];
+
+// Runs __function on a painted stack and returns how many bytes of it were written.
+template<typename _Function>
+static std::size_t peak_stack_usage(_Function __function)
+{
+    static _Function* function;
+    function = &__function;
+
+    fiber_function = []() -> void { (*function)(); };
+
+    std::memset(fiber_stack, 0xCD, sizeof(fiber_stack));
+
+    getcontext(&fiber_context);
+
+    fiber_context.uc_stack.ss_sp = fiber_stack;
+    fiber_context.uc_stack.ss_size = sizeof(fiber_stack);
+    fiber_context.uc_link = &main_context;
+
+    makecontext(&fiber_context, fiber_entry, 0);
+    swapcontext(&main_context, &fiber_context);
+
+    std::size_t untouched = 0;
+
+    for (; untouched < sizeof(fiber_stack) && fiber_stack[untouched] == 0xCD; ++untouched);
+
+    return sizeof(fiber_stack) - untouched;
+}
+
+// Not constant, so that the conversions below cannot be folded at compile time.
+double real = 2.2250738585072014e-308;
+
+std::int64_t integer = -9223372036854775807LL - 1;
+
+std::string_view inputs[] = {
+    "2.2250738585072011e-308",
+    "9007199254740993.0000000000000000000000000000001",
+    "1.00000005960464477539062499",
+    "1.18973149535723176502e+4932",
+    "-9223372036854775808"
+};
+
+int main()
+{
+#if defined(__OPTIMIZE__)
+    constexpr std::size_t budget = 512;
+#else
+    // Without optimization every small helper keeps a frame of its own.
+    constexpr std::size_t budget = 2048;
+#endif
+
+    static char buffer[8192];
+
+    const std::size_t baseline = peak_stack_usage([]() -> void { });
+
+    auto stack_usage = [baseline](auto __function) -> std::size_t {
+        // The first call creates the thread-local scratch objects.
+        __function();
+        return peak_stack_usage(__function) - baseline;
+    };
+
+    // valueTo adds the type dispatch of KwargsValue, measured with a value that needs no conversion.
+    const KwargsValue boolean = true;
+    const std::size_t dispatch = stack_usage([&]() -> void { boolean.valueTo(buffer, buffer + sizeof(buffer)); });
+
+    const KwargsValue values[] = {
+        1.7976931348623157e308, 4.9406564584124654e-324, 0.1f, -3.4028235e38f,
+        1.5e300L, 3.6e-4951L, -123456789LL, 18446744073709551615ULL
+    };
+
+    for (const auto& value : values)
+    {
+        test () expect (stack_usage([&]() -> void { value.valueTo(buffer, buffer + sizeof(buffer)); }) < dispatch + budget);
+    }
+
+    test () expect (stack_usage([]() -> void { (void)kwargs::detail::floating_point_to_chars(buffer, real); }) < budget);
+    test () expect (stack_usage([]() -> void { (void)kwargs::detail::integer_to_chars(buffer, integer); }) < budget);
+    test () expect (stack_usage([]() -> void { (void)kwargs::detail::integer_to_chars(buffer, integer, 2); }) < budget);
+
+    // Near halfway cases that need the arbitrary-precision fallback.
+    test () expect (stack_usage([]() -> void { (void)kwargs::detail::string_to_floating_point<double>(inputs[0]); }) < budget);
+    test () expect (stack_usage([]() -> void { (void)kwargs::detail::string_to_floating_point<double>(inputs[1]); }) < budget);
+    test () expect (stack_usage([]() -> void { (void)kwargs::detail::string_to_floating_point<float>(inputs[2]); }) < budget);
+    test () expect (stack_usage([]() -> void { (void)kwargs::detail::string_to_floating_point<long double>(inputs[3]); }) < budget);
+    test () expect (stack_usage([]() -> void { (void)kwargs::detail::string_to_integer<std::int64_t>(inputs[4]); }) < budget);
+
+    // The results are unchanged.
+    test () expect (std::string_view(buffer, static_cast<std::size_t>(KwargsValue(0.1).valueTo(buffer, buffer + sizeof(buffer)) - buffer)) == "0.1");
+    test () expect (kwargs::detail::string_to_floating_point<double>("2.2250738585072011e-308") == 2.2250738585072011e-308);
+    test () expect (KwargsValue(1.0 / 3).value<std::string>(kwargs::fmt::fixed(20)) == "0.33333333333333331483");
+    test () expect (KwargsValue(1e300).value<std::string>(kwargs::fmt::scientific(3)) == "1.000e+300");
+
+    return testing_completed;
+}
+
+#else
+
+int main()
+{
+    return testing_completed;
+}
+
+#endif
@@ -8,7 +8,7 @@ int main()
     test (auto res = kwargs::detail::constant_name<0.25>()) expect (res.substr(0, 4) == "0.25");
 #endif
 
-    test (auto res = kwargs::detail::constant_name<' '>()) expect (res == " " or res == "0x20");
+    test (auto res = kwargs::detail::constant_name<' '>()) expect (res == " " or res == "' '" or res == "0x20");
 
     enum Enum { A, B, C };
 
@@ -0,0 +1,71 @@
+#include "test.h"
+
+struct Font
+{
+    std::string faceName;
+    int size;
+    float escapement;
+    bool italic;
+
+    Font(Kwargs<"name"_opt, "size"_opt, "escapement"_opt, "italic"_opt> __kwargs = { })
+    {
+        auto [name, size, escapement, italic] = __kwargs.extract<"name"_opt, "size"_opt, "escapement"_opt, "italic"_opt>();
+
+        this->faceName = name.valueOr<std::string>();
+        this->size = size.valueOr<int>(9);
+        this->escapement = escapement.valueOr<float>(0.00f);
+        this->italic = italic.valueOr<bool>(false);
+    }
+};
+
+static std::string join(Kwargs<> __kwargs)
+{
+    auto [a, b, c] = __kwargs.extract<"a"_opt, "b"_opt, "c"_opt>();
+
+    return a.valueOr<std::string>("-") + b.valueOr<std::string>("-") + c.valueOr<std::string>("-");
+}
+
+// The same key twice cannot use a slot table.
+static std::string join_twice(Kwargs<> __kwargs)
+{
+    auto [a, b, a2] = __kwargs.extract<"a"_opt, "b"_opt, "a"_opt>();
+
+    return a.valueOr<std::string>("-") + b.valueOr<std::string>("-") + a2.valueOr<std::string>("-");
+}
+
+static std::string join_runtime(Kwargs<> __kwargs, const std::string& __key)
+{
+    auto [a, b, c] = __kwargs.extract("a", "b"_opt, KwargsKey(__key.data(), __key.size()));
+
+    return a.valueOr<std::string>("-") + b.valueOr<std::string>("-") + c.valueOr<std::string>("-");
+}
+
+static std::string join_runtime_listed(Kwargs<"a"_opt, "b"_opt, "c"_opt> __kwargs, const std::string& __key)
+{
+    auto [a, b, c] = __kwargs.extract("a", "b"_opt, KwargsKey(__key.data(), __key.size()));
+
+    return a.valueOr<std::string>("-") + b.valueOr<std::string>("-") + c.valueOr<std::string>("-");
+}
+
+int main()
+{
+    test () expect (Font().size == 9);
+    test () expect (Font({ { "name", "Arial" }, { "italic", true } }).faceName == "Arial");
+    test () expect (Font({ { "name", "Arial" }, { "italic", true } }).italic);
+    test () expect (Font({ "size"_opt = "18", "escapement"_opt = "49.2" }).size == 18);
+    test () expect (Font({ "size"_opt = "18", "escapement"_opt = "49.2" }).escapement == 49.2f);
+
+    test () expect (join({ }) == "---");
+    test () expect (join({ { "c", 3 }, { "a", 1 } }) == "1-3");
+    test () expect (join({ { "x", 0 }, { "b", 2 } }) == "-2-");
+
+    test () expect (join_twice({ { "a", 1 }, { "b", 2 } }) == "121");
+
+    test () expect (join_runtime({ { "c", 3 }, { "a", 1 } }, "c") == "1-3");
+    test () expect (join_runtime({ { "c", 3 }, { "a", 1 } }, "d") == "1--");
+    test () expect (join_runtime({ { "c", 3 }, { "a", 1 } }, "a") == "1-1");
+
+    test () expect (join_runtime_listed({ { "c", 3 }, { "b", 2 } }, "c") == "-23");
+
+    return testing_completed;
+}
@@ -0,0 +1,83 @@
+#include "test.h"
+
+using kwargs::alias;
+
+using Options = Kwargs<"name"_opt, alias, "lastname"_opt, alias, "surname"_opt, "width"_opt, alias, "w"_opt, "height"_opt>;
+
+static int duplicates = 0;
+
+static void count_duplicates(KeyError __error, KwargsKey)
+{
+    duplicates += __error == KeyError::Duplicate;
+}
+
+static std::string pick_name(Options __kwargs, KwargsKey __key)
+{
+    return __kwargs[__key].valueOr<std::string>("-");
+}
+
+static int pick_width(Options __kwargs, KwargsKey __key)
+{
+    return __kwargs[__key].valueOr<int>(-1);
+}
+
+// The aliases belong to Options only.
+static std::string pick_plain(Kwargs<"name"_opt, "surname"_opt> __kwargs, KwargsKey __key)
+{
+    return __kwargs[__key].valueOr<std::string>("-");
+}
+
+static bool pick_extracted(Options __kwargs)
+{
+    auto [name, width, height] = __kwargs.extract<"surname"_opt, "w"_opt, "height"_opt>();
+    return name.valueOr<std::string>() == "Yang" && width.valueOr<int>() == 3 && height.hasValue() == false;
+}
+
+int main()
+{
+    using group_type = kwargs::detail::aliased_key_list_t<"name"_opt, alias, "lastname"_opt, alias, "surname"_opt, "width"_opt, alias, "w"_opt, "height"_opt>;
+    using groups = kwargs::detail::key_groups<"name"_opt, alias, "lastname"_opt, alias, "surname"_opt, "width"_opt, alias, "w"_opt, "height"_opt>;
+
+    static_assert(std::is_same_v<group_type, kwargs::detail::key_list<"name"_opt, "lastname"_opt, "surname"_opt, "width"_opt, "w"_opt, "height"_opt>>);
+    static_assert(groups::count == 3 && groups::sizes[0] == 3 && groups::sizes[1] == 2 && groups::sizes[2] == 1);
+    static_assert(kwargs::detail::kwargs_slot_table_t<"name"_opt, alias, "lastname"_opt, alias, "surname"_opt, "width"_opt, alias, "w"_opt, "height"_opt>::layout.perfect);
+
+    // A marker must stand between two keys.
+    static_assert(kwargs::detail::key_groups<alias, "x"_opt>::well_formed == false);
+    static_assert(kwargs::detail::key_groups<"x"_opt, alias, alias, "y"_opt>::well_formed == false);
+
+    // Without aliases the slots of each key link to themselves only.
+    static_assert(kwargs::detail::key_slot_groups<kwargs::detail::key_slot_table<"x"_opt, "y"_opt>, kwargs::detail::key_list<"x"_opt, "y"_opt>,
+        kwargs::detail::key_groups<"x"_opt, "y"_opt>>::aliased == false);
+
+    // A value passed under any name of a group is found by every name of it.
+    test () expect (pick_name({ { "name", "Huan" } }, "name") == "Huan");
+    test () expect (pick_name({ { "name", "Huan" } }, "surname") == "Huan");
+    test () expect (pick_name({ { "surname", "Yang" } }, "name") == "Yang");
+    test () expect (pick_name({ { "surname", "Yang" } }, "lastname") == "Yang");
+    test () expect (pick_name({ { "lastname", "Yang" }, { "width", 3 } }, "surname"_opt) == "Yang");
+    test () expect (pick_name({ { "width", 3 } }, "name") == "-");
+
+    test () expect (pick_width({ { "w", 3 } }, "width") == 3);
+    test () expect (pick_width({ { "width", 3 } }, "w") == 3);
+    test () expect (pick_width({ { "height", 4 } }, "w") == -1);
+    test () expect (pick_width({ { "height", 4 } }, "height") == 4);
+
+    // Keys outside the OptionalList and its aliases are never found.
+    test () expect (pick_width({ { "w", 3 } }, "n") == -1);
+
+    test () expect (pick_extracted({ { "surname", "Yang" }, { "w", 3 } }));
+
+    test () expect (pick_plain({ { "surname", "Yang" } }, "name") == "-");
+    test () expect (pick_plain({ { "surname", "Yang" } }, "surname") == "Yang");
+
+    // Passing a key and one of its aliases is a duplicate, and the first of them is found.
+    kwargs::setKeyErrorHandler(&count_duplicates);
+
+    test () expect (pick_name({ { "surname", "Yang" }, { "name", "Huan" } }, "name") == "Yang");
+    test () expect (duplicates == int(kwargs::detail::validate_keys));
+
+    kwargs::setKeyErrorHandler(nullptr);
+
+    return testing_completed;
+}
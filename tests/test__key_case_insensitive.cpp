@@ -0,0 +1,91 @@
+#ifndef KWARGS_KEY_CASE_INSENSITIVE
+#   define KWARGS_KEY_CASE_INSENSITIVE
+#endif
+
+#include "test.h"
+
+#include <string>
+#include <random>
+
+// Each literal is hashed at compile time, and at run time from a copy in blocks.
+#define KWARGS_TEST_LITERALS(X)                                                                     \
+    X("") X("a") X("Z") X("@[`{") X("name") X("NAME") X("Name") X("timeout") X("TimeOut")           \
+    X("Host") X("Accept") X("Content-Type") X("content-type") X("CONTENT-LENGTH")                   \
+    X("Accept-Encoding") X("ACCEPT-ENCODING") X("Access-Control-Allow-Origin")                       \
+    X("X-Forwarded-For") X("Strict-Transport-Security") X("If-Modified-Since")                       \
+    X("Sec-WebSocket-Extensions") X("ABCDEFGHIJKLMNOPQRSTUVWXYZ") X("abcdefghijklmnopqrstuvwxyz")    \
+    X("0123456789_ABCDEFGHIJ_0123456789") X("\xC1\xC4\xDA\xE1\xFA-Caf\xC3\x89-\xC0\xC1\xDA\xDB")   \
+    X("MiXeD_CaSe_With_A_Length_Above_Thirty_Two_Characters")
+
+struct literal
+{
+    std::string_view text;
+    kwargs::detail::string_hash_type hash;
+};
+
+#define KWARGS_TEST_LITERAL(__str) \
+    literal{ __str, std::integral_constant<kwargs::detail::string_hash_type, kwargs::KwargsKey(__str).value()>::value },
+
+static constexpr literal literals[] = { KWARGS_TEST_LITERALS(KWARGS_TEST_LITERAL) };
+
+// Character by character, as in constant evaluation.
+static kwargs::detail::string_hash_type string_hash_by_character(std::string_view __str) noexcept
+{
+    kwargs::detail::string_hash_type result = 0;
+
+    for (const char c : __str)
+    {
+        result = kwargs::detail::string_hash_append(result, c);
+    }
+
+    return result;
+}
+
+static std::string content_type(Kwargs<"Content-Type"_opt> __kwargs)
+{
+    return __kwargs["CONTENT-TYPE"].valueOr<std::string>();
+}
+
+int main()
+{
+    for (const auto& [text, hash] : literals)
+    {
+        const std::string copy(text);
+
+        test () expect (KwargsKey(copy.data(), copy.size()).value() == hash);
+        test () expect (kwargs::detail::string_hash_string(std::string_view(copy)) == hash);
+    }
+
+    static_assert("Content-Type"_opt == "content-type"_opt);
+    static_assert('Q'_opt == 'q'_opt);
+
+    test (std::string s = "ACCEPT-ENCODING") expect (KwargsKey(s.data(), s.size()) == "accept-encoding"_opt);
+    test (std::string s = "\xC1\xC4") expect (KwargsKey(s.data(), s.size()) != KwargsKey("\xE1\xE4"));
+
+    test () expect (content_type({ { "content-type", "text/html" } }) == "text/html");
+    test () expect (content_type({ { "CONTENT-TYPE", "text/plain" } }) == "text/plain");
+
+    // Every offset and length of the block path against the scalar one.
+    // A fixed seed, so that a failure can be reproduced.
+    std::mt19937_64 rng(20241017);
+
+    const char alphabet[] = "AZaz@[`{09-_\x80\xC1\xDA\xFF";
+
+    for (int i = 0; i < 2000; ++i)
+    {
+        std::string s(rng() % 70, '\0');
+
+        for (char& c : s)
+        {
+            c = alphabet[rng() % (sizeof(alphabet) - 1)];
+        }
+
+        const std::size_t offset = rng() % (s.size() + 1);
+
+        const std::string_view view = std::string_view(s).substr(offset);
+
+        test () expect (kwargs::detail::string_hash_string(view) == string_hash_by_character(view));
+    }
+
+    return testing_completed;
+}
@@ -0,0 +1,69 @@
+#ifndef KWARGS_KEY_INDEX_THRESHOLD
+#   define KWARGS_KEY_INDEX_THRESHOLD 4
+#endif
+
+#include "test.h"
+
+static int pick(Kwargs<> __kwargs, KwargsKey __key)
+{
+    return __kwargs[__key].valueOr<int>(-1);
+}
+
+// Looks up on the original and then on a copy, which builds an index of its own.
+static bool pick_from_copy(Kwargs<> __kwargs)
+{
+    const bool before = __kwargs["f"].valueOr<int>(-1) == 6;
+
+    Kwargs<> copy = __kwargs;
+    const bool after = copy["f"].valueOr<int>(-1) == 6 && copy["g"].hasValue() == false;
+
+    Kwargs<> moved = std::move(copy);
+    return before && after && moved["a"].valueOr<int>(-1) == 1;
+}
+
+static std::string pick_alias(Kwargs<> __kwargs)
+{
+    return __kwargs["n"_opt or "name" or "surname"].valueOr<std::string>("-");
+}
+
+int main()
+{
+    static_assert(kwargs::detail::key_index_threshold != 0);
+
+    // Only Kwargs without a slot table carry a signature and an index pointer, and nothing more.
+    static_assert(sizeof(Kwargs<>) == sizeof(Kwargs<>::container_type) + sizeof(KwargsKey) * kwargs::detail::packed_key_capacity
+        + sizeof(kwargs::detail::kwargs_key_signature<true>) + sizeof(kwargs::detail::kwargs_key_index<true>));
+
+    // The index makes copies of Kwargs<> do more than copy bytes; Kwargs with a slot table never have one.
+    static_assert(std::is_trivially_copyable_v<Kwargs<>> == false);
+    static_assert(std::is_trivially_copyable_v<Kwargs<"a"_opt>>);
+    static_assert(sizeof(Kwargs<"a"_opt>) == sizeof(Kwargs<>::container_type) + alignof(Kwargs<>::container_type)
+        * ((sizeof(kwargs::detail::kwargs_slots<kwargs::detail::key_slot_table<"a"_opt>>) + alignof(Kwargs<>::container_type) - 1) / alignof(Kwargs<>::container_type)));
+
+    test () expect (kwargs::detail::key_signature_bits("name"_opt) != 0);
+    test () expect (kwargs::detail::key_signature_bits("name"_opt) == kwargs::detail::key_signature_bits(KwargsKey("name").value()));
+
+    // Short lists are scanned.
+    test () expect (pick({ { "a", 1 }, { "b", 2 } }, "b") == 2);
+    test () expect (pick({ { "a", 1 }, { "b", 2 } }, "c") == -1);
+    test () expect (pick({ }, "a") == -1);
+
+    // Longer lists are indexed on the first lookup.
+    test () expect (pick({ { "a", 1 }, { "b", 2 }, { "c", 3 }, { "d", 4 }, { "e", 5 }, { "f", 6 } }, "a") == 1);
+    test () expect (pick({ { "a", 1 }, { "b", 2 }, { "c", 3 }, { "d", 4 }, { "e", 5 }, { "f", 6 } }, "f") == 6);
+    test () expect (pick({ { "a", 1 }, { "b", 2 }, { "c", 3 }, { "d", 4 }, { "e", 5 }, { "f", 6 } }, "g") == -1);
+    test () expect (pick({ { "a", 1 }, { "b", 2 }, { "c", 3 }, { "d", 4 }, { "e", 5 }, { "f", 6 } }, KwargsKey()) == -1);
+
+#if defined(NDEBUG)
+    // The first of duplicate keys is found, as by the scan.
+    test () expect (pick({ { "a", 1 }, { "b", 2 }, { "c", 3 }, { "d", 4 }, { "a", 5 }, { "f", 6 } }, "a") == 1);
+#endif
+
+    test () expect (pick_from_copy({ { "a", 1 }, { "b", 2 }, { "c", 3 }, { "d", 4 }, { "e", 5 }, { "f", 6 } }));
+
+    test () expect (pick_alias({ { "a", 1 }, { "b", 2 }, { "c", 3 }, { "d", 4 }, { "surname", "Yang" } }) == "Yang");
+    test () expect (pick_alias({ { "a", 1 }, { "b", 2 }, { "c", 3 }, { "d", 4 }, { "surname", "Yang" }, { "name", "Huan" } }) == "Huan");
+    test () expect (pick_alias({ { "a", 1 }, { "b", 2 }, { "c", 3 }, { "d", 4 }, { "e", 5 } }) == "-");
+
+    return testing_completed;
+}
@@ -0,0 +1,97 @@
+#include "test.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+int main()
+{
+    KeyTable table;
+
+    test () expect (table.size() == 0);
+    test () expect (table.find("name") == nullptr);
+    test () expect (table.nameOf("name").empty());
+
+    const KwargsKey name = table.intern("name");
+
+    test () expect (name == "name"_opt);
+    test () expect (table.intern("name") == name);
+    test () expect (table.size() == 1);
+    test () expect (table.find("name") != nullptr);
+    test () expect (*table.find("name") == name);
+    test () expect (table.contains("name"));
+    test () expect (table.contains("old") == false);
+    test () expect (table.nameOf(name) == "name");
+
+    // The same keys as brace pairs.
+    test () expect (table.intern("old") == KwargsKey("old"));
+    test () expect (table.nameOf(KwargsKey("old")) == "old");
+    test () expect (table.size() == 2);
+
+    // Grows past its initial capacity without losing names.
+    std::vector<std::string> names;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        names.push_back("key_" + std::to_string(i));
+        table.intern(names.back());
+    }
+
+    test () expect (table.size() == 1002);
+
+    bool all_found = true;
+
+    for (const auto& s : names)
+    {
+        const KwargsKey* key = table.find(s);
+        all_found = all_found && key != nullptr && *key == KwargsKey(s.data(), s.size()) && table.nameOf(*key) == s;
+    }
+
+    test () expect (all_found);
+    test () expect (table.nameOf(name) == "name");
+
+    // Concurrent writers intern overlapping names while readers look them up.
+    KeyTable shared;
+
+    std::vector<std::thread> threads;
+    std::vector<char> consistent(8, true);
+
+    for (std::size_t t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&shared, &names, &consistent, t]() -> void {
+            for (std::size_t i = t; i < names.size(); i += 2)
+            {
+                if (shared.intern(names[i]) != KwargsKey(names[i].data(), names[i].size()))
+                {
+                    consistent[t] = false;
+                }
+            }
+        });
+    }
+
+    for (std::size_t t = 4; t < 8; ++t)
+    {
+        threads.emplace_back([&shared, &names, &consistent, t]() -> void {
+            for (const auto& s : names)
+            {
+                const KwargsKey* key = shared.find(s);
+
+                if (key != nullptr && shared.nameOf(*key) != s)
+                {
+                    consistent[t] = false;
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    test () expect (std::find(consistent.begin(), consistent.end(), false) == consistent.end());
+    test () expect (shared.size() == names.size());
+    test () expect (shared.nameOf(KwargsKey("key_999")) == "key_999");
+
+    return testing_completed;
+}
@@ -0,0 +1,86 @@
+// Keys are validated in release builds too.
+#ifndef NDEBUG
+#   define NDEBUG
+#endif
+
+#ifndef KWARGS_VALIDATE_KEYS
+#   define KWARGS_VALIDATE_KEYS
+#endif
+
+#ifndef KWARGS_KEY_INDEX_THRESHOLD
+#   define KWARGS_KEY_INDEX_THRESHOLD 8
+#endif
+
+#include "test.h"
+
+#include <vector>
+
+static std::vector<std::pair<KeyError, KwargsKey>> errors;
+
+static void record(KeyError __error, KwargsKey __key)
+{
+    errors.emplace_back(__error, __key);
+}
+
+static bool reports(std::initializer_list<std::pair<KeyError, KwargsKey>> __expected)
+{
+    const bool result = errors == std::vector<std::pair<KeyError, KwargsKey>>(__expected);
+
+    errors.clear();
+    return result;
+}
+
+static int pick(Kwargs<> __kwargs, KwargsKey __key)
+{
+    return __kwargs[__key].valueOr<int>(-1);
+}
+
+static int pick_listed(Kwargs<"width"_opt, "height"_opt> __kwargs, KwargsKey __key)
+{
+    return __kwargs[__key].valueOr<int>(-1);
+}
+
+int main()
+{
+    static_assert(kwargs::detail::validate_keys);
+
+    test () expect (kwargs::setKeyErrorHandler(&record) == &kwargs::detail::default_key_error_handler);
+
+    // With a slot table.
+    test () expect (pick_listed({ { "width", 1 }, { "height", 2 } }, "height") == 2);
+    test () expect (reports({ }));
+
+    test () expect (pick_listed({ { "width", 1 }, { "depth", 2 } }, "width") == 1);
+    test () expect (reports({ { KeyError::Unknown, "depth" } }));
+
+    test () expect (pick_listed({ { "width", 1 }, { "height", 2 }, { "width", 3 } }, "width") == 1);
+    test () expect (reports({ { KeyError::Duplicate, "width" } }));
+
+    // Short lists without a slot table use a set on the stack.
+    test () expect (pick({ { "a", 1 }, { "b", 2 }, { "c", 3 } }, "c") == 3);
+    test () expect (reports({ }));
+
+    test () expect (pick({ { "a", 1 }, { "b", 2 }, { "a", 3 }, { "b", 4 }, { "a", 5 } }, "a") == 1);
+    test () expect (reports({ { KeyError::Duplicate, "a" }, { KeyError::Duplicate, "b" }, { KeyError::Duplicate, "a" } }));
+
+    // Longer lists are indexed at once, and the index finds duplicates.
+    test () expect (pick({ { "a", 1 }, { "b", 2 }, { "c", 3 }, { "d", 4 }, { "e", 5 }, { "f", 6 }, { "g", 7 }, { "h", 8 }, { "i", 9 } }, "i") == 9);
+    test () expect (reports({ }));
+
+    test () expect (pick({ { "a", 1 }, { "b", 2 }, { "c", 3 }, { "d", 4 }, { "e", 5 }, { "f", 6 }, { "g", 7 }, { "h", 8 }, { "c", 9 } }, "c") == 3);
+    test () expect (reports({ { KeyError::Duplicate, "c" } }));
+
+    test () expect (pick({ }, "a") == -1);
+    test () expect (pick({ { "a", 1 } }, "a") == 1);
+    test () expect (reports({ }));
+
+    // nullptr restores the default handler.
+    test () expect (kwargs::setKeyErrorHandler(nullptr) == &record);
+    test () expect (kwargs::setKeyErrorHandler(nullptr) == &kwargs::detail::default_key_error_handler);
+
+    // Without a handler of its own, a release build ignores the bad key.
+    test () expect (pick_listed({ { "width", 1 }, { "depth", 2 } }, "width") == 1);
+    test () expect (reports({ }));
+
+    return testing_completed;
+}
@@ -0,0 +1,29 @@
+#include "test.h"
+
+static int pick(Kwargs<"size"_opt, "width"_opt, "height"_opt, "depth"_opt> __kwargs, KwargsKey32 __key)
+{
+    return __kwargs[__key].valueOr<int>(-1);
+}
+
+int main()
+{
+    static_assert(sizeof(KwargsKey32) == 4);
+
+    static_assert(KwargsKey32("width") == KwargsKey32("width"_opt));
+    static_assert(KwargsKey32("width") == KwargsKey32(KwargsKey("width")));
+    static_assert(KwargsKey32("width") != KwargsKey32("height"));
+    static_assert(KwargsKey32("width").value() == kwargs::detail::string_hash_fold32("width"_opt));
+
+    // The OptionalList is checked for colliding hashes at compile time.
+    static_assert(kwargs::detail::string_hashes_distinct<false, "size"_opt, "width"_opt, "height"_opt>());
+    static_assert(kwargs::detail::string_hashes_distinct<true, "size"_opt, "width"_opt, "height"_opt>());
+    static_assert(kwargs::detail::string_hashes_distinct<false, "size"_opt, "width"_opt, "size"_opt>() == false);
+
+    test (std::string s = "height") expect (KwargsKey32(s.data(), s.size()) == KwargsKey32("height"));
+
+    test () expect (pick({ { "width", 3 }, { "height", 4 } }, KwargsKey32("height")) == 4);
+    test () expect (pick({ { "width", 3 }, { "height", 4 } }, KwargsKey32("width"_opt)) == 3);
+    test () expect (pick({ { "width", 3 }, { "height", 4 } }, KwargsKey32("depth")) == -1);
+
+    return testing_completed;
+}
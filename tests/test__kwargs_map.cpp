@@ -0,0 +1,188 @@
+#include "test.h"
+
+#include <stdexcept>
+#include <vector>
+
+// Counts the live copies, so that a KwargsMap is seen to destroy each one once.
+struct Counted
+{
+    static inline int live = 0;
+
+    int id;
+
+    Counted(int __id) noexcept : id(__id) { ++live; }
+    Counted(const Counted& __other) noexcept : id(__other.id) { ++live; }
+    ~Counted() noexcept { --live; }
+
+    Counted& operator=(const Counted&) noexcept = default;
+};
+
+struct ThrowsOnCopy
+{
+    ThrowsOnCopy() noexcept = default;
+    ThrowsOnCopy(const ThrowsOnCopy&) { throw std::runtime_error("ThrowsOnCopy"); }
+
+    ThrowsOnCopy& operator=(const ThrowsOnCopy&) noexcept = default;
+};
+
+struct alignas(64) OverAligned
+{
+    int value;
+};
+
+static KwargsMap freeze(Kwargs<> __kwargs)
+{
+    return __kwargs;
+}
+
+static KwargsMap freeze_listed(Kwargs<"size"_opt, "name"_opt> __kwargs)
+{
+    return __kwargs;
+}
+
+static bool outlives_referenced_objects()
+{
+    KwargsMap map;
+
+    {
+        std::string name = "huanhuanonly";
+        std::vector<int> list = { 1, 2, 3 };
+
+        map = freeze({ { "name", name }, { "list", list }, { "temporary", std::string("kwargs") } });
+
+        name = "changed";
+        list.clear();
+    }
+
+    return map["name"].valueOr<std::string>() == "huanhuanonly"
+        && map["list"].valueOr<std::vector<int>>() == std::vector<int>{ 1, 2, 3 }
+        && map["temporary"].valueOr<std::string>() == "kwargs";
+}
+
+static KwargsKey key_of(const std::string& __name)
+{
+    return KwargsKey(__name.data(), __name.size());
+}
+
+static bool builds_incrementally()
+{
+    KwargsMap map;
+
+    for (int i = 0; i < 100; ++i)
+    {
+        if (map.insert(key_of(std::to_string(i)), std::to_string(i * i)) == false)
+        {
+            return false;
+        }
+    }
+
+    bool result = map.size() == 100 && map.insert("7", 0) == false;
+
+    for (int i = 0; i < 100; ++i)
+    {
+        result = result && map[key_of(std::to_string(i))].valueOr<int>() == i * i;
+    }
+
+    return result && map.begin()[42].first == KwargsKey("42") && map["100"].hasValue() == false;
+}
+
+static bool destroys_each_copy()
+{
+    {
+        Counted original(7);
+
+        KwargsMap map = freeze({ { "a", original }, { "b", Counted(8) } });
+        KwargsMap copy = map;
+
+        map.insert("c", Counted(9));
+
+        KwargsMap moved = std::move(map);
+
+        if (Counted::live != 6 || moved["c"]->reference<Counted>().id != 9 || copy["a"]->reference<Counted>().id != 7)
+        {
+            return false;
+        }
+    }
+
+    return Counted::live == 0;
+}
+
+// A value that lives in the map itself is copied before a full map drops its old block.
+static bool inserts_its_own_value()
+{
+    KwargsMap map = freeze({ { "a", std::string(50, 'a') } });
+
+    for (int i = 0; i < 10; ++i)
+    {
+        if (map.insert(key_of(std::to_string(i)), *map["a"]) == false)
+        {
+            return false;
+        }
+    }
+
+    return map.size() == 11 && map["9"].valueOr<std::string>() == std::string(50, 'a');
+}
+
+// A copy that throws leaves no copies or block behind, and leaves an existing map as it was.
+static bool cleans_up_after_a_throwing_copy()
+{
+    const std::string text(200, 't');
+    const Counted counted(1);
+    const ThrowsOnCopy thrower;
+
+    int thrown = 0;
+
+    try
+    {
+        KwargsMap map = freeze({ { "text", text }, { "counted", counted }, { "thrower", thrower } });
+    }
+    catch (const std::runtime_error&)
+    {
+        ++thrown;
+    }
+
+    KwargsMap map = freeze({ { "text", text }, { "counted", counted } });
+
+    try
+    {
+        map.insert("thrower", thrower);
+    }
+    catch (const std::runtime_error&)
+    {
+        ++thrown;
+    }
+
+    return thrown == 2 && Counted::live == 2 && map.size() == 2
+        && map["text"].valueOr<std::string>() == text && map["thrower"].hasValue() == false;
+}
+
+int main()
+{
+    test () expect (KwargsMap().empty());
+    test () expect (KwargsMap()["a"].hasValue() == false);
+
+    test () expect (freeze({ { "size", 18 }, { "name", "huanhuanonly" } })["size"].valueOr<int>() == 18);
+    test () expect (freeze({ { "size", 18 }, { "name", "huanhuanonly" } })["name"].valueOr<std::string>() == "huanhuanonly");
+    test () expect (freeze({ { "size", 18 }, { "name", "huanhuanonly" } })["color"].valueOr<int>(-1) == -1);
+    test () expect (freeze({ { "size", 18 }, { "name", "huanhuanonly" } })["n"_opt or "name"].valueOr<std::string>() == "huanhuanonly");
+    test () expect (freeze({ { "size", 18 }, { "name", "huanhuanonly" } }).size() == 2);
+
+    test () expect (freeze_listed({ { "name", std::string("kwargs") } })["name"].valueOr<std::string>() == "kwargs");
+
+    test () expect (outlives_referenced_objects());
+    test () expect (builds_incrementally());
+    test () expect (destroys_each_copy());
+    test () expect (cleans_up_after_a_throwing_copy());
+    test () expect (inserts_its_own_value());
+
+    // Over-aligned objects are kept as KwargsValue keeps them.
+    test () expect (freeze({ { "aligned", OverAligned{ 5 } } })["aligned"]->reference<OverAligned>().value == 5);
+
+#if defined(NDEBUG)
+    // The first of duplicate keys is kept.
+    test () expect (freeze({ { "a", 1 }, { "b", 2 }, { "a", 3 } })["a"].valueOr<int>() == 1);
+    test () expect (freeze({ { "a", 1 }, { "b", 2 }, { "a", 3 } }).size() == 2);
+#endif
+
+    return testing_completed;
+}
@@ -0,0 +1,89 @@
+#include "test.h"
+
+#include <vector>
+
+struct FontOptions
+{
+    std::string faceName;
+    int size;
+    char style;
+    bool italic;
+};
+
+using FontSchema = KwargsSchema<
+    Param<"name"_opt, std::string>,
+    Param<"size"_opt, int, 9>,
+    Param<"style"_opt, char, 'r'>,
+    Param<"italic"_opt, bool, false>>;
+
+static std::vector<std::pair<KeyError, KwargsKey>> errors;
+
+static void record(KeyError __error, KwargsKey __key)
+{
+    errors.emplace_back(__error, __key);
+}
+
+static FontOptions font(FontSchema __kwargs = { })
+{
+    return __kwargs.as<FontOptions>();
+}
+
+int main()
+{
+    static_assert(std::is_same_v<FontSchema::tuple_type, std::tuple<std::string, int, char, bool>>);
+
+    test () expect (font().faceName.empty());
+    test () expect (font().size == 9);
+    test () expect (font().style == 'r');
+    test () expect (font().italic == false);
+
+    test () expect (font({ { "name", "Arial" }, { "italic", true } }).faceName == "Arial");
+    test () expect (font({ { "name", "Arial" }, { "italic", true } }).italic);
+    test () expect (font({ { "name", "Arial" }, { "italic", true } }).size == 9);
+
+    // Converted to the type of each Param.
+    test () expect (font({ "size"_opt = "18", "italic"_opt = "true" }).size == 18);
+    test () expect (font({ { "size", 18.8 }, "style"_opt = "bold" }).size == 18);
+    test () expect (font({ { "size", 18.8 }, "style"_opt = "bold" }).style == 'b');
+    test () expect (font({ { "size", 18.8 }, "style"_opt = "bold" }).italic == false);
+
+    test () expect (FontSchema({ { "size", 12 } }).get<"size"_opt>() == 12);
+    test () expect (FontSchema({ { "size", 12 } }).get<"style"_opt>() == 'r');
+    test () expect (FontSchema({ { "name", "Arial" } }).get<"name"_opt>() == "Arial");
+    test () expect (std::get<1>(FontSchema({ { "size", 12 } }).values()) == 12);
+
+    // A missing key yields the default of its Param.
+    test () expect (FontSchema({ { "name", "Arial" } }).get<"size"_opt>() == Param<"size"_opt, int, 9>::default_value());
+    test () expect (Param<"size"_opt, int, 9>::default_value() == 9);
+    test () expect (Param<"size"_opt, int>::default_value() == 0);
+    static_assert(noexcept(Param<"size"_opt, int, 9>::default_value()));
+
+    const kwargs::KeyErrorHandler previous = kwargs::setKeyErrorHandler(&record);
+
+    // Of a repeated key the first is kept, as Kwargs finds it.
+    test () expect (FontSchema({ { "size", 12 }, { "size", 24 } }).get<"size"_opt>() == 12);
+    test () expect (FontSchema({ { "size", 12 }, { "name", "Arial" }, { "size", 24 } }).get<"name"_opt>() == "Arial");
+    test () expect (FontSchema({ { "size", 12 }, { "size", 24 } }).get<"size"_opt>() == Kwargs<>({ { "size", 12 }, { "size", 24 } })["size"].valueOr<int>());
+
+    errors.clear();
+
+    // Unknown and duplicate keys go to the KeyErrorHandler, as for Kwargs.
+    test () expect (FontSchema({ { "size", 12 }, { "color", 1 }, { "size", 24 } }).get<"size"_opt>() == 12);
+
+    if constexpr (kwargs::detail::validate_keys)
+    {
+        test () expect (errors == (std::vector<std::pair<KeyError, KwargsKey>>{ { KeyError::Unknown, "color" }, { KeyError::Duplicate, "size" } }));
+    }
+    else
+    {
+        test () expect (errors.empty());
+    }
+
+    kwargs::setKeyErrorHandler(previous);
+
+#if defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+    test () expect (KwargsSchema<Param<"ratio"_opt, double, 1.5>>().get<"ratio"_opt>() == 1.5);
+#endif
+
+    return testing_completed;
+}
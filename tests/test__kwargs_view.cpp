@@ -0,0 +1,185 @@
+#include "test.h"
+
+using kwargs::alias;
+using kwargs::without;
+
+using FontOptions = Kwargs<"font"_opt, "size"_opt>;
+using LabelOptions = Kwargs<"text"_opt, "font"_opt, "size"_opt, "color"_opt>;
+
+static std::string describe_font(FontOptions __kwargs)
+{
+    return __kwargs["font"].valueOr<std::string>("-") + '/' + __kwargs["size"].valueOr<std::string>("-");
+}
+
+static std::string describe_rest(Kwargs<without, "size"_opt> __kwargs)
+{
+    return __kwargs["text"].valueOr<std::string>("-") + '/' + __kwargs["font"].valueOr<std::string>("-")
+        + '/' + __kwargs["color"].valueOr<std::string>("-");
+}
+
+static bool forwards_from_label(LabelOptions __kwargs)
+{
+    // The view shares the values of the list.
+    const bool shared = __kwargs.only<"font"_opt, "size"_opt>()["font"].operator->() == __kwargs["font"].operator->();
+
+    // The text is hidden, and so is a key outside the OptionalList of the source.
+    const bool hidden = __kwargs.only<"text"_opt, "size"_opt>()["text"].hasValue()
+        && __kwargs.only<"font"_opt, "size"_opt, "weight"_opt>()["weight"].hasValue() == false
+        && __kwargs.except<"text"_opt>()["text"].hasValue() == false
+        && __kwargs.except<"text"_opt>()["color"].hasValue();
+
+    return shared && hidden && describe_font(__kwargs.only<"font"_opt, "size"_opt>()) == "Arial/18";
+}
+
+static std::string forward_open(Kwargs<> __kwargs)
+{
+    return describe_font(__kwargs.only<"font"_opt, "size"_opt>()) + ' ' + describe_rest(__kwargs.except<"size"_opt>());
+}
+
+static bool composes(Kwargs<> __kwargs)
+{
+    auto view = __kwargs.except<"font"_opt>().only<"font"_opt, "size"_opt>();
+    auto narrowed = __kwargs.only<"text"_opt, "font"_opt, "size"_opt, "color"_opt>().except<"size"_opt>().except<"text"_opt>();
+
+    return view["font"].hasValue() == false && view["size"].valueOr<int>() == 18
+        && narrowed["size"].hasValue() == false && narrowed["text"].hasValue() == false && narrowed["font"].hasValue();
+}
+
+static bool chains_without_a_slot_table(Kwargs<> __kwargs)
+{
+    // Each except() adds its keys to the type of the view before it, so no key is shown again.
+    auto view = __kwargs.except<"a"_opt>().except<"b"_opt>();
+    auto again = view.except<"a"_opt>();
+    auto deeper = view.except<"c"_opt>().except<"d"_opt>();
+
+    return view["a"].valueOr<int>(-1) == -1 && view["b"].valueOr<int>(-1) == -1 && view["c"].valueOr<int>() == 3
+        && again["a"].valueOr<int>(-1) == -1 && again["c"].valueOr<int>() == 3
+        && deeper["a"].hasValue() == false && deeper["b"].hasValue() == false && deeper["c"].hasValue() == false
+        && deeper["d"].hasValue() == false;
+}
+
+static bool chains_deeply(Kwargs<> __kwargs)
+{
+    auto view = __kwargs.except<"a"_opt>().except<"b"_opt>().except<"c"_opt>().except<"d"_opt>().except<"e"_opt>();
+
+    static_assert(std::is_same_v<decltype(view), Kwargs<without, "a"_opt, "b"_opt, "c"_opt, "d"_opt, "e"_opt>>);
+
+    // A plain Kwargs keeps no filter.
+    static_assert(sizeof(view) == sizeof(__kwargs));
+
+    return view["f"].valueOr<int>() == 6 && view["e"].hasValue() == false && view["a"].hasValue() == false;
+}
+
+static bool hides_aliases(Kwargs<> __kwargs)
+{
+    // "pt" is an alias of "size", so excluding "size" hides it as well.
+    return __kwargs.only<"size"_opt, alias, "pt"_opt>()["size"].valueOr<int>() == 12
+        && __kwargs.only<"size"_opt>()["size"].hasValue() == false
+        && __kwargs.only<"font"_opt, "size"_opt, alias, "pt"_opt>().except<"size"_opt>()["pt"].hasValue() == false
+        && __kwargs.only<"font"_opt, "size"_opt, alias, "pt"_opt>().except<"font"_opt>()["size"].valueOr<int>() == 12
+        && __kwargs.except<"size"_opt, alias, "pt"_opt>()["pt"].hasValue() == false;
+}
+
+static bool respects_filters_everywhere(Kwargs<> __kwargs)
+{
+    auto view = __kwargs.except<"text"_opt>();
+
+    static LookupCache cache;
+
+    const bool cached = __kwargs.cached("text", cache).hasValue() && view.cached("text", cache).hasValue() == false;
+
+    const auto [text, font] = view.extract<"text"_opt, "font"_opt>();
+    const auto runtime = view.extract("text", "font");
+
+    const KwargsMap map = view;
+
+    return cached && text.hasValue() == false && font.hasValue() && runtime[0].hasValue() == false && runtime[1].hasValue()
+        && map.size() == 1 && map["font"].valueOr<std::string>() == "Arial";
+}
+
+template<typename _Kwargs>
+static std::string keys_of(const _Kwargs& __kwargs)
+{
+    std::string result;
+
+    for (const auto& [key, value] : __kwargs)
+    {
+        result += value.template value<std::string>();
+    }
+
+    return result + '#' + std::to_string(__kwargs.size());
+}
+
+static bool iterates_shown_pairs(LabelOptions __kwargs)
+{
+    return keys_of(__kwargs) == "tfsc#4"
+        && keys_of(__kwargs.only<"font"_opt, "size"_opt>()) == "fs#2"
+        && keys_of(__kwargs.only<"font"_opt, "weight"_opt>()) == "f#1"
+        && keys_of(__kwargs.except<"text"_opt, "color"_opt>()) == "fs#2"
+        && keys_of(__kwargs.except<"text"_opt>().only<"text"_opt, "color"_opt>()) == "c#1";
+}
+
+static bool iterates_without_a_slot_table(Kwargs<> __kwargs)
+{
+    auto view = __kwargs.except<"text"_opt>().except<"size"_opt, alias, "pt"_opt>();
+
+    return keys_of(__kwargs) == "tfpc#4" && keys_of(view) == "fc#2"
+        && keys_of(__kwargs.except<"text"_opt, "font"_opt, "pt"_opt, "color"_opt>()) == "#0"
+        && std::distance(view.begin(), view.end()) == 2 && view.begin()->first == "font";
+}
+
+static void ignore_key_error(KeyError, KwargsKey)
+{ }
+
+static bool iterates_plain_lists_as_given(Kwargs<"a"_opt, "b"_opt> __kwargs)
+{
+    // Only views filter; a plain Kwargs iterates its whole list through pointers.
+    static_assert(std::is_same_v<Kwargs<"a"_opt, "b"_opt>::const_iterator, const Kwargs<"a"_opt, "b"_opt>::value_type*>);
+
+    return keys_of(__kwargs) == "acb#3" && __kwargs["c"].hasValue() == false;
+}
+
+static bool converts_views_back(LabelOptions __kwargs)
+{
+    auto view = __kwargs.except<"font"_opt>();
+
+    static_assert(std::is_same_v<decltype(view), decltype(view.except<"text"_opt>())>);
+    static_assert(std::is_same_v<decltype(view), decltype(__kwargs.only<"text"_opt, "font"_opt, "size"_opt, "color"_opt>())>);
+
+    // The plain Kwargs keeps the slots of the view, and iterates the whole list.
+    LabelOptions passed = view;
+
+    return passed["font"].hasValue() == false && passed["size"].valueOr<int>() == 18 && passed.size() == 3
+        && describe_font(__kwargs.only<"font"_opt, "size"_opt>().except<"font"_opt>()) == "-/18";
+}
+
+int main()
+{
+    test () expect (forwards_from_label({ { "text", "Hello" }, { "font", "Arial" }, { "size", 18 }, { "color", "red" } }));
+
+    test () expect (forward_open({ { "text", "Hello" }, { "font", "Arial" }, { "size", 18 } }) == "Arial/18 Hello/Arial/-");
+    test () expect (forward_open({ { "color", "red" } }) == "-/- -/-/red");
+    test () expect (forward_open({ }) == "-/- -/-/-");
+
+    test () expect (composes({ { "text", "Hello" }, { "font", "Arial" }, { "size", 18 } }));
+
+    test () expect (chains_without_a_slot_table({ { "a", 1 }, { "b", 2 }, { "c", 3 }, { "d", 4 } }));
+
+    test () expect (chains_deeply({ { "a", 1 }, { "e", 5 }, { "f", 6 } }));
+
+    test () expect (hides_aliases({ { "pt", 12 }, { "font", "Arial" } }));
+
+    test () expect (respects_filters_everywhere({ { "text", "Hello" }, { "font", "Arial" } }));
+
+    test () expect (iterates_shown_pairs({ { "text", "t" }, { "font", "f" }, { "size", "s" }, { "color", "c" } }));
+    test () expect (iterates_without_a_slot_table({ { "text", "t" }, { "font", "f" }, { "pt", "p" }, { "color", "c" } }));
+
+    // The unknown key is reported and kept.
+    kwargs::setKeyErrorHandler(&ignore_key_error);
+    test () expect (iterates_plain_lists_as_given({ { "a", "a" }, { "c", "c" }, { "b", "b" } }));
+    kwargs::setKeyErrorHandler(nullptr);
+
+    test () expect (converts_views_back({ { "text", "Hello" }, { "font", "Arial" }, { "size", 18 } }));
+
+    return testing_completed;
+}
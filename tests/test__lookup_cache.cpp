@@ -0,0 +1,73 @@
+#include "test.h"
+
+static int size_of(Kwargs<> __kwargs)
+{
+    static LookupCache cache;
+    return __kwargs.cached("size", cache).valueOr<int>(-1);
+}
+
+static int pick(Kwargs<"a"_opt, "b"_opt, "c"_opt> __kwargs, KwargsKey __key, LookupCache& __cache)
+{
+    return __kwargs.cached(__key, __cache).valueOr<int>(-1);
+}
+
+static int pick_open(Kwargs<> __kwargs, KwargsKey __key, LookupCache& __cache)
+{
+    return __kwargs.cached(__key, __cache).valueOr<int>(-1);
+}
+
+static void ignore_key_error(KeyError, KwargsKey)
+{ }
+
+int main()
+{
+    test () expect (size_of({ { "name", "Arial" }, { "size", 9 } }) == 9);
+    test () expect (size_of({ { "name", "Arial" }, { "size", 10 } }) == 10);
+    test () expect (size_of({ { "size", 11 }, { "name", "Arial" } }) == 11);
+    test () expect (size_of({ { "name", "Arial" } }) == -1);
+    test () expect (size_of({ }) == -1);
+
+    LookupCache cache;
+
+    test () expect (cache.hits() == 0 && cache.misses() == 0);
+
+    // The first lookup searches; the same order then hits.
+    test () expect (pick({ { "a", 1 }, { "b", 2 }, { "c", 3 } }, "c", cache) == 3);
+    test () expect (cache.misses() == 1);
+    test () expect (pick({ { "a", 4 }, { "b", 5 }, { "c", 6 } }, "c", cache) == 6);
+    test () expect (pick({ { "b", 5 }, { "a", 4 }, { "c", 7 } }, "c", cache) == 7);
+    test () expect (cache.hits() == 2);
+
+    // Another order misses once and is remembered.
+    test () expect (pick({ { "c", 8 } }, "c", cache) == 8);
+    test () expect (pick({ { "c", 9 }, { "a", 1 } }, "c", cache) == 9);
+    test () expect (cache.hits() == 3 && cache.misses() == 2);
+
+    // A missing key is never a hit.
+    test () expect (pick({ { "a", 1 }, { "b", 2 } }, "c", cache) == -1);
+    test () expect (cache.hits() == 3 && cache.misses() == 3);
+
+    cache.resetCounters();
+    test () expect (cache.hits() == 0 && cache.misses() == 0);
+
+    // Also without an OptionalList, and with a position past the end of a shorter list.
+    test () expect (pick_open({ { "x", 1 }, { "y", 2 }, { "z", 3 } }, "z", cache) == 3);
+    test () expect (pick_open({ { "z", 4 } }, "z", cache) == 4);
+    test () expect (pick_open({ { "x", 1 }, { "z", 5 } }, "z", cache) == 5);
+    test () expect (pick_open({ { "y", 1 }, { "z", 6 } }, "z", cache) == 6);
+    test () expect (cache.hits() == 1 && cache.misses() == 3);
+
+    // A remembered position behind an earlier duplicate of the key is not taken.
+    kwargs::setKeyErrorHandler(&ignore_key_error);
+
+    LookupCache duplicated;
+
+    test () expect (pick_open({ { "x", 0 }, { "a", 1 } }, "a", duplicated) == 1);
+    test () expect (pick_open({ { "a", 2 }, { "a", 3 } }, "a", duplicated) == 2);
+    test () expect (pick_open({ { "a", 2 }, { "a", 3 } }, "a", duplicated) == 2);
+    test () expect (duplicated.hits() == 1 && duplicated.misses() == 2);
+
+    kwargs::setKeyErrorHandler(nullptr);
+
+    return testing_completed;
+}
@@ -0,0 +1,58 @@
+#include "test.h"
+
+using Options = Kwargs<"size"_opt, "width"_opt, "height"_opt, "depth"_opt, "color"_opt, "title"_opt, "visible"_opt>;
+
+static int pick(Options __kwargs, KwargsKey __key)
+{
+    return __kwargs[__key].valueOr<int>(-1);
+}
+
+static int pick_alias(Options __kwargs)
+{
+    return __kwargs["w"_opt or "width"].valueOr<int>(-1);
+}
+
+static int pick_first(Kwargs<"size"_opt> __kwargs)
+{
+    return __kwargs["size"].valueOr<int>(-1);
+}
+
+int main()
+{
+    // A non-empty OptionalList gets a slot for each key.
+    static_assert(kwargs::detail::key_slot_table<"size"_opt, "width"_opt, "height"_opt, "depth"_opt, "color"_opt, "title"_opt, "visible"_opt>::layout.perfect);
+    static_assert(sizeof(Options) > sizeof(Kwargs<>::container_type));
+
+    // The fewest slots come first, and each holds a 16-bit position rather than a pointer.
+    static_assert(kwargs::detail::key_slot_table<"size"_opt, "width"_opt, "height"_opt, "depth"_opt, "color"_opt, "title"_opt, "visible"_opt>::size <= 16);
+    static_assert(sizeof(Options) <= sizeof(Kwargs<>::container_type) + 16 * sizeof(std::uint16_t));
+
+    // Without an OptionalList there are no slots, only a signature.
+    static_assert(sizeof(Kwargs<>) == sizeof(Kwargs<>::container_type) + sizeof(KwargsKey) * kwargs::detail::packed_key_capacity
+        + sizeof(kwargs::detail::kwargs_key_signature<true>) + (kwargs::detail::key_index_threshold != 0 ? sizeof(std::uint32_t*) : 0));
+
+    // Without KWARGS_KEY_INDEX_THRESHOLD a Kwargs is copied as its bytes.
+    static_assert(std::is_trivially_copyable_v<Options>);
+    static_assert(std::is_trivially_copyable_v<Kwargs<>> == (kwargs::detail::key_index_threshold == 0));
+
+    test () expect (pick({ { "width", 3 }, { "height", 4 } }, "width") == 3);
+    test () expect (pick({ { "width", 3 }, { "height", 4 } }, "height"_opt) == 4);
+    test () expect (pick({ { "width", 3 }, { "height", 4 } }, "depth") == -1);
+    test () expect (pick({ }, "size") == -1);
+    test () expect (pick({ { "visible", true }, { "title", "kwargs" }, { "size", 10 } }, "size") == 10);
+
+    // Keys that are not in the OptionalList are never found.
+    test () expect (pick({ { "width", 3 } }, "old") == -1);
+    test () expect (pick({ { "width", 3 } }, KwargsKey()) == -1);
+
+    // Runtime keys.
+    test (std::string s = "height") expect (pick({ { "height", 4 } }, KwargsKey(s.data(), s.size())) == 4);
+
+    test () expect (pick_alias({ { "width", 5 } }) == 5);
+    test () expect (pick_alias({ { "height", 5 } }) == -1);
+
+    test () expect (pick_first({ { "size", 1 } }) == 1);
+    test () expect (pick_first({ }) == -1);
+
+    return testing_completed;
+}
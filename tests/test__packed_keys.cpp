@@ -0,0 +1,68 @@
+#ifndef KWARGS_PACKED_KEY_CAPACITY
+#   define KWARGS_PACKED_KEY_CAPACITY 8
+#endif
+
+#include "test.h"
+
+#include <vector>
+
+static int pick(Kwargs<> __kwargs, KwargsKey __key)
+{
+    return __kwargs[__key].valueOr<int>(-1);
+}
+
+static int pick_alias(Kwargs<> __kwargs)
+{
+    return __kwargs["w"_opt or "width"].valueOr<int>(-1);
+}
+
+int main()
+{
+    static_assert(kwargs::detail::packed_key_capacity == KWARGS_PACKED_KEY_CAPACITY);
+
+#if KWARGS_PACKED_KEY_CAPACITY != 0
+    // The packed array only exists without a slot table.
+    static_assert(sizeof(Kwargs<>) >= sizeof(Kwargs<>::container_type) + KWARGS_PACKED_KEY_CAPACITY * sizeof(KwargsKey));
+    static_assert(sizeof(Kwargs<"a"_opt>) < sizeof(Kwargs<>));
+#endif
+
+    test () expect (pick({ }, "a") == -1);
+    test () expect (pick({ { "a", 1 } }, "a") == 1);
+    test () expect (pick({ { "a", 1 }, { "b", 2 }, { "c", 3 } }, "c") == 3);
+    test () expect (pick({ { "a", 1 }, { "b", 2 }, { "c", 3 } }, "d") == -1);
+    test () expect (pick({ { "a", 1 }, { "b", 2 }, { "c", 3 }, { "d", 4 }, { "e", 5 }, { "f", 6 }, { "g", 7 }, { "h", 8 } }, "h") == 8);
+    test () expect (pick({ { "a", 1 }, { "b", 2 }, { "c", 3 }, { "d", 4 }, { "e", 5 }, { "f", 6 }, { "g", 7 }, { "h", 8 } }, "e") == 5);
+
+    // More keys than the capacity are scanned pair by pair.
+    test () expect (pick({ { "a", 1 }, { "b", 2 }, { "c", 3 }, { "d", 4 }, { "e", 5 }, { "f", 6 }, { "g", 7 }, { "h", 8 }, { "i", 9 } }, "i") == 9);
+    test () expect (pick({ { "a", 1 }, { "b", 2 }, { "c", 3 }, { "d", 4 }, { "e", 5 }, { "f", 6 }, { "g", 7 }, { "h", 8 }, { "i", 9 } }, "j") == -1);
+
+    test () expect (pick_alias({ { "x", 1 }, { "width", 2 } }) == 2);
+    test () expect (pick_alias({ { "w", 1 }, { "width", 2 } }) == 1);
+
+    // Every position and every length, with the key present once or absent.
+    std::vector<KwargsKey::value_type> keys(64);
+
+    for (std::size_t i = 0; i < keys.size(); ++i)
+    {
+        keys[i] = 0x1234'5678'0000'0000ULL + i * 0x1'0000'0001ULL;
+    }
+
+    bool all_found = true;
+
+    for (std::size_t size = 0; size <= keys.size(); ++size)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            all_found = all_found && kwargs::detail::find_packed_key(keys.data(), size, keys[i]) == i;
+        }
+
+        // Equal in either 32-bit half only.
+        all_found = all_found && kwargs::detail::find_packed_key(keys.data(), size, 0x1234'5678'0000'0001ULL) == size;
+        all_found = all_found && kwargs::detail::find_packed_key(keys.data(), size, 0x0000'0000'0000'0000ULL) == size;
+    }
+
+    test () expect (all_found);
+
+    return testing_completed;
+}
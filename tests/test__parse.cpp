@@ -0,0 +1,74 @@
+#include "test.h"
+
+#include <vector>
+
+int main()
+{
+    // ----- integers
+
+    test (auto res = kwargs::parse<int>("123")) expect (res && res.value == 123 && *res.ptr == '\0');
+    test (auto res = kwargs::parse<int>("  -123abc")) expect (res && res.value == -123 && *res.ptr == 'a');
+    test (auto res = kwargs::parse<int>("+ 42")) expect (res && res.value == 42);
+    test (auto res = kwargs::parse<int>("0x1F,")) expect (res && res.value == 0x1F && *res.ptr == ',');
+    test (auto res = kwargs::parse<int>("0b102")) expect (res && res.value == 0b10 && *res.ptr == '2');
+    test (auto res = kwargs::parse<int>("0x")) expect (res && res.value == 0 && *res.ptr == 'x');
+    test (auto res = kwargs::parse<int>("max ")) expect (res && res.value == std::numeric_limits<int>::max() && *res.ptr == ' ');
+    test (auto res = kwargs::parse<int>("maximum")) expect (res.ec == std::errc::invalid_argument);
+    test (auto res = kwargs::parse<bool>("true;")) expect (res && res.value == true && *res.ptr == ';');
+
+    std::string_view invalid = "  abc";
+
+    test (auto res = kwargs::parse<int>(invalid)) expect (res.ec == std::errc::invalid_argument && res.ptr == invalid.data() && res.value == 0);
+    test (auto res = kwargs::parse<int>(invalid.substr(0, 2))) expect (res.ec == std::errc::invalid_argument && res.ptr == invalid.data());
+    test (auto res = kwargs::parse<unsigned>("-1")) expect (res.ec == std::errc::invalid_argument);
+
+    // Overflow is reported instead of wrapping, and the whole number is consumed.
+    test (auto res = kwargs::parse<std::int8_t>("127")) expect (res && res.value == 127);
+    test (auto res = kwargs::parse<std::int8_t>("128")) expect (res.ec == std::errc::result_out_of_range && res.value == 127);
+    test (auto res = kwargs::parse<std::int8_t>("-128")) expect (res && res.value == -128);
+    test (auto res = kwargs::parse<std::int8_t>("-129")) expect (res.ec == std::errc::result_out_of_range && res.value == -128);
+    test (auto res = kwargs::parse<std::uint8_t>("0x100,")) expect (res.ec == std::errc::result_out_of_range && res.value == 255 && *res.ptr == ',');
+    test (auto res = kwargs::parse<bool>("2")) expect (res.ec == std::errc::result_out_of_range);
+    test (auto res = kwargs::parse<std::uint64_t>("18446744073709551615")) expect (res && res.value == std::numeric_limits<std::uint64_t>::max());
+    test (auto res = kwargs::parse<std::uint64_t>("18446744073709551616")) expect (res.ec == std::errc::result_out_of_range);
+    test (auto res = kwargs::parse<std::int64_t>("-9223372036854775808")) expect (res && res.value == std::numeric_limits<std::int64_t>::min());
+    test (auto res = kwargs::parse<std::int64_t>("9223372036854775808")) expect (res.ec == std::errc::result_out_of_range);
+    test (auto res = kwargs::parse<std::uint32_t>("000000000000000000000000000042")) expect (res && res.value == 42);
+
+    // ----- floating points
+
+    test (auto res = kwargs::parse<double>("1.5e3ms")) expect (res && res.value == 1500.0 && *res.ptr == 'm');
+    test (auto res = kwargs::parse<double>(" -.25,")) expect (res && res.value == -0.25 && *res.ptr == ',');
+    test (auto res = kwargs::parse<double>("2e+")) expect (res && res.value == 2.0 && *res.ptr == 'e');
+    test (auto res = kwargs::parse<double>("-inf ")) expect (res && res.value == -std::numeric_limits<double>::infinity() && *res.ptr == ' ');
+    test (auto res = kwargs::parse<double>("nan")) expect (res && res.value != res.value);
+    test (auto res = kwargs::parse<double>("1e400")) expect (res.ec == std::errc::result_out_of_range && res.value == std::numeric_limits<double>::infinity());
+    test (auto res = kwargs::parse<double>("1e-400")) expect (res.ec == std::errc::result_out_of_range && res.value == 0.0);
+    test (auto res = kwargs::parse<float>("1e39")) expect (res.ec == std::errc::result_out_of_range);
+    test (auto res = kwargs::parse<double>("0e999")) expect (res && res.value == 0.0);
+    test (auto res = kwargs::parse<double>(".")) expect (res.ec == std::errc::invalid_argument);
+    test (auto res = kwargs::parse<double>("e5")) expect (res.ec == std::errc::invalid_argument);
+
+    // ----- scanning a blob
+
+    std::string_view blob = "1, 22, 333, 4444";
+
+    std::vector<int> values;
+
+    for (const char* first = blob.data(), *last = first + blob.size(); first != last; )
+    {
+        auto res = kwargs::parse<int>(first, last);
+
+        if (not res)
+        {
+            break;
+        }
+
+        values.push_back(res.value);
+        first = res.ptr != last ? res.ptr + 1 : last;
+    }
+
+    test () expect (values == std::vector<int>{ 1, 22, 333, 4444 });
+
+    return testing_completed;
+}
@@ -0,0 +1,99 @@
+#include "test.h"
+
+#include <vector>
+#include <random>
+
+// Doubles a decimal digit array once per input bit.
+static std::string binary_to_decimal_by_bit(std::uint64_t __significand, int __shift)
+{
+    std::vector<int> digits(1, 0);
+
+    auto push_bit = [&digits](int bit) -> void {
+        int carry = bit;
+
+        for (auto& digit : digits)
+        {
+            int val = digit * 2 + carry;
+            digit = val % 10;
+            carry = val / 10;
+        }
+
+        if (carry)
+        {
+            digits.push_back(carry);
+        }
+    };
+
+    for (int i = 63; i >= 0; --i)
+    {
+        push_bit(static_cast<int>((__significand >> i) & 1));
+    }
+
+    for (int i = 0; i < __shift; ++i)
+    {
+        push_bit(0);
+    }
+
+    std::string result;
+
+    for (auto it = digits.rbegin(); it != digits.rend(); ++it)
+    {
+        result.push_back(static_cast<char>('0' + *it));
+    }
+
+    return result;
+}
+
+static std::string binary_to_decimal_by_limb(std::uint64_t __significand, int __shift)
+{
+    char buffer[400];
+    return std::string(buffer, kwargs::detail::binary_to_decimal_chars<64 + 1024>(buffer, __significand, __shift));
+}
+
+int main()
+{
+    disable_test_interrupts();
+
+    test () expect (binary_to_decimal_by_limb(0, 0) == "0");
+    test () expect (binary_to_decimal_by_limb(1, 0) == "1");
+    test () expect (binary_to_decimal_by_limb(1000000000, 0) == "1000000000");
+    test () expect (binary_to_decimal_by_limb(1, 64) == "18446744073709551616");
+    test () expect (binary_to_decimal_by_limb(0xFFFFFFFFFFFFFFFFULL, -60) == "15");
+    test () expect (binary_to_decimal_by_limb(1, -64) == "0");
+    test () expect (binary_to_decimal_by_limb(1, 100) == "1267650600228229401496703205376");
+
+    // DBL_MAX
+    test () expect (binary_to_decimal_by_limb(0x1FFFFFFFFFFFFFULL, 971) == binary_to_decimal_by_bit(0x1FFFFFFFFFFFFFULL, 971));
+
+    std::mt19937_64 rng(std::random_device{}());
+
+    std::vector<std::pair<std::uint64_t, int>> values(200);
+
+    for (auto& [significand, shift] : values)
+    {
+        significand = rng() | 1;
+        shift = static_cast<int>(rng() % 960);
+    }
+
+    std::vector<std::string> a(values.size()), b(values.size());
+
+    // ----- kwargs::detail::binary_to_decimal_chars
+
+    auto count_1 = measure([&]() -> void {
+        for (std::size_t i = 0; i < values.size(); ++i)
+            a[i] = binary_to_decimal_by_limb(values[i].first, values[i].second);
+    });
+
+    // ----- bit by bit
+
+    auto count_2 = measure([&]() -> void {
+        for (std::size_t i = 0; i < values.size(); ++i)
+            b[i] = binary_to_decimal_by_bit(values[i].first, values[i].second);
+    });
+
+    test () expect (a == b);
+
+    test () pursue (count_1 <= count_2);
+
+    return testing_completed;
+}
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <random>
+#include <cstring>
 
 static constexpr std::size_t size = sizeof(std::uint64_t) * 1'000'000 + sizeof(std::uint32_t) * 1 + sizeof(std::uint8_t) * 3;
 
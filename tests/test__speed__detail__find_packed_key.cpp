@@ -0,0 +1,68 @@
+#include "test.h"
+
+#include <vector>
+#include <random>
+
+// The scan of operator[] over the pairs of the list.
+static std::size_t find_pair_by_scan(const std::vector<Kwargs<>::value_type>& __pairs, std::size_t __size, KwargsKey __key) noexcept
+{
+    for (std::size_t i = 0; i < __size; ++i)
+    {
+        if (__pairs[i].first == __key)
+        {
+            return i;
+        }
+    }
+
+    return __size;
+}
+
+int main()
+{
+    disable_test_interrupts();
+
+    // A fixed seed, so that a failure can be reproduced.
+    std::mt19937_64 rng(20241017);
+
+    std::vector<KwargsKey::value_type> keys(64);
+    std::vector<Kwargs<>::value_type> pairs;
+
+    for (auto& key : keys)
+    {
+        key = rng();
+        pairs.emplace_back(KwargsKey(key), KwargsValue(0));
+    }
+
+    for (std::size_t size : { 1, 2, 4, 8, 16, 32, 64 })
+    {
+        // Half of the lookups miss.
+        std::vector<KwargsKey::value_type> lookups(100'000);
+
+        for (auto& key : lookups)
+        {
+            key = rng() % 2 ? keys[rng() % size] : rng();
+        }
+
+        std::vector<std::size_t> a(lookups.size()), b(lookups.size());
+
+        // ----- kwargs::detail::find_packed_key
+
+        auto count_1 = measure([&]() -> void {
+            for (std::size_t i = 0; i < lookups.size(); ++i)
+                a[i] = kwargs::detail::find_packed_key(keys.data(), size, lookups[i]);
+        });
+
+        // ----- pair by pair
+
+        auto count_2 = measure([&]() -> void {
+            for (std::size_t i = 0; i < lookups.size(); ++i)
+                b[i] = find_pair_by_scan(pairs, size, KwargsKey(lookups[i]));
+        });
+
+        test () expect (a == b);
+
+        test () pursue (size < 8 || count_1 <= count_2);
+    }
+
+    return testing_completed;
+}
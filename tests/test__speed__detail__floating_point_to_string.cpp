@@ -0,0 +1,115 @@
+#include "test.h"
+
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+int main()
+{
+    disable_test_interrupts();
+
+    test () expect (kwargs::detail::floating_point_to_string<std::string>(0.1) == "0.1");
+    test () expect (kwargs::detail::floating_point_to_string<std::string>(0.3) == "0.3");
+    test () expect (kwargs::detail::floating_point_to_string<std::string>(0.1 + 0.2) == "0.30000000000000004");
+    test () expect (kwargs::detail::floating_point_to_string<std::string>(1.0 / 3) == "0.3333333333333333");
+    test () expect (kwargs::detail::floating_point_to_string<std::string>(123.456) == "123.456");
+    test () expect (kwargs::detail::floating_point_to_string<std::string>(-2.5e-7) == "-0.00000025");
+    test () expect (kwargs::detail::floating_point_to_string<std::string>(1e21) == "1000000000000000000000");
+    test () expect (kwargs::detail::floating_point_to_string<std::string>(1e23) == "99999999999999991611392");
+    test () expect (kwargs::detail::floating_point_to_string<std::string>(0.1f) == "0.1");
+    test () expect (kwargs::detail::floating_point_to_string<std::string>(16777216.0f) == "16777216");
+    test () expect (kwargs::detail::floating_point_to_string<std::string>(3.4028235e38f) == "340282346638528859811704183484516925440");
+    test () expect (kwargs::detail::floating_point_to_string<std::string>(1e-45f) == "0.000000000000000000000000000000000000000000001");
+
+    // The smallest subnormal double.
+    test () expect (kwargs::detail::floating_point_to_string<std::string>(5e-324) == "0." + std::string(323, '0') + "5");
+
+    std::mt19937_64 rng(std::random_device{}());
+
+    std::vector<double> values;
+    values.reserve(50'000);
+
+    while (values.size() < values.capacity())
+    {
+        std::uint64_t bits = rng();
+        double value;
+
+        std::memcpy(&value, &bits, sizeof(value));
+
+        // Keep the strings short enough for a fair comparison with "%.17g".
+        if (value - value == 0 && std::abs(value) < 1e20 && std::abs(value) > 1e-20)
+        {
+            values.push_back(value);
+        }
+    }
+
+    std::vector<std::string> a(values.size()), b(values.size());
+
+    // ----- kwargs::detail::floating_point_to_string
+
+    auto count_1 = measure([&]() -> void {
+        for (std::size_t i = 0; i < values.size(); ++i)
+            a[i] = kwargs::detail::floating_point_to_string<std::string>(values[i]);
+    });
+
+    // ----- std::snprintf
+
+    auto count_2 = measure([&]() -> void {
+        char buffer[32];
+
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            std::snprintf(buffer, sizeof(buffer), "%.17g", values[i]);
+            b[i] = buffer;
+        }
+    });
+
+    auto significant_digits = [](std::string str) -> std::size_t {
+        str.erase(std::remove(str.begin(), str.end(), '.'), str.end());
+
+        const auto first = str.find_first_not_of("-0");
+        const auto last  = str.find_last_not_of('0');
+
+        return first == std::string::npos ? 0 : last - first + 1;
+    };
+
+    bool round_trip = true;
+    bool shortest = true;
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        round_trip &= (std::strtod(a[i].c_str(), nullptr) == values[i]);
+
+        // Larger integers are written with all of their digits.
+        if (std::abs(values[i]) >= 0x1p53)
+        {
+            continue;
+        }
+
+        char buffer[32];
+
+        int precision = 1;
+
+        for (; precision < 17; ++precision)
+        {
+            std::snprintf(buffer, sizeof(buffer), "%.*e", precision - 1, values[i]);
+
+            if (std::strtod(buffer, nullptr) == values[i])
+            {
+                break;
+            }
+        }
+
+        shortest &= (significant_digits(a[i]) <= static_cast<std::size_t>(precision));
+    }
+
+    test () expect (round_trip);
+    test () expect (shortest);
+
+    test () pursue (count_1 <= count_2);
+
+    return testing_completed;
+}
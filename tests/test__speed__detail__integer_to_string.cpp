@@ -0,0 +1,94 @@
+#include "test.h"
+
+#include <vector>
+#include <random>
+
+// One '%' and '/' by a runtime radix per digit.
+template<typename _Tp>
+static std::string integer_to_string_by_digit(_Tp __n, int __radix = 10)
+{
+    char buffer[sizeof(_Tp) * 8 + 1];
+    std::size_t cpos = sizeof(buffer);
+
+    bool sign = (std::is_signed_v<_Tp> && __n < 0);
+
+    while (__n)
+    {
+        buffer[--cpos] = kwargs::detail::integer_to_radix_character(static_cast<int>(kwargs::detail::abs(__n % __radix)));
+        __n /= static_cast<_Tp>(__radix);
+    }
+
+    if (sign)
+    {
+        buffer[--cpos] = '-';
+    }
+    else if (cpos == sizeof(buffer))
+    {
+        buffer[--cpos] = '0';
+    }
+
+    return std::string(buffer + cpos, sizeof(buffer) - cpos);
+}
+
+int main()
+{
+    disable_test_interrupts();
+
+    test () expect (kwargs::detail::integer_to_string<std::string>(0) == "0");
+    test () expect (kwargs::detail::integer_to_string<std::string>(-7) == "-7");
+    test () expect (kwargs::detail::integer_to_string<std::string>(100) == "100");
+    test () expect (kwargs::detail::integer_to_string<std::string>(std::numeric_limits<std::int64_t>::min()) == "-9223372036854775808");
+    test () expect (kwargs::detail::integer_to_string<std::string>(std::numeric_limits<std::uint64_t>::max()) == "18446744073709551615");
+    test () expect (kwargs::detail::integer_to_string<std::string>(std::int8_t(-128)) == "-128");
+    test () expect (kwargs::detail::integer_to_string<std::string>(0xDEADBEEFU, 16) == "DEADBEEF");
+    test () expect (kwargs::detail::integer_to_string<std::string>(-8, 8) == "-10");
+    test () expect (kwargs::detail::integer_to_string<std::string>(5, 2) == "101");
+    test () expect (kwargs::detail::integer_to_string<std::string>(std::numeric_limits<std::uint64_t>::max(), 2) == std::string(64, '1'));
+    test () expect (kwargs::detail::integer_to_string<std::string>(35, 36) == "Z");
+    test () expect (kwargs::detail::integer_to_string<std::string>(-1000, 7) == integer_to_string_by_digit(-1000, 7));
+
+    std::mt19937_64 rng(std::random_device{}());
+
+    std::vector<std::int64_t> values(200'000);
+
+    for (auto& v : values)
+    {
+        v = static_cast<std::int64_t>(rng() >> (rng() % 64));
+    }
+
+    std::vector<std::string> a(values.size()), b(values.size()), c(values.size()), d(values.size());
+
+    // ----- kwargs::detail::integer_to_string
+
+    auto count_1 = measure([&]() -> void {
+        for (std::size_t i = 0; i < values.size(); ++i)
+            a[i] = kwargs::detail::integer_to_string<std::string>(values[i]);
+    });
+
+    // ----- digit by digit
+
+    auto count_2 = measure([&]() -> void {
+        for (std::size_t i = 0; i < values.size(); ++i)
+            b[i] = integer_to_string_by_digit(values[i]);
+    });
+
+    // ----- radix 16
+
+    auto count_3 = measure([&]() -> void {
+        for (std::size_t i = 0; i < values.size(); ++i)
+            c[i] = kwargs::detail::integer_to_string<std::string>(values[i], 16);
+    });
+
+    auto count_4 = measure([&]() -> void {
+        for (std::size_t i = 0; i < values.size(); ++i)
+            d[i] = integer_to_string_by_digit(values[i], 16);
+    });
+
+    test () expect (a == b);
+    test () expect (c == d);
+
+    test () pursue (count_1 <= count_2);
+    test () pursue (count_3 <= count_4);
+
+    return testing_completed;
+}
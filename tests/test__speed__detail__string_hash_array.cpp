@@ -0,0 +1,55 @@
+#include "test.h"
+
+#include <vector>
+
+static int count_keys(Kwargs<"name"_opt, "old"_opt, "data"_opt> __kwargs)
+{
+    return static_cast<int>(__kwargs.size());
+}
+
+int main()
+{
+    disable_test_interrupts();
+
+    static_assert(kwargs::detail::string_hash_array("name") == "name"_opt);
+    static_assert(kwargs::detail::string_hash_array("an_option_name_longer_than_sixty_four_characters_goes_through_the_loop") == "an_option_name_longer_than_sixty_four_characters_goes_through_the_loop"_opt);
+
+    test () expect (KwargsKey("background_color") == "background_color"_opt);
+    test () expect (KwargsKey("") == KwargsKey(""_opt));
+
+    test () expect (count_keys({ { "name", "x" }, { "old", 18 } }) == 2);
+
+    constexpr std::size_t rounds = 200'000;
+
+    std::vector<KwargsKey::value_type> a(rounds), b(rounds), c(rounds);
+
+    // ----- KwargsKey(const char*, std::size_t)
+
+    const char* const name = "background_color";
+
+    auto count_1 = measure([&]() -> void {
+        for (std::size_t i = 0; i < rounds; ++i)
+            a[i] = KwargsKey(name, 16).value();
+    });
+
+    // ----- KwargsKey(const char (&)[_Size])
+
+    auto count_2 = measure([&]() -> void {
+        for (std::size_t i = 0; i < rounds; ++i)
+            b[i] = KwargsKey("background_color").value();
+    });
+
+    // ----- operator""_opt
+
+    measure([&]() -> void {
+        for (std::size_t i = 0; i < rounds; ++i)
+            c[i] = KwargsKey("background_color"_opt).value();
+    });
+
+    test () expect (a == b);
+    test () expect (b == c);
+
+    test () pursue (count_2 <= count_1);
+
+    return testing_completed;
+}
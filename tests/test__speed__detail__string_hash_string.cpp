@@ -0,0 +1,187 @@
+#include "test.h"
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <cctype>
+#include <random>
+#include <unordered_set>
+
+// Identifiers of the standard library and of typical option names.
+static const char* const identifiers[] = {
+    "size", "data", "name", "old", "class", "value", "values", "key", "keys", "type", "mode", "path",
+    "file", "filename", "directory", "timeout", "retries", "delay", "interval", "capacity", "length",
+    "width", "height", "depth", "color", "colour", "font", "font_size", "alignment", "padding", "margin",
+    "border", "visible", "enabled", "disabled", "readonly", "verbose", "quiet", "debug", "level",
+    "log_level", "logger", "format", "precision", "encoding", "locale", "language", "separator",
+    "delimiter", "prefix", "suffix", "begin", "end", "first", "last", "start", "stop", "step", "count",
+    "offset", "limit", "page", "page_size", "sort", "order", "ascending", "descending", "reverse",
+    "unique", "max", "min", "max_size", "min_size", "threshold", "tolerance", "epsilon", "seed",
+    "random", "shuffle", "batch_size", "epochs", "learning_rate", "momentum", "dropout", "activation",
+    "optimizer", "loss", "metrics", "callbacks", "host", "port", "user", "username", "password", "token",
+    "secret", "scheme", "url", "uri", "method", "headers", "body", "params", "query", "cookies", "proxy",
+    "verify", "cert", "stream", "allow_redirects", "max_redirects", "keep_alive", "compression",
+    "allocator", "hash", "key_equal", "compare", "pred", "predicate", "projection", "policy",
+    "execution", "thread", "threads", "num_threads", "workers", "queue", "queue_size", "priority",
+    "deadline", "callback", "handler", "on_error", "on_success", "on_complete", "context", "options",
+    "flags", "config", "settings", "profile", "version", "id", "uid", "gid", "pid", "parent", "child",
+    "children", "left", "right", "top", "bottom", "x", "y", "z", "w", "r", "g", "b", "a", "alpha",
+    "beta", "gamma", "lambda", "sigma", "mu", "scale", "rotation", "translation", "matrix", "vector",
+    "accumulate", "adjacent_find", "all_of", "any_of", "binary_search", "copy_if", "equal_range",
+    "find_if", "for_each", "generate_n", "inplace_merge", "is_sorted", "lower_bound", "upper_bound",
+    "make_heap", "max_element", "min_element", "minmax", "mismatch", "next_permutation", "none_of",
+    "nth_element", "partial_sort", "partition", "remove_if", "replace_if", "rotate_copy", "search_n",
+    "set_difference", "set_intersection", "set_union", "stable_partition", "stable_sort", "transform",
+    "unique_copy", "basic_string", "string_view", "unordered_map", "unordered_multimap", "shared_ptr",
+    "unique_ptr", "weak_ptr", "make_shared", "make_unique", "enable_shared_from_this", "optional",
+    "variant", "monostate", "any", "tuple", "pair", "array", "deque", "forward_list", "list", "map",
+    "multimap", "multiset", "set", "priority_queue", "stack", "bitset", "valarray", "complex", "ratio",
+    "duration", "time_point", "steady_clock", "system_clock", "high_resolution_clock", "mutex",
+    "recursive_mutex", "shared_mutex", "condition_variable", "lock_guard", "unique_lock", "scoped_lock",
+    "future", "promise", "packaged_task", "async", "atomic", "atomic_flag", "memory_order",
+    "Content-Type", "Content-Length", "Accept-Encoding", "User-Agent", "Cache-Control", "X-Request-Id"
+};
+
+// Every identifier of the header, for a larger corpus when the sources are available.
+static void harvest_identifiers(std::unordered_set<std::string>& __corpus)
+{
+    std::string path = __FILE__;
+    path = path.substr(0, path.find_last_of("/\\") + 1) + "../include/kwargs.h";
+
+    std::ifstream file(path);
+
+    std::string word;
+
+    for (char c; file.get(c); )
+    {
+        if (std::isalnum(static_cast<unsigned char>(c)) || c == '_')
+        {
+            word.push_back(c);
+        }
+        else if (not word.empty())
+        {
+            if (not std::isdigit(static_cast<unsigned char>(word.front())))
+            {
+                __corpus.insert(word);
+            }
+
+            word.clear();
+        }
+    }
+}
+
+template<typename _Policy>
+static std::size_t count_collisions(const std::vector<std::string>& __corpus)
+{
+    std::unordered_set<kwargs::detail::string_hash_type> hashes;
+
+    for (const auto& s : __corpus)
+    {
+        hashes.insert(kwargs::detail::string_hash_string<_Policy>(s));
+    }
+
+    return __corpus.size() - hashes.size();
+}
+
+int main()
+{
+    disable_test_interrupts();
+
+    using kwargs::detail::modular_string_hash;
+    using kwargs::detail::barrett_string_hash;
+    using kwargs::detail::multiply_xorshift_string_hash;
+
+    // The literal and the runtime constructor use the same policy.
+    static_assert("learning_rate"_opt == kwargs::detail::string_hash_string("learning_rate"));
+    static_assert('x'_opt == KwargsKey("x"));
+    static_assert(2024_opt == "2024"_opt);
+
+    static_assert(kwargs::detail::string_hash_string<barrett_string_hash>("accumulate") == kwargs::detail::string_hash_string<modular_string_hash>("accumulate"));
+    static_assert(kwargs::detail::string_hash_string<multiply_xorshift_string_hash>("\0", 1) != kwargs::detail::string_hash_string<multiply_xorshift_string_hash>(""));
+
+    std::unordered_set<std::string> unique(std::begin(identifiers), std::end(identifiers));
+    harvest_identifiers(unique);
+
+#if defined(KWARGS_KEY_CASE_INSENSITIVE)
+    // Names that differ only in case are the same key.
+    std::unordered_set<std::string> folded;
+
+    for (std::string s : unique)
+    {
+        for (char& c : s)
+        {
+            c = kwargs::detail::tolower(c);
+        }
+
+        folded.insert(std::move(s));
+    }
+
+    unique.swap(folded);
+#endif
+
+    std::vector<std::string> corpus(unique.begin(), unique.end());
+
+    test () expect (count_collisions<modular_string_hash>(corpus) == 0);
+    test () expect (count_collisions<barrett_string_hash>(corpus) == 0);
+    test () expect (count_collisions<multiply_xorshift_string_hash>(corpus) == 0);
+
+    // Barrett reduction gives exactly the values of the two divisions, also for non-ASCII characters.
+    std::mt19937_64 rng(std::random_device{}());
+
+    std::vector<std::string> strings(20'000);
+
+    for (auto& s : strings)
+    {
+        s.resize(rng() % 48);
+
+        for (char& c : s)
+        {
+            c = static_cast<char>(rng());
+        }
+    }
+
+    bool identical = true;
+
+    for (const auto& s : strings)
+    {
+        identical &= kwargs::detail::string_hash_string<barrett_string_hash>(s) == kwargs::detail::string_hash_string<modular_string_hash>(s);
+    }
+
+    test () expect (identical);
+
+    // Throughput over the corpus, repeated.
+    std::vector<kwargs::detail::string_hash_type> a(corpus.size()), b(corpus.size()), c(corpus.size());
+
+    constexpr int rounds = 8;
+
+    // ----- kwargs::detail::modular_string_hash
+
+    auto count_1 = measure([&]() -> void {
+        for (int round = 0; round < rounds; ++round)
+            for (std::size_t i = 0; i < corpus.size(); ++i)
+                a[i] = kwargs::detail::string_hash_string<modular_string_hash>(corpus[i]);
+    });
+
+    // ----- kwargs::detail::barrett_string_hash
+
+    auto count_2 = measure([&]() -> void {
+        for (int round = 0; round < rounds; ++round)
+            for (std::size_t i = 0; i < corpus.size(); ++i)
+                b[i] = kwargs::detail::string_hash_string<barrett_string_hash>(corpus[i]);
+    });
+
+    // ----- kwargs::detail::multiply_xorshift_string_hash
+
+    auto count_3 = measure([&]() -> void {
+        for (int round = 0; round < rounds; ++round)
+            for (std::size_t i = 0; i < corpus.size(); ++i)
+                c[i] = kwargs::detail::string_hash_string<multiply_xorshift_string_hash>(corpus[i]);
+    });
+
+    test () expect (a == b);
+
+    test () pursue (count_2 <= count_1);
+    test () pursue (count_3 <= count_1);
+
+    return testing_completed;
+}
@@ -0,0 +1,70 @@
+#include "test.h"
+
+#include <vector>
+#include <random>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+int main()
+{
+    disable_test_interrupts();
+
+    test () expect (kwargs::detail::string_to_floating_point<double>("0.1") == 0.1);
+    test () expect (kwargs::detail::string_to_floating_point<double>("1e23") == 1e23);
+    test () expect (kwargs::detail::string_to_floating_point<double>("2.2250738585072011e-308") == 2.2250738585072011e-308);
+    test () expect (kwargs::detail::string_to_floating_point<double>("2.4703282292062328e-324") == 4.9406564584124654e-324);
+    test () expect (kwargs::detail::string_to_floating_point<double>("1.7976931348623158e308") == std::numeric_limits<double>::max());
+    test () expect (kwargs::detail::string_to_floating_point<double>("1.7976931348623159e308") == std::numeric_limits<double>::infinity());
+    test () expect (kwargs::detail::string_to_floating_point<float>("3.4028235e38") == std::numeric_limits<float>::max());
+    test () expect (kwargs::detail::string_to_floating_point<float>("1.00000005960464477550") == 1.0000001f);
+
+    // More than 19 significant digits, exactly halfway between 2^53 and 2^53 + 2.
+    test () expect (kwargs::detail::string_to_floating_point<double>("9007199254740993.0000000000000000000") == 9007199254740992.0);
+    test () expect (kwargs::detail::string_to_floating_point<double>("9007199254740993.0000000000000000001") == 9007199254740994.0);
+
+    std::mt19937_64 rng(std::random_device{}());
+
+    std::vector<std::string> strings;
+    strings.reserve(100'000);
+
+    char buffer[32];
+
+    while (strings.size() < strings.capacity())
+    {
+        std::uint64_t bits = rng();
+        double value;
+
+        std::memcpy(&value, &bits, sizeof(value));
+
+        if (value - value != 0)
+        {
+            continue;
+        }
+
+        std::snprintf(buffer, sizeof(buffer), "%.*g", static_cast<int>(rng() % 17 + 1), value);
+        strings.emplace_back(buffer);
+    }
+
+    std::vector<double> a(strings.size()), b(strings.size());
+
+    // ----- kwargs::detail::string_to_floating_point
+
+    auto count_1 = measure([&]() -> void {
+        for (std::size_t i = 0; i < strings.size(); ++i)
+            a[i] = kwargs::detail::string_to_floating_point<double>(strings[i]);
+    });
+
+    // ----- std::strtod
+
+    auto count_2 = measure([&]() -> void {
+        for (std::size_t i = 0; i < strings.size(); ++i)
+            b[i] = std::strtod(strings[i].c_str(), nullptr);
+    });
+
+    test () expect (std::memcmp(a.data(), b.data(), a.size() * sizeof(double)) == 0);
+
+    test () pursue (count_1 <= count_2);
+
+    return testing_completed;
+}
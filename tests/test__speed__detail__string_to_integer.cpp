@@ -0,0 +1,92 @@
+#include "test.h"
+
+#include <vector>
+#include <random>
+
+template<typename _Tp>
+static _Tp string_to_integer_by_character(std::string_view __str) noexcept
+{
+    _Tp result = 0;
+
+    for (char c : __str)
+    {
+        if (kwargs::detail::is_radix_character(c, 10) == false)
+        {
+            break;
+        }
+
+        result = _Tp(result * _Tp(10) + _Tp(kwargs::detail::radix_character_to_integer(c)));
+    }
+
+    return result;
+}
+
+int main()
+{
+    disable_test_interrupts();
+
+    test () expect (kwargs::detail::string_to_integer<std::uint64_t>("18") == 18);
+    test () expect (kwargs::detail::string_to_integer<std::uint64_t>("4096") == 4096);
+    test () expect (kwargs::detail::string_to_integer<std::uint64_t>("12345678") == 12345678);
+    test () expect (kwargs::detail::string_to_integer<std::uint64_t>("1234567890123456") == 1234567890123456ULL);
+    test () expect (kwargs::detail::string_to_integer<std::uint64_t>("18446744073709551615") == 18446744073709551615ULL);
+    test () expect (kwargs::detail::string_to_integer<std::int64_t>("-9223372036854775808") == std::numeric_limits<std::int64_t>::min());
+    test () expect (kwargs::detail::string_to_integer<std::int32_t>("  -123456789  ") == -123456789);
+    test () expect (kwargs::detail::string_to_integer<std::uint32_t>("12345678.9") == 12345678U);
+    test () expect (kwargs::detail::string_to_integer<std::uint32_t>("1234x5678") == 1234U);
+    test () expect (kwargs::detail::string_to_integer<std::uint32_t>("0000000000000000000042") == 42U);
+
+    // Wrap-around must match the character-by-character loop.
+    test () expect (kwargs::detail::string_to_integer<std::uint8_t>("300") == string_to_integer_by_character<std::uint8_t>("300"));
+    test () expect (kwargs::detail::string_to_integer<std::uint16_t>("123456789012") == string_to_integer_by_character<std::uint16_t>("123456789012"));
+    test () expect (kwargs::detail::string_to_integer<std::uint64_t>("99999999999999999999999999999999") == string_to_integer_by_character<std::uint64_t>("99999999999999999999999999999999"));
+
+    std::mt19937_64 rng(std::random_device{}());
+
+    std::vector<std::string> strings(200'000);
+
+    for (auto& s : strings)
+    {
+        s = std::to_string(rng() >> (rng() % 64));
+    }
+
+    std::vector<std::uint64_t> a(strings.size()), b(strings.size()), c(strings.size());
+
+    // ----- kwargs::detail::parse_decimal_digits_fast
+
+    auto count_1 = measure([&]() -> void {
+        for (std::size_t i = 0; i < strings.size(); ++i)
+        {
+            std::uint64_t result = 0;
+
+            const char* last = strings[i].data() + strings[i].size();
+            const char* it = kwargs::detail::parse_decimal_digits_fast(strings[i].data(), last, result);
+
+            for (; it != last && static_cast<unsigned char>(*it - '0') < 10; ++it)
+                result = result * 10 + static_cast<std::uint64_t>(*it - '0');
+
+            a[i] = result;
+        }
+    });
+
+    // ----- character by character
+
+    auto count_2 = measure([&]() -> void {
+        for (std::size_t i = 0; i < strings.size(); ++i)
+            b[i] = string_to_integer_by_character<std::uint64_t>(strings[i]);
+    });
+
+    // ----- kwargs::detail::string_to_integer
+
+    measure([&]() -> void {
+        for (std::size_t i = 0; i < strings.size(); ++i)
+            c[i] = kwargs::detail::string_to_integer<std::uint64_t>(strings[i]);
+    });
+
+    test () expect (a == b);
+    test () expect (c == b);
+
+    test () pursue (count_1 <= count_2);
+
+    return testing_completed;
+}
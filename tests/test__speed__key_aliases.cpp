@@ -0,0 +1,75 @@
+#include "test.h"
+
+#include <vector>
+#include <random>
+
+using kwargs::alias;
+
+using Options = Kwargs<
+    "name"_opt, alias, "n"_opt, alias, "lastname"_opt, alias, "surname"_opt,
+    "width"_opt, alias, "w"_opt, alias, "cx"_opt, alias, "x_size"_opt,
+    "height"_opt, alias, "h"_opt, alias, "cy"_opt, alias, "y_size"_opt,
+    "color"_opt, "border"_opt, "visible"_opt>;
+
+static void run(Options __options, Kwargs<> __kwargs, const std::vector<int>& __picks)
+{
+    std::vector<const KwargsValue*> a(__picks.size()), b(__picks.size());
+
+    // ----- aliases in the OptionalList
+
+    auto count_1 = measure([&]() -> void {
+        for (std::size_t i = 0; i < __picks.size(); ++i)
+        {
+            switch (__picks[i])
+            {
+            case 0: a[i] = __options["name"].operator->(); break;
+            case 1: a[i] = __options["width"].operator->(); break;
+            default: a[i] = __options["height"].operator->(); break;
+            }
+        }
+    });
+
+    // ----- aliases joined with `or`
+
+    auto count_2 = measure([&]() -> void {
+        for (std::size_t i = 0; i < __picks.size(); ++i)
+        {
+            switch (__picks[i])
+            {
+            case 0: b[i] = __kwargs["name"_opt or "n" or "lastname" or "surname"].operator->(); break;
+            case 1: b[i] = __kwargs["width"_opt or "w" or "cx" or "x_size"].operator->(); break;
+            default: b[i] = __kwargs["height"_opt or "h" or "cy" or "y_size"].operator->(); break;
+            }
+        }
+    });
+
+    test () expect (a == b);
+
+    test () pursue (count_1 <= count_2);
+}
+
+// Both receive the same list, so that the values they find can be compared.
+static void run_both(Kwargs<>::container_type __list, const std::vector<int>& __picks)
+{
+    run(__list, __list, __picks);
+}
+
+int main()
+{
+    disable_test_interrupts();
+
+    std::mt19937 rng(std::random_device{}());
+
+    std::vector<int> picks(1'000'000);
+
+    for (auto& pick : picks)
+    {
+        pick = static_cast<int>(rng() % 3);
+    }
+
+    run_both({
+        { "visible", true }, { "border", 1 }, { "color", 0xFFFFFF },
+        { "y_size", 480 }, { "x_size", 640 }, { "surname", "Yang" } }, picks);
+
+    return testing_completed;
+}
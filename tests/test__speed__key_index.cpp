@@ -0,0 +1,81 @@
+#ifndef KWARGS_KEY_INDEX_THRESHOLD
+#   define KWARGS_KEY_INDEX_THRESHOLD 32
+#endif
+
+#include "test.h"
+
+#include <vector>
+#include <random>
+
+// The scan of operator[] before the signature and the index.
+static const KwargsValue* find_by_scan(const Kwargs<>& __kwargs, KwargsKey __key) noexcept
+{
+    for (const auto& i : __kwargs)
+    {
+        if (i.first == __key)
+        {
+            return &i.second;
+        }
+    }
+
+    return nullptr;
+}
+
+static void run(Kwargs<> __kwargs, const std::vector<KwargsKey>& __keys)
+{
+    std::vector<const KwargsValue*> a(__keys.size()), b(__keys.size());
+
+    // ----- signature and index
+
+    auto count_1 = measure([&]() -> void {
+        for (std::size_t i = 0; i < __keys.size(); ++i)
+            a[i] = __kwargs[__keys[i]].operator->();
+    });
+
+    // ----- linear scan
+
+    auto count_2 = measure([&]() -> void {
+        for (std::size_t i = 0; i < __keys.size(); ++i)
+            b[i] = find_by_scan(__kwargs, __keys[i]);
+    });
+
+    test () expect (a == b);
+
+    test () pursue (count_1 <= count_2);
+}
+
+int main()
+{
+    disable_test_interrupts();
+
+    std::mt19937 rng(std::random_device{}());
+
+    std::vector<KwargsKey> keys(100'000);
+
+    // Nine in ten keys are absent.
+    for (auto& key : keys)
+    {
+        const std::string name = (rng() % 10 ? "missing_" : "flag_") + std::to_string(rng() % 128);
+        key = KwargsKey(name.data(), name.size());
+    }
+
+    run({
+        { "flag_0", 0 }, { "flag_1", 1 }, { "flag_2", 2 }, { "flag_3", 3 }, { "flag_4", 4 }, { "flag_5", 5 }, { "flag_6", 6 }, { "flag_7", 7 },
+        { "flag_8", 8 }, { "flag_9", 9 }, { "flag_10", 10 }, { "flag_11", 11 }, { "flag_12", 12 }, { "flag_13", 13 }, { "flag_14", 14 }, { "flag_15", 15 },
+        { "flag_16", 16 }, { "flag_17", 17 }, { "flag_18", 18 }, { "flag_19", 19 }, { "flag_20", 20 }, { "flag_21", 21 }, { "flag_22", 22 }, { "flag_23", 23 },
+        { "flag_24", 24 }, { "flag_25", 25 }, { "flag_26", 26 }, { "flag_27", 27 }, { "flag_28", 28 }, { "flag_29", 29 }, { "flag_30", 30 }, { "flag_31", 31 },
+        { "flag_32", 32 }, { "flag_33", 33 }, { "flag_34", 34 }, { "flag_35", 35 }, { "flag_36", 36 }, { "flag_37", 37 }, { "flag_38", 38 }, { "flag_39", 39 },
+        { "flag_40", 40 }, { "flag_41", 41 }, { "flag_42", 42 }, { "flag_43", 43 }, { "flag_44", 44 }, { "flag_45", 45 }, { "flag_46", 46 }, { "flag_47", 47 },
+        { "flag_48", 48 }, { "flag_49", 49 }, { "flag_50", 50 }, { "flag_51", 51 }, { "flag_52", 52 }, { "flag_53", 53 }, { "flag_54", 54 }, { "flag_55", 55 },
+        { "flag_56", 56 }, { "flag_57", 57 }, { "flag_58", 58 }, { "flag_59", 59 }, { "flag_60", 60 }, { "flag_61", 61 }, { "flag_62", 62 }, { "flag_63", 63 },
+        { "flag_64", 64 }, { "flag_65", 65 }, { "flag_66", 66 }, { "flag_67", 67 }, { "flag_68", 68 }, { "flag_69", 69 }, { "flag_70", 70 }, { "flag_71", 71 },
+        { "flag_72", 72 }, { "flag_73", 73 }, { "flag_74", 74 }, { "flag_75", 75 }, { "flag_76", 76 }, { "flag_77", 77 }, { "flag_78", 78 }, { "flag_79", 79 },
+        { "flag_80", 80 }, { "flag_81", 81 }, { "flag_82", 82 }, { "flag_83", 83 }, { "flag_84", 84 }, { "flag_85", 85 }, { "flag_86", 86 }, { "flag_87", 87 },
+        { "flag_88", 88 }, { "flag_89", 89 }, { "flag_90", 90 }, { "flag_91", 91 }, { "flag_92", 92 }, { "flag_93", 93 }, { "flag_94", 94 }, { "flag_95", 95 },
+        { "flag_96", 96 }, { "flag_97", 97 }, { "flag_98", 98 }, { "flag_99", 99 }, { "flag_100", 100 }, { "flag_101", 101 }, { "flag_102", 102 }, { "flag_103", 103 },
+        { "flag_104", 104 }, { "flag_105", 105 }, { "flag_106", 106 }, { "flag_107", 107 }, { "flag_108", 108 }, { "flag_109", 109 }, { "flag_110", 110 }, { "flag_111", 111 },
+        { "flag_112", 112 }, { "flag_113", 113 }, { "flag_114", 114 }, { "flag_115", 115 }, { "flag_116", 116 }, { "flag_117", 117 }, { "flag_118", 118 }, { "flag_119", 119 },
+        { "flag_120", 120 }, { "flag_121", 121 }, { "flag_122", 122 }, { "flag_123", 123 }, { "flag_124", 124 }, { "flag_125", 125 }, { "flag_126", 126 }, { "flag_127", 127 } }, keys);
+
+    return testing_completed;
+}
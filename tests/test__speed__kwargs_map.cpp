@@ -0,0 +1,75 @@
+#include "test.h"
+
+#include <map>
+#include <vector>
+#include <random>
+
+static void run(Kwargs<> __kwargs, const std::vector<KwargsKey>& __keys)
+{
+    // ----- kwargs::KwargsMap
+
+    KwargsMap map = __kwargs;
+
+    // ----- std::map, as options were kept before
+
+    std::map<KwargsKey::value_type, KwargsValue> tree;
+
+    for (const auto& i : __kwargs)
+    {
+        tree.emplace(i.first.value(), i.second);
+    }
+
+    std::vector<const KwargsValue*> a(__keys.size()), b(__keys.size());
+
+    auto count_1 = measure([&]() -> void {
+        for (std::size_t i = 0; i < __keys.size(); ++i)
+            a[i] = map[__keys[i]].operator->();
+    });
+
+    auto count_2 = measure([&]() -> void {
+        for (std::size_t i = 0; i < __keys.size(); ++i)
+        {
+            auto it = tree.find(__keys[i].value());
+            b[i] = it != tree.end() ? &it->second : nullptr;
+        }
+    });
+
+    for (std::size_t i = 0; i < __keys.size(); ++i)
+    {
+        // Both copied the same values.
+        if ((a[i] == nullptr) != (b[i] == nullptr) || (a[i] && a[i]->value<std::string>() != b[i]->value<std::string>()))
+        {
+            test () expect (false);
+            break;
+        }
+    }
+
+    test () pursue (count_1 <= count_2);
+}
+
+int main()
+{
+    disable_test_interrupts();
+
+    const KwargsKey names[] = {
+        "x", "y", "width", "height", "margin", "padding", "color", "border",
+        "visible", "enabled", "title", "font", "size", "style", "weight", "other"
+    };
+
+    std::mt19937 rng(std::random_device{}());
+
+    std::vector<KwargsKey> keys(1'000'000);
+
+    for (auto& key : keys)
+    {
+        key = names[rng() % std::size(names)];
+    }
+
+    run({
+        { "x", 0 }, { "y", 0 }, { "width", 640 }, { "height", 480 }, { "margin", 8 }, { "padding", 4 },
+        { "color", 0xFFFFFF }, { "border", 1 }, { "visible", true }, { "enabled", true },
+        { "title", std::string("kwargs") }, { "font", std::string("Consolas") }, { "size", 18.8 },
+        { "style", "italic" }, { "weight", 700 } }, keys);
+
+    return testing_completed;
+}
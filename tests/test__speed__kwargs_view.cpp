@@ -0,0 +1,51 @@
+#include "test.h"
+
+#include <vector>
+
+using FontOptions = Kwargs<"font"_opt, "size"_opt, "weight"_opt>;
+using LabelOptions = Kwargs<"text"_opt, "font"_opt, "size"_opt, "weight"_opt, "color"_opt>;
+
+static std::size_t font_of(FontOptions __kwargs)
+{
+    return __kwargs["font"].valueOr<std::string_view>().size() + __kwargs["size"].valueOr<std::size_t>(9);
+}
+
+int main()
+{
+    disable_test_interrupts();
+
+    const std::string text(64, 't');
+    const std::string font(64, 'f');
+
+    auto label = [&](auto __forward) -> std::size_t {
+        return __forward(LabelOptions{
+            { "text", std::string(text) }, { "font", std::string(font) }, { "size", 18 }, { "weight", 700 }, { "color", "red" } });
+    };
+
+    std::vector<std::size_t> a(100'000), b(a.size());
+
+    // ----- forwarded through a view
+
+    auto count_1 = measure([&]() -> void {
+        for (std::size_t i = 0; i < a.size(); ++i)
+            a[i] = label([](LabelOptions __kwargs) -> std::size_t {
+                return font_of(__kwargs.only<"font"_opt, "size"_opt, "weight"_opt>());
+            });
+    });
+
+    // ----- forwarded through a new list, which copies the values
+
+    auto count_2 = measure([&]() -> void {
+        for (std::size_t i = 0; i < b.size(); ++i)
+            b[i] = label([](LabelOptions __kwargs) -> std::size_t {
+                return font_of({ { "font", *__kwargs["font"] }, { "size", *__kwargs["size"] }, { "weight", *__kwargs["weight"] } });
+            });
+    });
+
+    test () expect (a == b);
+    test () expect (a[0] == font.size() + 18);
+
+    test () pursue (count_1 <= count_2);
+
+    return testing_completed;
+}
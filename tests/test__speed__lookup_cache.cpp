@@ -0,0 +1,64 @@
+#include "test.h"
+
+using Options = Kwargs<>;
+
+// Looks up the same keys as a constructor would, once from the list and once through the caches.
+static std::size_t read_by_lookup(Options& __kwargs)
+{
+    return __kwargs["x"].hasValue() + __kwargs["y"].hasValue()
+        + __kwargs["width"].hasValue() + __kwargs["height"].hasValue()
+        + __kwargs["margin"].hasValue() + __kwargs["padding"].hasValue()
+        + __kwargs["color"].hasValue() + __kwargs["border"].hasValue();
+}
+
+static LookupCache x, y, width, height, margin, padding, color, border;
+
+static std::size_t read_by_cache(Options& __kwargs)
+{
+    return __kwargs.cached("x", x).hasValue() + __kwargs.cached("y", y).hasValue()
+        + __kwargs.cached("width", width).hasValue() + __kwargs.cached("height", height).hasValue()
+        + __kwargs.cached("margin", margin).hasValue() + __kwargs.cached("padding", padding).hasValue()
+        + __kwargs.cached("color", color).hasValue() + __kwargs.cached("border", border).hasValue();
+}
+
+static void run(Options __kwargs)
+{
+    constexpr int count = 50'000;
+
+    std::size_t a = 0, b = 0;
+
+    // ----- LookupCache
+
+    auto count_1 = measure([&]() -> void {
+        for (int i = 0; i < count; ++i)
+            a += read_by_cache(__kwargs);
+    });
+
+    // ----- operator[]
+
+    auto count_2 = measure([&]() -> void {
+        for (int i = 0; i < count; ++i)
+            b += read_by_lookup(__kwargs);
+    });
+
+    test () expect (a == b);
+
+    // Every lookup but the first of each key hits, so each of them skips the search operator[] does.
+    test () expect (x.misses() == 1 && x.hits() == count - 1);
+    test () expect (border.misses() == 1 && border.hits() == count - 1);
+
+    test () pursue (count_1 < count_2);
+}
+
+int main()
+{
+    disable_test_interrupts();
+
+    run({
+        { "visible", true }, { "enabled", true }, { "tooltip", "kwargs" }, { "font", "Arial" },
+        { "opacity", 1.0 }, { "cursor", 0 }, { "z", 0 }, { "id", 7 },
+        { "x", 1 }, { "y", 2 }, { "width", 640 }, { "height", 480 },
+        { "margin", 8 }, { "padding", 4 }, { "color", 0xFFFFFF }, { "border", 1 } });
+
+    return testing_completed;
+}
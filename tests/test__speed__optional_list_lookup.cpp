@@ -0,0 +1,69 @@
+#include "test.h"
+
+#include <vector>
+#include <random>
+
+using Options = Kwargs<
+    "x"_opt, "y"_opt, "width"_opt, "height"_opt, "margin"_opt,
+    "padding"_opt, "color"_opt, "border"_opt, "visible"_opt, "enabled"_opt>;
+
+// The lookup of Kwargs<> and of an OptionalList without a slot table.
+static const KwargsValue* find_by_scan(const Options& __kwargs, KwargsKey __key) noexcept
+{
+    for (const auto& i : __kwargs)
+    {
+        if (i.first == __key)
+        {
+            return &i.second;
+        }
+    }
+
+    return nullptr;
+}
+
+static void run(Options __kwargs, const std::vector<KwargsKey>& __keys)
+{
+    std::vector<const KwargsValue*> a(__keys.size()), b(__keys.size());
+
+    // ----- slot table
+
+    auto count_1 = measure([&]() -> void {
+        for (std::size_t i = 0; i < __keys.size(); ++i)
+            a[i] = __kwargs[__keys[i]].operator->();
+    });
+
+    // ----- linear scan
+
+    auto count_2 = measure([&]() -> void {
+        for (std::size_t i = 0; i < __keys.size(); ++i)
+            b[i] = find_by_scan(__kwargs, __keys[i]);
+    });
+
+    test () expect (a == b);
+
+    test () pursue (count_1 <= count_2);
+}
+
+int main()
+{
+    disable_test_interrupts();
+
+    const KwargsKey names[] = {
+        "x", "y", "width", "height", "margin", "padding", "color", "border", "visible", "enabled", "other"
+    };
+
+    std::mt19937 rng(std::random_device{}());
+
+    std::vector<KwargsKey> keys(1'000'000);
+
+    for (auto& key : keys)
+    {
+        key = names[rng() % std::size(names)];
+    }
+
+    run({
+        { "enabled", true }, { "visible", true }, { "border", 1 }, { "color", 0xFFFFFF }, { "padding", 4 },
+        { "margin", 8 }, { "height", 480 }, { "width", 640 }, { "y", 0 }, { "x", 0 } }, keys);
+
+    return testing_completed;
+}
@@ -0,0 +1,101 @@
+#include "test.h"
+
+static std::chrono::milliseconds timeout(Kwargs<"timeout"_opt> __kwargs)
+{
+    using namespace std::chrono_literals;
+    return __kwargs["timeout"].valueOr<std::chrono::milliseconds>(5s);
+}
+
+static std::size_t buffer_size(Kwargs<"size"_opt> __kwargs)
+{
+    return __kwargs["size"].valueOr<std::size_t>(kwargs::unit::bytes, 4096);
+}
+
+int main()
+{
+    using namespace std::string_literals;
+    using namespace std::string_view_literals;
+    using namespace std::chrono_literals;
+
+
+    test (KwargsValue value("250ms")) expect (value.value<std::chrono::milliseconds>() == 250ms);
+
+    test (KwargsValue value("0.29s")) expect (value.value<std::chrono::milliseconds>() == 290ms);
+
+    test (KwargsValue value("1.5 min"s)) expect (value.value<std::chrono::seconds>() == 90s);
+
+    test (KwargsValue value("2h"sv)) expect (value.value<std::chrono::minutes>() == 120min);
+
+    test (KwargsValue value("1500us")) expect (value.value<std::chrono::milliseconds>() == 1ms);
+
+    test (KwargsValue value("1d")) expect (value.value<std::chrono::hours>() == 24h);
+
+    test (KwargsValue value("30")) expect (value.value<std::chrono::seconds>() == 30s);
+
+    test (KwargsValue value("-5s")) expect (value.value<std::chrono::milliseconds>() == -5000ms);
+
+    test (KwargsValue value("1.5s")) expect (value.value<std::chrono::duration<double>>() == std::chrono::duration<double>(1.5));
+
+    test (KwargsValue value("750ms")) expect (value.value<std::chrono::duration<double>>() == std::chrono::duration<double>(0.75));
+
+    test (KwargsValue value(std::vector<char>{'4', '0', 'n', 's'})) expect (value.value<std::chrono::nanoseconds>() == 40ns);
+
+
+    test (KwargsValue value(100)) expect (value.value<std::chrono::milliseconds>() == 100ms);
+
+    test (KwargsValue value(2.9)) expect (value.value<std::chrono::seconds>() == 2s);
+
+    test (KwargsValue value(3ms)) expect (value.value<std::chrono::milliseconds>() == 3ms);
+
+    test (KwargsValue value(nullptr)) expect (value.value<std::chrono::seconds>(7) == 7s);
+
+    // Another duration type is rescaled from its own period.
+    test (KwargsValue value(2s)) expect (value.value<std::chrono::milliseconds>() == 2000ms);
+
+    test (KwargsValue value(1500ms)) expect (value.value<std::chrono::seconds>() == 1s);
+
+    test (KwargsValue value(-1500ms)) expect (value.value<std::chrono::seconds>() == -1s);
+
+    test (KwargsValue value(90min)) expect (value.value<std::chrono::hours>() == 1h);
+
+    test (KwargsValue value(250ms)) expect (value.value<std::chrono::duration<double>>() == std::chrono::duration<double>(0.25));
+
+    test (KwargsValue value(std::chrono::duration<double>(1.5))) expect (value.value<std::chrono::milliseconds>() == 1500ms);
+
+    test (KwargsValue value(std::chrono::duration<int, std::ratio<1, 3>>(2))) expect (value.value<std::chrono::milliseconds>() == 666ms);
+
+    test (KwargsValue value(std::chrono::hours::max())) expect (value.value<std::chrono::nanoseconds>() == std::chrono::nanoseconds::max());
+
+    test (KwargsValue value(1000000h)) expect (value.value<std::chrono::duration<std::int32_t>>() == std::chrono::duration<std::int32_t>::max());
+
+
+    test (KwargsValue value("3k")) expect (value.value<std::chrono::seconds>(kwargs::unit::si) == 3000s);
+
+    test (KwargsValue value("1.0000000000000000000s")) expect (value.value<std::chrono::milliseconds>() == 1000ms);
+
+    test (KwargsValue value("2.5000000000000000000000000000h")) expect (value.value<std::chrono::seconds>() == 9000s);
+
+    test (KwargsValue value("1.2345678901234567891s")) expect (value.value<std::chrono::microseconds>() == 1234567us);
+
+    test (KwargsValue value("9999999999999h")) expect (value.value<std::chrono::nanoseconds>() == std::chrono::nanoseconds::max());
+
+    test () expect (timeout({ { "timeout", "1.25s" } }) == 1250ms);
+
+    test () expect (timeout({ }) == 5000ms);
+
+    test () expect (timeout({ { "timeout", "10m" } }) == 5000ms);
+
+    test (KwargsValue value("10m")) expect (value.value<std::chrono::milliseconds>() == 0ms);
+
+    test (KwargsValue value("10m")) expect (value.value<std::chrono::milliseconds>(kwargs::unit::durations) == 0ms);
+
+    test (KwargsValue value("18446744073709551615ns")) expect (value.value<std::chrono::duration<std::uint64_t, std::nano>>().count() == std::numeric_limits<std::uint64_t>::max());
+
+    test () expect (timeout({ { "timeout", 2s } }) == 2000ms);
+
+    test () expect (buffer_size({ { "size", "64MiB" } }) == 67108864U);
+
+    test () expect (buffer_size({ }) == 4096U);
+
+    return testing_completed;
+}
@@ -41,5 +41,22 @@ int main()
     test (KwargsValue value("max")) expect(value.value<long double>() == std::numeric_limits<long double>::max());
     test (KwargsValue value("min")) expect(value.value<long double>() == std::numeric_limits<long double>::min());
 
+    // Halfway cases are rounded once, to the nearest value of the result type.
+    const std::string double_halfway = "9007199254740993.000000000000000000001";
+    const std::string float_halfway = "1.000000059604644775390625000001";
+
+    const std::string_view double_halfway_view = double_halfway;
+    const std::string_view float_halfway_view = float_halfway;
+
+    test (KwargsValue value(double_halfway)) expect (value.value<double>() == 9007199254740994.0);
+    test (KwargsValue value(double_halfway_view)) expect (value.value<double>() == 9007199254740994.0);
+    test (KwargsValue value(float_halfway)) expect (value.value<float>() == 1.00000012f);
+    test (KwargsValue value(float_halfway_view)) expect (value.value<float>() == 1.00000012f);
+
+    test (KwargsValue value("1.5k")) expect (value.value<double>(kwargs::unit::si) == 1500.0);
+    test (KwargsValue value("250m")) expect (value.value<double>(kwargs::unit::si) == 0.25);
+    test (KwargsValue value("0.5KiB"sv)) expect (value.value<float>(kwargs::unit::bytes) == 512.0f);
+    test (KwargsValue value("2.5")) expect (value.value<double>(kwargs::unit::si) == 2.5);
+
     return testing_completed;
-}
\ No newline at end of file
+}
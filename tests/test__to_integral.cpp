@@ -65,5 +65,50 @@ int main()
     test (KwargsValue value("max")) expect (value == std::numeric_limits<std::uint64_t>::max());
     test (KwargsValue value("min")) expect (value == std::numeric_limits<std::uint64_t>::min());
 
+    test (KwargsValue value("64MiB")) expect (value.value<std::uint64_t>(kwargs::unit::bytes) == 67108864U);
+    test (KwargsValue value("1.5k"sv)) expect (value.value<int>(kwargs::unit::si) == 1500);
+    test (KwargsValue value(" 2 GB ")) expect (value.value<std::int64_t>(kwargs::unit::bytes) == 2000000000);
+    test (KwargsValue value("1EiB")) expect (value.value<std::uint64_t>(kwargs::unit::bytes) == (1ULL << 60));
+    test (KwargsValue value("16EiB")) expect (value.value<std::uint64_t>(kwargs::unit::bytes) == std::numeric_limits<std::uint64_t>::max());
+    test (KwargsValue value("1e3k")) expect (value.value<int>(kwargs::unit::si) == 1000000);
+    test (KwargsValue value("512")) expect (value.value<int>(kwargs::unit::bytes) == 512);
+    test (KwargsValue value("-4k")) expect (value.value<unsigned>(kwargs::unit::bytes) == 0U);
+    test (KwargsValue value("0x10")) expect (value.value<int>(kwargs::unit::bytes) == 16);
+    test (KwargsValue value(4096)) expect (value.value<int>(kwargs::unit::bytes) == 4096);
+
+    // Long fraction tails are netted against the scale of the suffix.
+    test (KwargsValue value("1.0000000000000000000EB")) expect (value.value<std::uint64_t>(kwargs::unit::bytes) == 1000000000000000000ULL);
+    test (KwargsValue value("1.5000000000000000000000000001EB")) expect (value.value<std::uint64_t>(kwargs::unit::bytes) == 1500000000000000000ULL);
+    test (KwargsValue value("0.50000000000000000000000KiB")) expect (value.value<int>(kwargs::unit::bytes) == 512);
+    test (KwargsValue value("1.2345678901234567891k")) expect (value.value<int>(kwargs::unit::si) == 1234);
+    test (KwargsValue value("12345678901234567891e-19k")) expect (value.value<int>(kwargs::unit::si) == 1234);
+    test (KwargsValue value("0.0000000000000000000000001EB")) expect (value.value<int>(kwargs::unit::bytes) == 0);
+
+    // Every digit of the largest value is kept; one more digit saturates.
+    test (KwargsValue value("18446744073709551615")) expect (value.value<std::uint64_t>(kwargs::unit::bytes) == std::numeric_limits<std::uint64_t>::max());
+    test (KwargsValue value("18446744073709551614B")) expect (value.value<std::uint64_t>(kwargs::unit::bytes) == std::numeric_limits<std::uint64_t>::max() - 1);
+    test (KwargsValue value("184467440737095516159")) expect (value.value<std::uint64_t>(kwargs::unit::bytes) == std::numeric_limits<std::uint64_t>::max());
+    test (KwargsValue value("-9223372036854775808")) expect (value.value<std::int64_t>(kwargs::unit::si) == std::numeric_limits<std::int64_t>::min());
+
+    // A scale that does not fit into intmax_t saturates and is reported.
+    test (std::errc ec{}) expect (kwargs::detail::string_to_integer<long long, std::pico>("5E", kwargs::unit::si, ec) == std::numeric_limits<long long>::max() && ec == std::errc::result_out_of_range);
+    test (std::errc ec{}) expect (kwargs::detail::string_to_integer<long long, std::pico>("0E", kwargs::unit::si, ec) == 0 && ec == std::errc{});
+    test (std::errc ec{}) expect (kwargs::detail::string_to_integer<long long, std::exa>("5p", kwargs::unit::si, ec) == 0 && ec == std::errc::result_out_of_range);
+    test (std::errc ec{}) expect (kwargs::detail::string_to_floating_point<double, std::pico>("5E", kwargs::unit::si, ec) == 5e30 && ec == std::errc{});
+    test (std::errc ec{}) expect (kwargs::detail::string_to_integer<std::uint64_t>("16EiB", kwargs::unit::bytes, ec) == std::numeric_limits<std::uint64_t>::max() && ec == std::errc::result_out_of_range);
+    test (std::errc ec{}) expect (kwargs::detail::string_to_integer<std::uint64_t>("1e1E", kwargs::unit::bytes, ec) == 10000000000000000000ULL && ec == std::errc{});
+    test (std::errc ec{}) expect (kwargs::detail::string_to_integer<std::uint64_t>("18446744073709551615", kwargs::unit::bytes, ec) == std::numeric_limits<std::uint64_t>::max() && ec == std::errc{});
+
+    // Unknown suffixes are not read as the base unit.
+    test (KwargsValue value("64XB")) expect (value.value<std::uint64_t>(kwargs::unit::bytes) == 0U);
+    test (KwargsValue value("64mib")) expect (value.value<std::uint64_t>(kwargs::unit::bytes) == 0U);
+    test (KwargsValue value("1.5 kilo")) expect (value.value<double>(kwargs::unit::si) == 0.0);
+
+    // A suffix after a radix prefix is rejected rather than dropped.
+    test (KwargsValue value("0x10k")) expect (value.value<int>(kwargs::unit::bytes) == 0);
+    test (std::errc ec{}) expect (kwargs::detail::string_to_integer<int>("0x10k", kwargs::unit::bytes, ec) == 0 && ec == std::errc::invalid_argument);
+    test (std::errc ec{}) expect (kwargs::detail::string_to_integer<int>(" 0x10B ", kwargs::unit::bytes, ec) == 0x10B && ec == std::errc{});
+    test (std::errc ec{}) expect (kwargs::detail::string_to_integer<unsigned>("0b101", kwargs::unit::bytes, ec) == 5U && ec == std::errc{});
+
     return testing_completed;
-}
\ No newline at end of file
+}
@@ -179,5 +179,47 @@ int main()
     test (KwargsValue value(-std::numeric_limits<double>::infinity()))          expect (value.value<std::string>() == "-inf");
     test (KwargsValue value(-std::numeric_limits<long double>::infinity()))     expect (value.value<std::string>() == "-inf");
 
+
+    using kwargs::fmt::fixed;
+    using kwargs::fmt::scientific;
+    using kwargs::fmt::shortest;
+
+    test (KwargsValue value(1.0 / 3))  expect (value.value<std::string>(fixed(3)) == "0.333");
+    test (KwargsValue value(2.0 / 3))  expect (value.value<std::string>(fixed(3)) == "0.667");
+    test (KwargsValue value(0.5))      expect (value.value<std::string>(fixed(0)) == "0");
+    test (KwargsValue value(1.5))      expect (value.value<std::string>(fixed(0)) == "2");
+    test (KwargsValue value(2.5))      expect (value.value<std::string>(fixed(0)) == "2");
+    test (KwargsValue value(0.125))    expect (value.value<std::string>(fixed(2)) == "0.12");
+    test (KwargsValue value(0.375))    expect (value.value<std::string>(fixed(2)) == "0.38");
+    test (KwargsValue value(9.995))    expect (value.value<std::string>(fixed(2)) == "9.99");
+    test (KwargsValue value(99.5f))    expect (value.value<std::string>(fixed(0)) == "100");
+    test (KwargsValue value(-0.0001))  expect (value.value<std::string>(fixed(2)) == "-0.00");
+    test (KwargsValue value(0.1))      expect (value.value<std::string>(fixed(20)) == "0.10000000000000000555");
+    test (KwargsValue value(0.1f))     expect (value.value<std::string>(fixed(30)) == "0.100000001490116119384765625000");
+    test (KwargsValue value(1e22))     expect (value.value<std::string>(fixed(1)) == "10000000000000000000000.0");
+    test (KwargsValue value(5e-324))   expect (value.value<std::string>(fixed(3)) == "0.000");
+    test (KwargsValue value(0.1L))     expect (value.value<std::string>(fixed(3)) == "0.100");
+
+    test (KwargsValue value(0.0))      expect (value.value<std::string>(scientific(2)) == "0.00e+00");
+    test (KwargsValue value(123.456))  expect (value.value<std::string>(scientific(3)) == "1.235e+02");
+    test (KwargsValue value(-9.5))     expect (value.value<std::string>(scientific(0)) == "-1e+01");
+    test (KwargsValue value(9.96))     expect (value.value<std::string>(scientific(1)) == "1.0e+01");
+    test (KwargsValue value(1e23))     expect (value.value<std::string>(scientific(17)) == "9.99999999999999916e+22");
+    test (KwargsValue value(5e-324))   expect (value.value<std::string>(scientific(3)) == "4.941e-324");
+    test (KwargsValue value(1e-5f))    expect (value.value<std::string>(scientific(1)) == "1.0e-05");
+    test (KwargsValue value(1.5e300L)) expect (value.value<std::string>(scientific(1)) == "1.5e+300");
+
+    test (KwargsValue value(0.1))      expect (value.value<std::string>(shortest()) == "0.1");
+    test (KwargsValue value(42))       expect (value.value<std::string>(fixed(2)) == "42");
+
+    test (KwargsValue value(std::numeric_limits<double>::infinity()))  expect (value.value<std::string>(fixed(2)) == "inf");
+    test (KwargsValue value(std::numeric_limits<double>::quiet_NaN())) expect (value.value<std::string>(scientific(2)) == "NaN");
+
+    auto format_ratio = [](Kwargs<"ratio"_opt, "missing"_opt> __kwargs) -> std::string {
+        return __kwargs["ratio"_opt].valueOr<std::string>(fixed(2), "-") + " " + __kwargs["missing"_opt].valueOr<std::string>(fixed(2), "-");
+    };
+
+    test () expect (format_ratio({ { "ratio"_opt, 0.125 } }) == "0.12 -");
+
     return testing_completed;
 }
\ No newline at end of file
@@ -0,0 +1,183 @@
+#include "test.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+static std::size_t allocation_count = 0;
+
+// Every allocation function is replaced, so that no block crosses between this allocator and the library's.
+static void* counted_allocate(std::size_t __size, std::size_t __alignment = alignof(std::max_align_t)) noexcept
+{
+    ++allocation_count;
+
+    if (__alignment <= alignof(std::max_align_t))
+    {
+        return std::malloc(__size ? __size : 1);
+    }
+
+    // Over-aligned blocks keep the address that malloc returned just below them.
+    void* const raw = std::malloc(__size + __alignment + sizeof(void*));
+
+    if (raw == nullptr)
+    {
+        return nullptr;
+    }
+
+    const std::uintptr_t aligned = (reinterpret_cast<std::uintptr_t>(raw) + sizeof(void*) + __alignment - 1) & ~std::uintptr_t(__alignment - 1);
+
+    reinterpret_cast<void**>(aligned)[-1] = raw;
+    return reinterpret_cast<void*>(aligned);
+}
+
+static void counted_release(void* __ptr, std::size_t __alignment = alignof(std::max_align_t)) noexcept
+{
+    if (__ptr && __alignment > alignof(std::max_align_t))
+    {
+        __ptr = static_cast<void**>(__ptr)[-1];
+    }
+
+    std::free(__ptr);
+}
+
+static void* counted_allocate_or_throw(std::size_t __size, std::size_t __alignment = alignof(std::max_align_t))
+{
+    if (void* ptr = counted_allocate(__size, __alignment))
+    {
+        return ptr;
+    }
+
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t __size)
+{ return counted_allocate_or_throw(__size); }
+
+void* operator new[](std::size_t __size)
+{ return counted_allocate_or_throw(__size); }
+
+void* operator new(std::size_t __size, const std::nothrow_t&) noexcept
+{ return counted_allocate(__size); }
+
+void* operator new[](std::size_t __size, const std::nothrow_t&) noexcept
+{ return counted_allocate(__size); }
+
+void* operator new(std::size_t __size, std::align_val_t __alignment)
+{ return counted_allocate_or_throw(__size, static_cast<std::size_t>(__alignment)); }
+
+void* operator new[](std::size_t __size, std::align_val_t __alignment)
+{ return counted_allocate_or_throw(__size, static_cast<std::size_t>(__alignment)); }
+
+void* operator new(std::size_t __size, std::align_val_t __alignment, const std::nothrow_t&) noexcept
+{ return counted_allocate(__size, static_cast<std::size_t>(__alignment)); }
+
+void* operator new[](std::size_t __size, std::align_val_t __alignment, const std::nothrow_t&) noexcept
+{ return counted_allocate(__size, static_cast<std::size_t>(__alignment)); }
+
+void operator delete(void* __ptr) noexcept
+{ counted_release(__ptr); }
+
+void operator delete[](void* __ptr) noexcept
+{ counted_release(__ptr); }
+
+void operator delete(void* __ptr, std::size_t) noexcept
+{ counted_release(__ptr); }
+
+void operator delete[](void* __ptr, std::size_t) noexcept
+{ counted_release(__ptr); }
+
+void operator delete(void* __ptr, const std::nothrow_t&) noexcept
+{ counted_release(__ptr); }
+
+void operator delete[](void* __ptr, const std::nothrow_t&) noexcept
+{ counted_release(__ptr); }
+
+void operator delete(void* __ptr, std::align_val_t __alignment) noexcept
+{ counted_release(__ptr, static_cast<std::size_t>(__alignment)); }
+
+void operator delete[](void* __ptr, std::align_val_t __alignment) noexcept
+{ counted_release(__ptr, static_cast<std::size_t>(__alignment)); }
+
+void operator delete(void* __ptr, std::size_t, std::align_val_t __alignment) noexcept
+{ counted_release(__ptr, static_cast<std::size_t>(__alignment)); }
+
+void operator delete[](void* __ptr, std::size_t, std::align_val_t __alignment) noexcept
+{ counted_release(__ptr, static_cast<std::size_t>(__alignment)); }
+
+void operator delete(void* __ptr, std::align_val_t __alignment, const std::nothrow_t&) noexcept
+{ counted_release(__ptr, static_cast<std::size_t>(__alignment)); }
+
+void operator delete[](void* __ptr, std::align_val_t __alignment, const std::nothrow_t&) noexcept
+{ counted_release(__ptr, static_cast<std::size_t>(__alignment)); }
+
+int main()
+{
+    using namespace std::string_literals;
+    using namespace std::string_view_literals;
+
+    disable_test_interrupts();
+
+    char buffer[400];
+
+    auto written = [&buffer](const KwargsValue& __value) -> std::string_view {
+        const char* last = __value.valueTo(std::begin(buffer), std::end(buffer));
+        return last ? std::string_view(buffer, static_cast<std::size_t>(last - buffer)) : "<nullptr>"sv;
+    };
+
+    test (KwargsValue value(false)) expect (written(value) == "false");
+    test (KwargsValue value('a'))   expect (written(value) == "a");
+    test (KwargsValue value("Welcome to kwargs!"))   expect (written(value) == "Welcome to kwargs!");
+    test (KwargsValue value("Welcome to kwargs!"s))  expect (written(value) == "Welcome to kwargs!");
+    test (KwargsValue value("Welcome to kwargs!"sv)) expect (written(value) == "Welcome to kwargs!");
+    test (KwargsValue value(std::int16_t(-32768)))  expect (written(value) == "-32768");
+    test (KwargsValue value(std::numeric_limits<std::uint64_t>::max())) expect (written(value) == "18446744073709551615");
+    test (KwargsValue value(0.1))   expect (written(value) == "0.1");
+    test (KwargsValue value(-2.5f)) expect (written(value) == "-2.5");
+    test (KwargsValue value(std::vector<char>{'K', 'w', 'a', 'r', 'g', 's', '!'})) expect (written(value) == "Kwargs!");
+
+    for (auto& value : { KwargsValue(true), KwargsValue(12345678), KwargsValue(1e300), KwargsValue("kwargs") })
+    {
+        test () expect (written(value) == value.value<std::string>());
+    }
+
+    // Too small
+    test (KwargsValue value(123456)) expect (value.valueTo(buffer, buffer + 5) == nullptr);
+    test (KwargsValue value(123456)) expect (value.valueTo(buffer, buffer + 6) == buffer + 6);
+    test (KwargsValue value("")) expect (value.valueTo(buffer, buffer) == buffer);
+
+    std::string prefix = "x=";
+
+    test (KwargsValue value(-42)) expect (value.appendTo(prefix) == "x=-42");
+
+    // No allocation
+    {
+        const std::string long_string(100, 's');
+
+        const KwargsValue values[] = {
+            true, 'x', "literal", long_string, std::string_view(long_string),
+            -12345, std::numeric_limits<std::int64_t>::min(), 3.25, 0.1f, 1e300, reinterpret_cast<void*>(0x1234)
+        };
+
+        std::string str;
+        str.reserve(1024);
+
+        const std::size_t before = allocation_count;
+
+        std::size_t size = 0;
+
+        for (const auto& value : values)
+        {
+            size += static_cast<std::size_t>(value.valueTo(std::begin(buffer), std::end(buffer)) - buffer);
+            value.appendTo(str);
+        }
+
+        const std::size_t after = allocation_count;
+
+        test () expect (after == before);
+        test () expect (size == str.size());
+        test () expect (str.substr(0, 12) == "truexliteral");
+    }
+
+    return testing_completed;
+}
@@ -49,4 +49,25 @@ output_stream information(std::cout, 0x0D);
 
 }  // namespace kt
 
+#else
+
+namespace kt
+{
+
+void output_stream::_M_before_output() const noexcept
+{
+    _M_ostream << "\033[" << _M_current_color << 'm';
+}
+
+void output_stream::_M_after_output() const noexcept
+{
+    _M_ostream << "\033[0m";
+}
+
+output_stream failings   (std::cerr, 31);
+output_stream warnings   (std::clog, 33);
+output_stream information(std::cout, 35);
+
+}  // namespace kt
+
 #endif  // defined(_WIN32)
\ No newline at end of file